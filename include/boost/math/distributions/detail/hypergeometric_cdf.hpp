@@ -22,12 +22,12 @@ namespace boost{ namespace math{ namespace detail{
 #endif
       BOOST_MATH_STD_USING
       T result = 0;
-      T mode = floor(T(r + 1) * T(n + 1) / (N + 2));
+      T mode = floor((T(r) + 1) * (T(n) + 1) / (T(N) + 2));
       if(x < mode)
       {
          result = hypergeometric_pdf<T>(x, r, n, N, pol);
          T diff = result;
-         unsigned lower_limit = static_cast<unsigned>((std::max)(0, (int)(n + r) - (int)(N)));
+         unsigned lower_limit = r > N - n ? r - (N - n) : 0;
          while(diff > (invert ? T(1) : result) * tools::epsilon<T>())
          {
             diff = T(x) * T((N + x) - n - r) * diff / (T(1 + n - x) * T(1 + r - x));
@@ -10,8 +10,9 @@
 #define BOOST_MATH_DISTRIBUTIONS_DETAIL_HG_PDF_HPP
 
 #include <boost/math/constants/constants.hpp>
-#include <boost/math/special_functions/lanczos.hpp>
 #include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
 #include <boost/math/special_functions/pow.hpp>
 #include <boost/math/special_functions/prime.hpp>
 #include <boost/math/policies/error_handling.hpp>
@@ -22,212 +23,112 @@
 
 namespace boost{ namespace math{ namespace detail{
 
-template <class T, class Func>
-void bubble_down_one(T* first, T* last, Func f)
+template <class T, class Policy>
+T hypergeometric_stirling_error(T n, const Policy& pol)
 {
-   using std::swap;
-   T* next = first;
-   ++next;
-   while((next != last) && (!f(*first, *next)))
+   //
+   // Returns log(n!) - log(sqrt(2 pi n) (n/e)^n), the error in Stirling's
+   // approximation.  For small n we can take the difference directly,
+   // for larger n use the asymptotic series which avoids the cancellation
+   // error that would otherwise grow as n log(n) * epsilon:
+   //
+   BOOST_MATH_STD_USING
+   int digits = policies::digits<T, Policy>();
+   if(n < (std::max)(16, digits / 4))
+      return boost::math::lgamma(n + 1, pol) - (n + constants::half<T>()) * log(n) + n - constants::log_root_two_pi<T>();
+   //
+   // The series is asymptotic, with its smallest term, of order exp(-2 pi n),
+   // near k = pi n, so for n >= digits / 4 it reaches full precision before
+   // it diverges; at high precision that takes more terms than the unchecked
+   // table of Bernoulli numbers holds:
+   //
+   T n2 = n * n;
+   T power = n;
+   T result = 0;
+   for(unsigned k = 1; ; ++k)
    {
-      swap(*first, *next);
-      ++first;
-      ++next;
+      T term = boost::math::bernoulli_b2n<T>(k, pol) / (T(2 * k) * T(2 * k - 1) * power);
+      result += term;
+      if(fabs(term) < fabs(result) * tools::epsilon<T>())
+         break;
+      power *= n2;
    }
+   return result;
 }
 
 template <class T>
-struct sort_functor
+T hypergeometric_deviance(T x, T np)
 {
-   sort_functor(const T* exponents) : m_exponents(exponents){}
-   bool operator()(int i, int j)
-   {
-      return m_exponents[i] > m_exponents[j];
-   }
-private:
-   const T* m_exponents;
-};
-
-template <class T, class Lanczos, class Policy>
-T hypergeometric_pdf_lanczos_imp(T /*dummy*/, unsigned x, unsigned r, unsigned n, unsigned N, const Lanczos&, const Policy&)
-{
-   BOOST_MATH_STD_USING
-
-   BOOST_MATH_INSTRUMENT_FPU
-   BOOST_MATH_INSTRUMENT_VARIABLE(x);
-   BOOST_MATH_INSTRUMENT_VARIABLE(r);
-   BOOST_MATH_INSTRUMENT_VARIABLE(n);
-   BOOST_MATH_INSTRUMENT_VARIABLE(N);
-   BOOST_MATH_INSTRUMENT_VARIABLE(typeid(Lanczos).name());
-
-   T bases[9] = {
-      T(n) + static_cast<T>(Lanczos::g()) + 0.5f,
-      T(r) + static_cast<T>(Lanczos::g()) + 0.5f,
-      T(N - n) + static_cast<T>(Lanczos::g()) + 0.5f,
-      T(N - r) + static_cast<T>(Lanczos::g()) + 0.5f,
-      1 / (T(N) + static_cast<T>(Lanczos::g()) + 0.5f),
-      1 / (T(x) + static_cast<T>(Lanczos::g()) + 0.5f),
-      1 / (T(n - x) + static_cast<T>(Lanczos::g()) + 0.5f),
-      1 / (T(r - x) + static_cast<T>(Lanczos::g()) + 0.5f),
-      1 / (T(N - n - r + x) + static_cast<T>(Lanczos::g()) + 0.5f)
-   };
-   T exponents[9] = {
-      n + T(0.5f),
-      r + T(0.5f),
-      N - n + T(0.5f),
-      N - r + T(0.5f),
-      N + T(0.5f),
-      x + T(0.5f),
-      n - x + T(0.5f),
-      r - x + T(0.5f),
-      N - n - r + x + T(0.5f)
-   };
-   int base_e_factors[9] = {
-      -1, -1, -1, -1, 1, 1, 1, 1, 1
-   };
-   int sorted_indexes[9] = {
-      0, 1, 2, 3, 4, 5, 6, 7, 8
-   };
-#ifdef BOOST_MATH_INSTRUMENT
-   BOOST_MATH_INSTRUMENT_FPU
-   for(unsigned i = 0; i < 9; ++i)
-   {
-      BOOST_MATH_INSTRUMENT_VARIABLE(i);
-      BOOST_MATH_INSTRUMENT_VARIABLE(bases[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(exponents[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(base_e_factors[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(sorted_indexes[i]);
-   }
-#endif
-   std::sort(sorted_indexes, sorted_indexes + 9, sort_functor<T>(exponents));
-#ifdef BOOST_MATH_INSTRUMENT
-   BOOST_MATH_INSTRUMENT_FPU
-   for(unsigned i = 0; i < 9; ++i)
-   {
-      BOOST_MATH_INSTRUMENT_VARIABLE(i);
-      BOOST_MATH_INSTRUMENT_VARIABLE(bases[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(exponents[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(base_e_factors[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(sorted_indexes[i]);
-   }
-#endif
-
-   do{
-      exponents[sorted_indexes[0]] -= exponents[sorted_indexes[1]];
-      bases[sorted_indexes[1]] *= bases[sorted_indexes[0]];
-      if((bases[sorted_indexes[1]] < tools::min_value<T>()) && (exponents[sorted_indexes[1]] != 0))
-      {
-         return 0;
-      }
-      base_e_factors[sorted_indexes[1]] += base_e_factors[sorted_indexes[0]];
-      bubble_down_one(sorted_indexes, sorted_indexes + 9, sort_functor<T>(exponents));
-
-#ifdef BOOST_MATH_INSTRUMENT
-      for(unsigned i = 0; i < 9; ++i)
-      {
-         BOOST_MATH_INSTRUMENT_VARIABLE(i);
-         BOOST_MATH_INSTRUMENT_VARIABLE(bases[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(exponents[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(base_e_factors[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(sorted_indexes[i]);
-      }
-#endif
-   }while(exponents[sorted_indexes[1]] > 1);
-
    //
-   // Combine equal powers:
+   // Returns x log(x/np) + np - x, when x and np are close together
+   // we use a series in v = (x - np) / (x + np) to avoid cancellation:
    //
-   int j = 8;
-   while(exponents[sorted_indexes[j]] == 0) --j;
-   while(j)
+   BOOST_MATH_STD_USING
+   if(fabs(x - np) < (x + np) / 10)
    {
-      while(j && (exponents[sorted_indexes[j-1]] == exponents[sorted_indexes[j]]))
+      T v = (x - np) / (x + np);
+      T sum = (x - np) * v;
+      T term = 2 * x * v;
+      v *= v;
+      for(unsigned j = 1; ; ++j)
       {
-         bases[sorted_indexes[j-1]] *= bases[sorted_indexes[j]];
-         exponents[sorted_indexes[j]] = 0;
-         base_e_factors[sorted_indexes[j-1]] += base_e_factors[sorted_indexes[j]];
-         bubble_down_one(sorted_indexes + j, sorted_indexes + 9, sort_functor<T>(exponents));
-         --j;
+         term *= v;
+         T next = sum + term / (2 * j + 1);
+         if(next == sum)
+            break;
+         sum = next;
       }
-      --j;
-
-#ifdef BOOST_MATH_INSTRUMENT
-      BOOST_MATH_INSTRUMENT_VARIABLE(j);
-      for(unsigned i = 0; i < 9; ++i)
-      {
-         BOOST_MATH_INSTRUMENT_VARIABLE(i);
-         BOOST_MATH_INSTRUMENT_VARIABLE(bases[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(exponents[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(base_e_factors[i]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(sorted_indexes[i]);
-      }
-#endif
+      return sum;
    }
+   return x * log(x / np) + np - x;
+}
 
-#ifdef BOOST_MATH_INSTRUMENT
-   BOOST_MATH_INSTRUMENT_FPU
-   for(unsigned i = 0; i < 9; ++i)
-   {
-      BOOST_MATH_INSTRUMENT_VARIABLE(i);
-      BOOST_MATH_INSTRUMENT_VARIABLE(bases[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(exponents[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(base_e_factors[i]);
-      BOOST_MATH_INSTRUMENT_VARIABLE(sorted_indexes[i]);
-   }
-#endif
-
-   T result;
-   BOOST_MATH_INSTRUMENT_VARIABLE(bases[sorted_indexes[0]] * exp(static_cast<T>(base_e_factors[sorted_indexes[0]])));
-   BOOST_MATH_INSTRUMENT_VARIABLE(exponents[sorted_indexes[0]]);
-   {
-      BOOST_FPU_EXCEPTION_GUARD
-      result = pow(bases[sorted_indexes[0]] * exp(static_cast<T>(base_e_factors[sorted_indexes[0]])), exponents[sorted_indexes[0]]);
-   }
-   BOOST_MATH_INSTRUMENT_VARIABLE(result);
-   for(unsigned i = 1; (i < 9) && (exponents[sorted_indexes[i]] > 0); ++i)
-   {
-      BOOST_FPU_EXCEPTION_GUARD
-      if(result < tools::min_value<T>())
-         return 0; // short circuit further evaluation
-      if(exponents[sorted_indexes[i]] == 1)
-         result *= bases[sorted_indexes[i]] * exp(static_cast<T>(base_e_factors[sorted_indexes[i]]));
-      else if(exponents[sorted_indexes[i]] == 0.5f)
-         result *= sqrt(bases[sorted_indexes[i]] * exp(static_cast<T>(base_e_factors[sorted_indexes[i]])));
-      else
-         result *= pow(bases[sorted_indexes[i]] * exp(static_cast<T>(base_e_factors[sorted_indexes[i]])), exponents[sorted_indexes[i]]);
-   
-      BOOST_MATH_INSTRUMENT_VARIABLE(result);
-   }
+template <class T, class Policy>
+T hypergeometric_log_binomial_term(T x, T n, T p, T q, const Policy& pol)
+{
+   //
+   // Log of the binomial probability C(n, x) p^x q^(n-x) via Loader's
+   // saddle point expansion, see "Fast and Accurate Computation of
+   // Binomial Probabilities", C. Loader, 2000.  Every term is O(1) in
+   // size regardless of n, so the absolute error in the result is a few
+   // epsilon however large n may be:
+   //
+   BOOST_MATH_STD_USING
+   if(x == 0)
+      return p < 0.1f ? T(-hypergeometric_deviance(n, n * q) - n * p) : T(n * log(q));
+   if(x == n)
+      return q < 0.1f ? T(-hypergeometric_deviance(n, n * p) - n * q) : T(n * log(p));
+   T lc = hypergeometric_stirling_error(n, pol) - hypergeometric_stirling_error(x, pol) - hypergeometric_stirling_error(T(n - x), pol)
+      - hypergeometric_deviance(x, T(n * p)) - hypergeometric_deviance(T(n - x), T(n * q));
+   T lf = log(constants::two_pi<T>()) + log(x) + boost::math::log1p(-x / n, pol);
+   return lc - lf / 2;
+}
 
-   result *= Lanczos::lanczos_sum_expG_scaled(static_cast<T>(n + 1))
-      * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(r + 1))
-      * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(N - n + 1))
-      * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(N - r + 1))
-      / 
-      ( Lanczos::lanczos_sum_expG_scaled(static_cast<T>(N + 1))
-         * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(x + 1))
-         * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(n - x + 1))
-         * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(r - x + 1))
-         * Lanczos::lanczos_sum_expG_scaled(static_cast<T>(N - n - r + x + 1)));
-   
-   BOOST_MATH_INSTRUMENT_VARIABLE(result);
-   return result;
+template <class T, class Policy>
+T hypergeometric_log_pdf_imp(unsigned x, unsigned r, unsigned n, unsigned N, const Policy& pol)
+{
+   //
+   // The hypergeometric PDF is the ratio of three binomial probabilities:
+   //
+   // C(r, x) C(N - r, n - x) / C(N, n) = b(x; r, p) b(n - x; N - r, p) / b(n; N, p)
+   //
+   // for any p, choosing p = n / N places the denominator at its mode.
+   //
+   BOOST_MATH_STD_USING
+   if((n == 0) || (n == N) || (r == 0) || (r == N))
+      return 0;  // the distribution is degenerate.
+   T p = T(n) / T(N);
+   T q = T(N - n) / T(N);
+   return hypergeometric_log_binomial_term(T(x), T(r), p, q, pol)
+      + hypergeometric_log_binomial_term(T(n - x), T(N - r), p, q, pol)
+      - hypergeometric_log_binomial_term(T(n), T(N), p, q, pol);
 }
 
 template <class T, class Policy>
-T hypergeometric_pdf_lanczos_imp(T /*dummy*/, unsigned x, unsigned r, unsigned n, unsigned N, const boost::math::lanczos::undefined_lanczos&, const Policy& pol)
+inline T hypergeometric_pdf_log_imp(unsigned x, unsigned r, unsigned n, unsigned N, const Policy& pol)
 {
    BOOST_MATH_STD_USING
-   return exp(
-      boost::math::lgamma(T(n + 1), pol)
-      + boost::math::lgamma(T(r + 1), pol)
-      + boost::math::lgamma(T(N - n + 1), pol)
-      + boost::math::lgamma(T(N - r + 1), pol)
-      - boost::math::lgamma(T(N + 1), pol)
-      - boost::math::lgamma(T(x + 1), pol)
-      - boost::math::lgamma(T(n - x + 1), pol)
-      - boost::math::lgamma(T(r - x + 1), pol)
-      - boost::math::lgamma(T(N - n - r + x + 1), pol));
+   return exp(hypergeometric_log_pdf_imp<T>(x, r, n, N, pol));
 }
 
 template <class T>
@@ -432,7 +333,6 @@ inline typename tools::promote_args<T>::type
    BOOST_FPU_EXCEPTION_GUARD
    typedef typename tools::promote_args<T>::type result_type;
    typedef typename policies::evaluation<result_type, Policy>::type value_type;
-   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
    typedef typename policies::normalise<
       Policy, 
       policies::promote_float<false>, 
@@ -462,12 +362,12 @@ inline typename tools::promote_args<T>::type
    else
    {
       //
-      // Catch all case - use the lanczos approximation - where available - 
-      // to evaluate the ratio of factorials.  This is reasonably fast
-      // (almost as quick as using logarithmic evaluation in terms of lgamma)
-      // but only a few digits better in accuracy than using lgamma:
+      // Catch all case - evaluate in log space as a ratio of binomial
+      // probabilities using Stirling series differences.  This takes
+      // constant time for any N, and unlike a direct ratio of gamma
+      // functions, the error does not grow with N:
       //
-      result = detail::hypergeometric_pdf_lanczos_imp(value_type(), x, r, n, N, evaluation_type(), forwarding_policy());
+      result = detail::hypergeometric_pdf_log_imp<value_type>(x, r, n, N, forwarding_policy());
    }
 
    if(result > 1)
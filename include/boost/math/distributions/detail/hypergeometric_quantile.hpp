@@ -10,6 +10,8 @@
 
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/distributions/detail/hypergeometric_pdf.hpp>
+#include <boost/math/distributions/detail/hypergeometric_cdf.hpp>
+#include <boost/math/special_functions/erf.hpp>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -101,6 +103,122 @@ inline unsigned round_x_from_q(unsigned x, T /*q*/, T /*cum*/, T /*fudge_factor*
    return x;
 }
 
+template <class T, class Policy>
+unsigned hypergeometric_quantile_sweep_imp(T p, T q, unsigned r, unsigned n, unsigned N, unsigned base, unsigned lim, const Policy& pol)
+{
+   //
+   // For large N we can't afford to walk up from the end of the range,
+   // instead start from a normal approximation to the quantile, evaluate
+   // the CDF there once, and then sweep to the answer using the ratio
+   // of successive PDF values.  The stopping criteria are exactly those
+   // used by hypergeometric_quantile_imp below, so we arrive at the same x:
+   //
+   typedef typename Policy::discrete_quantile_type discrete_quantile_type;
+   BOOST_MATH_STD_USING
+   T fudge_factor = 1 + tools::epsilon<T>() * 50;
+   T mean = T(r) * T(n) / T(N);
+   T sd = sqrt(mean * (T(N) - T(r)) * (T(N) - T(n)) / (T(N) * (T(N) - 1)));
+   T guess;
+   if(p <= 0.5)
+      guess = p == 0 ? T(base) : T(mean - constants::root_two<T>() * boost::math::erfc_inv(2 * p, pol) * sd);
+   else
+      guess = q == 0 ? T(lim) : T(mean + constants::root_two<T>() * boost::math::erfc_inv(2 * q, pol) * sd);
+   unsigned x = guess <= base ? base : guess >= lim ? lim : static_cast<unsigned>(lltrunc(guess, pol));
+
+   BOOST_MATH_INSTRUMENT_VARIABLE(mean);
+   BOOST_MATH_INSTRUMENT_VARIABLE(sd);
+   BOOST_MATH_INSTRUMENT_VARIABLE(x);
+
+   T d = hypergeometric_pdf<T>(x, r, n, N, pol);
+   if(p <= 0.5)
+   {
+      //
+      // Find the smallest x with cdf(x) >= p or cdf(x) + pdf(x+1)/2 > p:
+      //
+      T cum = hypergeometric_cdf_imp<T>(x, r, n, N, false, pol);
+      T next = x == lim ? T(0) : (d > tools::min_value<T>() * 8)
+         ? T(n - x) * T(r - x) * d / (T(x + 1) * T(N + x + 1 - n - r))
+         : hypergeometric_pdf<T>(x + 1, r, n, N, pol);
+      if((cum >= p) || (cum + next / 2 > p))
+      {
+         //
+         // Moving towards the tail subtracts from the cumulative sum,
+         // so recompute it whenever it has shrunk enough for the
+         // cancellation error to matter:
+         //
+         T anchor = cum;
+         while(x != base)
+         {
+            T prev = cum - d;
+            if(prev < anchor / 4)
+               anchor = prev = hypergeometric_cdf_imp<T>(x - 1, r, n, N, false, pol);
+            if((prev < p) && (prev + d / 2 <= p))
+               break;
+            cum = prev;
+            d = (d > tools::min_value<T>() * 8)
+               ? x * T(N + x - n - r) * d / (T(1 + n - x) * T(1 + r - x))
+               : hypergeometric_pdf<T>(x - 1, r, n, N, pol);
+            --x;
+         }
+      }
+      else
+      {
+         do
+         {
+            ++x;
+            cum += next;
+            next = x == lim ? T(0) : (next > tools::min_value<T>() * 8)
+               ? T(n - x) * T(r - x) * next / (T(x + 1) * T(N + x + 1 - n - r))
+               : hypergeometric_pdf<T>(x + 1, r, n, N, pol);
+         } while((cum < p) && (cum + next / 2 <= p));
+      }
+      //
+      // Refresh the cumulative sum before rounding, it may have lost
+      // accuracy during the sweep:
+      //
+      cum = hypergeometric_cdf_imp<T>(x, r, n, N, false, pol);
+      return round_x_from_p(x, p, cum, fudge_factor, base, lim, discrete_quantile_type());
+   }
+   else
+   {
+      //
+      // Find the largest x with ccdf(x) + pdf(x)/2 >= q:
+      //
+      T cum = hypergeometric_cdf_imp<T>(x, r, n, N, true, pol);
+      if(cum + d / 2 >= q)
+      {
+         T anchor = cum;
+         while(x != lim)
+         {
+            T next = (d > tools::min_value<T>() * 8)
+               ? T(n - x) * T(r - x) * d / (T(x + 1) * T(N + x + 1 - n - r))
+               : hypergeometric_pdf<T>(x + 1, r, n, N, pol);
+            T rest = cum - next;
+            if(rest < anchor / 4)
+               anchor = rest = hypergeometric_cdf_imp<T>(x + 1, r, n, N, true, pol);
+            if(rest + next / 2 < q)
+               break;
+            cum = rest;
+            d = next;
+            ++x;
+         }
+      }
+      else
+      {
+         do
+         {
+            cum += d;
+            d = (d > tools::min_value<T>() * 8)
+               ? x * T(N + x - n - r) * d / (T(1 + n - x) * T(1 + r - x))
+               : hypergeometric_pdf<T>(x - 1, r, n, N, pol);
+            --x;
+         } while((x != base) && (cum + d / 2 < q));
+      }
+      cum = hypergeometric_cdf_imp<T>(x, r, n, N, true, pol);
+      return round_x_from_q(x, q, cum, fudge_factor, base, lim, discrete_quantile_type());
+   }
+}
+
 template <class T, class Policy>
 unsigned hypergeometric_quantile_imp(T p, T q, unsigned r, unsigned n, unsigned N, const Policy& pol)
 {
@@ -112,9 +230,11 @@ unsigned hypergeometric_quantile_imp(T p, T q, unsigned r, unsigned n, unsigned
    BOOST_MATH_STD_USING
    BOOST_FPU_EXCEPTION_GUARD
    T result;
-   T fudge_factor = 1 + tools::epsilon<T>() * ((N <= boost::math::prime(boost::math::max_prime - 1)) ? 50 : 2 * N);
-   unsigned base = static_cast<unsigned>((std::max)(0, (int)(n + r) - (int)(N)));
+   unsigned base = r > N - n ? r - (N - n) : 0;
    unsigned lim = (std::min)(r, n);
+   if(N > boost::math::prime(boost::math::max_prime - 1))
+      return hypergeometric_quantile_sweep_imp(p, q, r, n, N, base, lim, pol);
+   T fudge_factor = 1 + tools::epsilon<T>() * 50;
 
    BOOST_MATH_INSTRUMENT_VARIABLE(p);
    BOOST_MATH_INSTRUMENT_VARIABLE(q);
@@ -0,0 +1,73 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DETAIL_RANDOM_BITS_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DETAIL_RANDOM_BITS_HPP
+
+#include <boost/cstdint.hpp>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Returns 64 uniformly distributed random bits, assembled from as many
+// calls to the UniformRandomBitGenerator as required.  Generators whose
+// range is not a power of 2 are supported by discarding the values above
+// the largest power of 2 that fits in the range:
+//
+template <class URBG>
+boost::uint64_t random_bits_64(URBG& gen)
+{
+   boost::uint64_t range = static_cast<boost::uint64_t>((gen.max)() - (gen.min)());
+   if(range == ~static_cast<boost::uint64_t>(0))
+      return static_cast<boost::uint64_t>(gen() - (gen.min)());
+   unsigned bits_per_call = 0;
+   while((bits_per_call < 63) && (((range + 1) >> (bits_per_call + 1)) != 0))
+      ++bits_per_call;
+   boost::uint64_t mask = (static_cast<boost::uint64_t>(1) << bits_per_call) - 1;
+   boost::uint64_t result = 0;
+   for(unsigned filled = 0; filled < 64;)
+   {
+      boost::uint64_t v = static_cast<boost::uint64_t>(gen() - (gen.min)());
+      if(v > mask)
+         continue;
+      result = (result << bits_per_call) | v;
+      filled += bits_per_call;
+   }
+   return result;
+}
+
+//
+// Returns a uniformly distributed value in the open interval (0,1), that is
+// to say never exactly 0 or 1, so that the result can always be passed to log:
+//
+template <class T, class URBG>
+T uniform_01(URBG& gen)
+{
+   BOOST_MATH_STD_USING
+   int digits = tools::digits<T>();
+   if(digits <= 64)
+   {
+      //
+      // Use digits - 1 random bits and set the last bit, so the result is
+      // exactly representable and centred in its interval:
+      //
+      boost::uint64_t k = random_bits_64(gen) >> (65 - digits);
+      return static_cast<T>(2 * k + 1) * ldexp(T(1), -digits);
+   }
+   for(;;)
+   {
+      T result = 0;
+      for(int filled = 0; filled < digits; filled += 64)
+         result += static_cast<T>(random_bits_64(gen)) * ldexp(T(1), -64 - filled);
+      if((result > 0) && (result < 1))
+         return result;
+   }
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DETAIL_RANDOM_BITS_HPP
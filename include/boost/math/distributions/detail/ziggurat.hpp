@@ -0,0 +1,151 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DETAIL_ZIGGURAT_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DETAIL_ZIGGURAT_HPP
+
+#include <boost/math/distributions/detail/random_bits.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Ziggurat samplers for the standard normal and exponential distributions,
+// see "The Ziggurat Method for Generating Random Variables",
+// G. Marsaglia and W. W. Tsang, Journal of Statistical Software, 5 (2000).
+//
+// The area under the (unnormalised) density is covered by N layers of equal
+// area v: layer 0 is the rectangle [0, r] x [0, f(r)] plus the tail beyond r,
+// while layer i > 0 is the rectangle [0, x[i]] x [f(x[i]), f(x[i+1])].
+// The tables are built at the precision of T from the published values of
+// r and v, the first time they are needed.
+//
+// Since the layer index and the position within the layer can usually be
+// taken from a single 64-bit draw, almost all variates cost one call to the
+// generator, one multiply and one comparison.
+//
+template <class T>
+struct normal_ziggurat
+{
+   BOOST_STATIC_CONSTANT(unsigned, layers = 128);
+
+   normal_ziggurat()
+   {
+      BOOST_MATH_STD_USING
+      r = static_cast<T>(3.442619855899L);
+      T v = static_cast<T>(9.91256303526217e-3L);
+      f[1] = exp(-r * r / 2);
+      x[0] = v / f[1];
+      x[1] = r;
+      for(unsigned i = 1; i < layers - 1; ++i)
+      {
+         f[i + 1] = f[i] + v / x[i];
+         x[i + 1] = sqrt(-2 * log(f[i + 1]));
+      }
+      f[0] = 0;
+      f[layers] = 1;
+      x[layers] = 0;
+   }
+   static const normal_ziggurat& get()
+   {
+      static const normal_ziggurat z;
+      return z;
+   }
+
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      int digits = tools::digits<T>();
+      for(;;)
+      {
+         boost::uint64_t bits = random_bits_64(gen);
+         unsigned i = static_cast<unsigned>(bits & (layers - 1));
+         bool negative = (bits & layers) != 0;
+         T u = digits <= 56 ? T(static_cast<T>(bits >> (64 - digits)) * ldexp(T(1), -digits)) : T(uniform_01<T>(gen));
+         T z = u * x[i];
+         if(z < x[i + 1])
+            return negative ? T(-z) : z;
+         if(i == 0)
+         {
+            //
+            // Tail beyond r, Marsaglia's method:
+            //
+            T a, b;
+            do
+            {
+               a = -log(uniform_01<T>(gen)) / r;
+               b = -log(uniform_01<T>(gen));
+            } while(b + b < a * a);
+            return negative ? T(-(r + a)) : T(r + a);
+         }
+         if(f[i] + uniform_01<T>(gen) * (f[i + 1] - f[i]) < exp(-z * z / 2))
+            return negative ? T(-z) : z;
+      }
+   }
+
+   T r;
+   T x[layers + 1];
+   T f[layers + 1];
+};
+
+template <class T>
+struct exponential_ziggurat
+{
+   BOOST_STATIC_CONSTANT(unsigned, layers = 256);
+
+   exponential_ziggurat()
+   {
+      BOOST_MATH_STD_USING
+      r = static_cast<T>(7.69711747013104972L);
+      T v = static_cast<T>(3.949659822581572e-3L);
+      f[1] = exp(-r);
+      x[0] = v / f[1];
+      x[1] = r;
+      for(unsigned i = 1; i < layers - 1; ++i)
+      {
+         f[i + 1] = f[i] + v / x[i];
+         x[i + 1] = -log(f[i + 1]);
+      }
+      f[0] = 0;
+      f[layers] = 1;
+      x[layers] = 0;
+   }
+   static const exponential_ziggurat& get()
+   {
+      static const exponential_ziggurat z;
+      return z;
+   }
+
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      int digits = tools::digits<T>();
+      for(;;)
+      {
+         boost::uint64_t bits = random_bits_64(gen);
+         unsigned i = static_cast<unsigned>(bits & (layers - 1));
+         T u = digits <= 56 ? T(static_cast<T>(bits >> (64 - digits)) * ldexp(T(1), -digits)) : T(uniform_01<T>(gen));
+         T z = u * x[i];
+         if(z < x[i + 1])
+            return z;
+         if(i == 0)
+         {
+            // The tail beyond r is itself exponential:
+            return r - log(uniform_01<T>(gen));
+         }
+         if(f[i] + uniform_01<T>(gen) * (f[i + 1] - f[i]) < exp(-z))
+            return z;
+      }
+   }
+
+   T r;
+   T x[layers + 1];
+   T f[layers + 1];
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DETAIL_ZIGGURAT_HPP
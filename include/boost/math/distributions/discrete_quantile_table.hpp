@@ -0,0 +1,343 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DISCRETE_QUANTILE_TABLE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DISCRETE_QUANTILE_TABLE_HPP
+
+//
+// discrete_quantile_table<Distribution> tabulates the cdf and its complement
+// over the central region of a discrete distribution whose parameters are
+// fixed, along with a guide table (see "Non-Uniform Random Variate Generation",
+// L. Devroye, 1986, section III.2.4) that maps a probability to the first
+// table entry that could satisfy it.  Quantiles then cost O(1) comparisons
+// on average rather than a root search with many cdf evaluations, and are
+// rounded according to the distribution's discrete_quantile policy just as
+// the distribution's own quantile is.
+//
+// Probabilities which fall in the tails outside the table are forwarded to
+// the distribution's quantile, so the table never has to span the support.
+//
+
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/sampling.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <vector>
+
+namespace boost{ namespace math{
+
+template <class Distribution>
+class discrete_quantile_table
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   //
+   // The table covers the values whose cdf lies in approximately
+   // [tail, 1 - tail]:
+   //
+   explicit discrete_quantile_table(const Distribution& dist, value_type tail = value_type(1e-6f))
+      : m_dist(dist)
+   {
+      BOOST_MATH_STD_USING
+      //
+      // Probabilities no greater than the pdf at the lower end of the support
+      // have that point as their quantile, whatever the rounding:
+      //
+      m_lowest = support(m_dist).first;
+      m_pdf_lowest = pdf(m_dist, m_lowest);
+      value_type lo = floor(boost::math::quantile(m_dist, tail));
+      value_type hi = ceil(boost::math::quantile(complement(m_dist, tail)));
+      if(lo < support(m_dist).first)
+         lo = support(m_dist).first;
+      if(hi > support(m_dist).second)
+         hi = support(m_dist).second;
+      m_first = lo;
+      if(lo > support(m_dist).first)
+      {
+         m_cdf_below = cdf(m_dist, value_type(lo - 1));
+         m_ccdf_below = cdf(complement(m_dist, value_type(lo - 1)));
+      }
+      else
+      {
+         m_cdf_below = 0;
+         m_ccdf_below = 1;
+      }
+      std::size_t n = static_cast<std::size_t>(lltrunc(hi - lo, policy_type())) + 1;
+      m_cdf.reserve(n);
+      m_ccdf.reserve(n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         value_type k = lo + i;
+         m_cdf.push_back(cdf(m_dist, k));
+         m_ccdf.push_back(cdf(complement(m_dist, k)));
+      }
+      //
+      // m_guide[j] is the first entry whose cdf is at least j / n:
+      //
+      m_guide.resize(n);
+      std::size_t i = 0;
+      for(std::size_t j = 0; j < n; ++j)
+      {
+         value_type target = value_type(j) / n;
+         while((i + 1 < n) && (m_cdf[i] < target))
+            ++i;
+         m_guide[j] = i;
+      }
+   }
+
+   const Distribution& distribution()const
+   {
+      return m_dist;
+   }
+   value_type first()const
+   {
+      return m_first;
+   }
+   value_type last()const
+   {
+      return m_first + (m_cdf.size() - 1);
+   }
+
+   value_type quantile(const value_type& p)const
+   {
+      return quantile_imp(p, false, typename policy_type::discrete_quantile_type());
+   }
+   value_type quantile_complement(const value_type& q)const
+   {
+      return quantile_imp(q, true, typename policy_type::discrete_quantile_type());
+   }
+
+   //
+   // Random variate by inversion: the smallest k with cdf(k) >= u.
+   //
+   template <class URBG>
+   value_type operator()(URBG& gen)const
+   {
+      value_type u = detail::uniform_01<value_type>(gen);
+      if((u > m_cdf_below) && (u <= m_cdf.back()))
+         return m_first + first_cdf_at_least(u);
+      //
+      // In the tails, search outwards from the end of the table:
+      //
+      value_type k;
+      if(u <= m_cdf_below)
+      {
+         k = m_first - 1;
+         while((k > support(m_dist).first) && (cdf(m_dist, value_type(k - 1)) >= u))
+            k -= 1;
+      }
+      else
+      {
+         k = last() + 1;
+         while((k < support(m_dist).second) && (cdf(m_dist, k) < u))
+            k += 1;
+      }
+      return k;
+   }
+
+private:
+   //
+   // Guide table searches.  The guide gives a starting point which is exact
+   // for all but the probabilities on a bucket boundary, and we then step in
+   // whichever direction is required:
+   //
+   std::size_t guide_start(value_type p)const
+   {
+      std::size_t n = m_guide.size();
+      value_type j = p * n;
+      std::size_t index = j <= 0 ? 0 : j >= n ? n - 1 : static_cast<std::size_t>(itrunc(j, policy_type()));
+      return m_guide[index];
+   }
+   template <class Predicate>
+   std::size_t first_true(std::size_t i, Predicate pred)const
+   {
+      while((i < m_cdf.size()) && !pred(i))
+         ++i;
+      while((i > 0) && pred(i - 1))
+         --i;
+      return i;
+   }
+   struct cdf_at_least
+   {
+      const std::vector<value_type>& c; value_type p;
+      bool operator()(std::size_t i)const { return c[i] >= p; }
+   };
+   struct cdf_greater
+   {
+      const std::vector<value_type>& c; value_type p;
+      bool operator()(std::size_t i)const { return c[i] > p; }
+   };
+   struct ccdf_at_most
+   {
+      const std::vector<value_type>& c; value_type q;
+      bool operator()(std::size_t i)const { return c[i] <= q; }
+   };
+   struct ccdf_less
+   {
+      const std::vector<value_type>& c; value_type q;
+      bool operator()(std::size_t i)const { return c[i] < q; }
+   };
+   std::size_t first_cdf_at_least(value_type p)const
+   {
+      cdf_at_least pred = { m_cdf, p };
+      return first_true(guide_start(p), pred);
+   }
+   //
+   // The first index at which the cdf is >= p (or > p when strict is set),
+   // or for the complement the first index at which the ccdf is <= q (or < q):
+   //
+   std::size_t first_index(std::size_t start, value_type p, bool c, bool strict)const
+   {
+      if(c)
+      {
+         if(strict)
+         {
+            ccdf_less pred = { m_ccdf, p };
+            return first_true(start, pred);
+         }
+         ccdf_at_most pred = { m_ccdf, p };
+         return first_true(start, pred);
+      }
+      if(strict)
+      {
+         cdf_greater pred = { m_cdf, p };
+         return first_true(start, pred);
+      }
+      cdf_at_least pred = { m_cdf, p };
+      return first_true(start, pred);
+   }
+   //
+   // The smallest k with cdf(k) >= p, and the largest k with cdf(k) <= p,
+   // these correspond to rounding the (continuous) root of cdf(x) = p up or
+   // down respectively.  When p is exactly the cdf at a run of consecutive
+   // values, rounding up picks the last of them and rounding down the first,
+   // as round_to_ceil and round_to_floor do.  Both require that p lies strictly
+   // within the table:
+   //
+   value_type round_up(value_type p, bool c)const
+   {
+      std::size_t i = first_index(guide_start(c ? value_type(1 - p) : p), p, c, false);
+      if((c ? m_ccdf[i] : m_cdf[i]) == p)
+         i = first_index(i, p, c, true) - 1;
+      return m_first + i;
+   }
+   value_type round_down(value_type p, bool c)const
+   {
+      std::size_t i = first_index(guide_start(c ? value_type(1 - p) : p), p, c, true);
+      if((i > 0) && ((c ? m_ccdf[i - 1] : m_cdf[i - 1]) == p))
+         return m_first + first_index(i - 1, p, c, false);
+      return m_first + i - 1;
+   }
+   bool in_table(value_type p, bool c)const
+   {
+      return c ? (p > m_ccdf.back()) && (p < m_ccdf_below) : (p > m_cdf_below) && (p < m_cdf.back());
+   }
+   value_type fallback(value_type p, bool c)const
+   {
+      return c ? boost::math::quantile(complement(m_dist, p)) : boost::math::quantile(m_dist, p);
+   }
+
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::real>&)const
+   {
+      // No rounding, the result is not an integer and the table can't help:
+      return fallback(p, c);
+   }
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::integer_round_outwards>&)const
+   {
+      if(!in_table(p, c))
+         return fallback(p, c);
+      value_type pp = c ? 1 - p : p;
+      if(pp <= m_pdf_lowest)
+         return m_lowest;
+      return pp < 0.5f ? round_down(p, c) : round_up(p, c);
+   }
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::integer_round_inwards>&)const
+   {
+      if(!in_table(p, c))
+         return fallback(p, c);
+      value_type pp = c ? 1 - p : p;
+      if(pp <= m_pdf_lowest)
+         return m_lowest;
+      return pp < 0.5f ? round_up(p, c) : round_down(p, c);
+   }
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::integer_round_down>&)const
+   {
+      if(!in_table(p, c))
+         return fallback(p, c);
+      value_type pp = c ? 1 - p : p;
+      if(pp <= m_pdf_lowest)
+         return m_lowest;
+      return round_down(p, c);
+   }
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::integer_round_up>&)const
+   {
+      if(!in_table(p, c))
+         return fallback(p, c);
+      value_type pp = c ? 1 - p : p;
+      if(pp <= m_pdf_lowest)
+         return m_lowest;
+      return round_up(p, c);
+   }
+   value_type quantile_imp(value_type p, bool c, const policies::discrete_quantile<policies::integer_round_nearest>&)const
+   {
+      if(!in_table(p, c))
+         return fallback(p, c);
+      value_type pp = c ? 1 - p : p;
+      if(pp <= m_pdf_lowest)
+         return m_lowest;
+      //
+      // The root x of cdf(x) = p lies in [k, k+1), and rounds up
+      // when it is at or beyond the half way point:
+      //
+      value_type k = round_down(p, c);
+      value_type half = k + 0.5f;
+      bool up = c ? cdf(complement(m_dist, half)) >= p : cdf(m_dist, half) <= p;
+      return up ? value_type(k + 1) : k;
+   }
+
+   Distribution m_dist;
+   value_type m_first, m_lowest, m_pdf_lowest, m_cdf_below, m_ccdf_below;
+   std::vector<value_type> m_cdf, m_ccdf;
+   std::vector<std::size_t> m_guide;
+};
+
+template <class Distribution>
+inline typename Distribution::value_type quantile(const discrete_quantile_table<Distribution>& t, const typename Distribution::value_type& p)
+{
+   return t.quantile(p);
+}
+
+template <class Distribution>
+inline typename Distribution::value_type quantile(const complemented2_type<discrete_quantile_table<Distribution>, typename Distribution::value_type>& c)
+{
+   return c.dist.quantile_complement(c.param);
+}
+
+template <class Distribution>
+class sampler<discrete_quantile_table<Distribution> >
+{
+public:
+   typedef discrete_quantile_table<Distribution> distribution_type;
+   typedef typename Distribution::value_type result_type;
+
+   explicit sampler(const distribution_type& table) : m_table(&table) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return (*m_table)(gen);
+   }
+private:
+   // The table is expensive to copy, so the sampler refers to it:
+   const distribution_type* m_table;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DISCRETE_QUANTILE_TABLE_HPP
@@ -67,7 +67,7 @@ namespace boost { namespace math {
       }
       bool check_x(unsigned x, const char* function, RealType* result)const
       {
-         if(x < static_cast<unsigned>((std::max)(0, (int)(m_n + m_r) - (int)(m_N))))
+         if(x < (m_r > m_N - m_n ? m_r - (m_N - m_n) : 0))
          {
             *result = boost::math::policies::raise_domain_error<RealType>(
                function, "Random variable out of range: must be > 0 and > m + r - N but got %1%", static_cast<RealType>(x), Policy());
@@ -102,7 +102,7 @@ namespace boost { namespace math {
       unsigned r = dist.defective();
       unsigned n = dist.sample_count();
       unsigned N = dist.total();
-      unsigned l = static_cast<unsigned>((std::max)(0, (int)(n + r) - (int)(N)));
+      unsigned l = r > N - n ? r - (N - n) : 0;
       unsigned u = (std::min)(r, n);
       return std::pair<unsigned, unsigned>(l, u);
 #ifdef BOOST_MSVC
@@ -234,7 +234,7 @@ namespace boost { namespace math {
    template <class RealType, class Policy>
    inline RealType mean(const hypergeometric_distribution<RealType, Policy>& dist)
    {
-      return static_cast<RealType>(dist.defective() * dist.sample_count()) / dist.total();
+      return static_cast<RealType>(dist.defective()) * static_cast<RealType>(dist.sample_count()) / dist.total();
    } // RealType mean(const hypergeometric_distribution<RealType, Policy>& dist)
 
    template <class RealType, class Policy>
@@ -28,10 +28,58 @@ namespace boost
       template <class RealType, class Policy>
       class non_central_beta_distribution;
 
+      template <class RealType, class Policy>
+      class frozen_non_central_beta_distribution;
+
       namespace detail{
 
+         //
+         // Starting points and Poisson weights for the series below, these
+         // depend only on the distribution parameters, so can be computed
+         // once and reused when the same distribution is evaluated many times:
+         //
+         template <class T>
+         struct nc_beta_series_seeds
+         {
+            int k_p;       // Starting index for non_central_beta_p.
+            T pois_p;      // Poisson weight at k_p.
+            int k_q;       // Starting index for non_central_beta_q.
+            T pois_q;      // Poisson weight at k_q.
+            int k_pdf;     // Starting index for non_central_beta_pdf.
+            T pois_pdf;    // Poisson weight at k_pdf.
+         };
+
+         template <class T, class Policy>
+         nc_beta_series_seeds<T> make_nc_beta_series_seeds(T a, T b, T lam, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            nc_beta_series_seeds<T> seeds;
+            T l2 = lam / 2;
+            int k = itrunc(l2);
+            // These must follow the choices made in the series themselves:
+            seeds.k_p = k == 0 ? 1 : k;
+            seeds.pois_p = gamma_p_derivative(T(seeds.k_p + 1), l2, pol);
+            seeds.k_q = k;
+            if(k <= 30)
+            {
+               if(a + b > 1)
+                  seeds.k_q = 0;
+               else if(k == 0)
+                  seeds.k_q = 1;
+            }
+            if(seeds.k_q == 0)
+               seeds.pois_q = exp(-l2);
+            else if(seeds.k_q == seeds.k_p)
+               seeds.pois_q = seeds.pois_p;
+            else
+               seeds.pois_q = gamma_p_derivative(T(seeds.k_q + 1), l2, pol);
+            seeds.k_pdf = k;
+            seeds.pois_pdf = k == seeds.k_p ? seeds.pois_p : gamma_p_derivative(T(k + 1), l2, pol);
+            return seeds;
+         }
+
          template <class T, class Policy>
-         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, const nc_beta_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
                using namespace boost::math;
@@ -52,7 +100,7 @@ namespace boost
             if(k == 0)
                k = 1;
                // Starting Poisson weight:
-            T pois = gamma_p_derivative(T(k+1), l2, pol);
+            T pois = seeds ? seeds->pois_p : gamma_p_derivative(T(k+1), l2, pol);
             if(pois == 0)
                return init_val;
             // recurance term:
@@ -112,7 +160,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, const nc_beta_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
                using namespace boost::math;
@@ -138,7 +186,11 @@ namespace boost
                else if(k == 0)
                   k = 1;
             }
-            if(k == 0)
+            if(seeds)
+            {
+               pois = seeds->pois_q;
+            }
+            else if(k == 0)
             {
                // Starting Poisson weight:
                pois = exp(-l2);
@@ -212,7 +264,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&)
+         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&,
+            const nc_beta_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -243,7 +296,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  seeds);
                invert = !invert;
             }
             else
@@ -255,7 +309,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             if(invert)
                result = -result;
@@ -264,10 +319,10 @@ namespace boost
                "boost::math::non_central_beta_cdf<%1%>(%1%, %1%, %1%)");
          }
 
-         template <class T, class Policy>
+         template <class T, class Policy, class Dist = non_central_beta_distribution<T, Policy> >
          struct nc_beta_quantile_functor
          {
-            nc_beta_quantile_functor(const non_central_beta_distribution<T,Policy>& d, T t, bool c)
+            nc_beta_quantile_functor(const Dist& d, T t, bool c)
                : dist(d), target(t), comp(c) {}
 
             T operator()(const T& x)
@@ -278,7 +333,7 @@ namespace boost
             }
 
          private:
-            non_central_beta_distribution<T,Policy> dist;
+            Dist dist;
             T target;
             bool comp;
          };
@@ -390,7 +445,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         RealType nc_beta_quantile(const non_central_beta_distribution<RealType, Policy>& dist, const RealType& p, bool comp)
+         RealType nc_beta_quantile(const non_central_beta_distribution<RealType, Policy>& dist, const RealType& p, bool comp,
+            const nc_beta_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             static const char* function = "quantile(non_central_beta_distribution<%1%>, %1%)";
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
@@ -486,15 +542,32 @@ namespace boost
                guess = mean;
             */
             value_type guess = mean;
-            detail::nc_beta_quantile_functor<value_type, Policy>
-               f(non_central_beta_distribution<value_type, Policy>(a, b, l), p, comp);
             tools::eps_tolerance<value_type> tol(policies::digits<RealType, Policy>());
             boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
 
-            std::pair<value_type, value_type> ir
-               = bracket_and_solve_root_01(
+            std::pair<value_type, value_type> ir;
+            if(seeds)
+            {
+               //
+               // Freeze the Poisson weights once, and reuse them for every
+               // cdf evaluation made by the root finder.  The functor's
+               // distribution may evaluate at a wider precision than
+               // value_type, so let it compute its own seeds:
+               //
+               detail::nc_beta_quantile_functor<value_type, Policy, frozen_non_central_beta_distribution<value_type, Policy> >
+                  f(frozen_non_central_beta_distribution<value_type, Policy>(a, b, l), p, comp);
+               ir = bracket_and_solve_root_01(
+                  f, guess, value_type(2.5), true, tol,
+                  max_iter, Policy());
+            }
+            else
+            {
+               detail::nc_beta_quantile_functor<value_type, Policy>
+                  f(non_central_beta_distribution<value_type, Policy>(a, b, l), p, comp);
+               ir = bracket_and_solve_root_01(
                   f, guess, value_type(2.5), true, tol,
                   max_iter, Policy());
+            }
             value_type result = ir.first + (ir.second - ir.first) / 2;
 
             if(max_iter >= policies::get_max_root_iterations<Policy>())
@@ -512,7 +585,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_beta_pdf(T a, T b, T lam, T x, T y, const Policy& pol)
+         T non_central_beta_pdf(T a, T b, T lam, T x, T y, const Policy& pol, const nc_beta_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -532,7 +605,7 @@ namespace boost
             //
             int k = itrunc(l2);
             // Starting Poisson weight:
-            T pois = gamma_p_derivative(T(k+1), l2, pol);
+            T pois = seeds ? seeds->pois_pdf : gamma_p_derivative(T(k+1), l2, pol);
             // Starting beta term:
             T beta = x < y ?
                ibeta_derivative(a + k, b, x, pol)
@@ -579,7 +652,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         RealType nc_beta_pdf(const non_central_beta_distribution<RealType, Policy>& dist, const RealType& x)
+         RealType nc_beta_pdf(const non_central_beta_distribution<RealType, Policy>& dist, const RealType& x,
+            const nc_beta_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             static const char* function = "pdf(non_central_beta_distribution<%1%>, %1%)";
@@ -619,7 +693,7 @@ namespace boost
             if(l == 0)
                return pdf(boost::math::beta_distribution<RealType, Policy>(dist.alpha(), dist.beta()), x);
             return policies::checked_narrowing_cast<RealType, forwarding_policy>(
-               non_central_beta_pdf(a, b, l, static_cast<value_type>(x), value_type(1 - static_cast<value_type>(x)), forwarding_policy()),
+               non_central_beta_pdf(a, b, l, static_cast<value_type>(x), value_type(1 - static_cast<value_type>(x)), forwarding_policy(), seeds),
                "function");
          }
 
@@ -917,6 +991,148 @@ namespace boost
          return detail::nc_beta_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // A non-central beta distribution whose Poisson weighting terms are
+      // computed once at construction and reused by every subsequent call to
+      // pdf, cdf and quantile - including each cdf evaluation made by the
+      // quantile root finder.  Results are identical to those of
+      // non_central_beta_distribution.
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class frozen_non_central_beta_distribution : public non_central_beta_distribution<RealType, Policy>
+      {
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef detail::nc_beta_series_seeds<eval_type> seeds_type;
+
+         frozen_non_central_beta_distribution(RealType a_, RealType b_, RealType lambda)
+            : non_central_beta_distribution<RealType, Policy>(a_, b_, lambda),
+              seeds(detail::make_nc_beta_series_seeds(static_cast<eval_type>(a_), static_cast<eval_type>(b_), static_cast<eval_type>(lambda), forwarding_policy()))
+         {
+         }
+         frozen_non_central_beta_distribution(RealType a_, RealType b_, RealType lambda, const seeds_type& s)
+            : non_central_beta_distribution<RealType, Policy>(a_, b_, lambda), seeds(s)
+         {
+         }
+
+         const seeds_type& series_seeds() const
+         {
+            return seeds;
+         }
+      private:
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         seeds_type seeds; // Starting Poisson weights for the series.
+      }; // template <class RealType, class Policy> class frozen_non_central_beta_distribution
+
+      typedef frozen_non_central_beta_distribution<double> frozen_non_central_beta; // Reserved name of type double.
+
+      // Most non-member functions are found via the base class, but variance
+      // must be given explicitly, or the generic version in derived_accessors.hpp
+      // would be a better match:
+      template <class RealType, class Policy>
+      inline RealType variance(const frozen_non_central_beta_distribution<RealType, Policy>& dist)
+      {
+         return variance(static_cast<const non_central_beta_distribution<RealType, Policy>&>(dist));
+      }
+
+      template <class RealType, class Policy>
+      inline RealType pdf(const frozen_non_central_beta_distribution<RealType, Policy>& dist, const RealType& x)
+      { // Probability Density/Mass Function.
+         return detail::nc_beta_pdf(dist, x, &dist.series_seeds());
+      } // pdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const frozen_non_central_beta_distribution<RealType, Policy>& dist, const RealType& x)
+      {
+         const char* function = "boost::math::non_central_beta_distribution<%1%>::cdf(%1%)";
+            RealType a = dist.alpha();
+            RealType b = dist.beta();
+            RealType l = dist.non_centrality();
+            RealType r;
+            if(!beta_detail::check_alpha(
+               function,
+               a, &r, Policy())
+               ||
+            !beta_detail::check_beta(
+               function,
+               b, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !beta_detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+
+         if(l == 0)
+            return cdf(beta_distribution<RealType, Policy>(a, b), x);
+
+         return detail::non_central_beta_cdf(x, RealType(1 - x), a, b, l, false, Policy(), &dist.series_seeds());
+      } // cdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const complemented2_type<frozen_non_central_beta_distribution<RealType, Policy>, RealType>& c)
+      { // Complemented Cumulative Distribution Function
+         const char* function = "boost::math::non_central_beta_distribution<%1%>::cdf(%1%)";
+         frozen_non_central_beta_distribution<RealType, Policy> const& dist = c.dist;
+            RealType a = dist.alpha();
+            RealType b = dist.beta();
+            RealType l = dist.non_centrality();
+            RealType x = c.param;
+            RealType r;
+            if(!beta_detail::check_alpha(
+               function,
+               a, &r, Policy())
+               ||
+            !beta_detail::check_beta(
+               function,
+               b, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !beta_detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+
+         if(l == 0)
+            return cdf(complement(beta_distribution<RealType, Policy>(a, b), x));
+
+         return detail::non_central_beta_cdf(x, RealType(1 - x), a, b, l, true, Policy(), &dist.series_seeds());
+      } // ccdf
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const frozen_non_central_beta_distribution<RealType, Policy>& dist, const RealType& p)
+      { // Quantile (or Percent Point) function.
+         return detail::nc_beta_quantile(dist, p, false, &dist.series_seeds());
+      } // quantile
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const complemented2_type<frozen_non_central_beta_distribution<RealType, Policy>, RealType>& c)
+      { // Quantile (or Percent Point) function.
+         return detail::nc_beta_quantile(c.dist, c.param, true, &c.dist.series_seeds());
+      } // quantile complement.
+
    } // namespace math
 } // namespace boost
 
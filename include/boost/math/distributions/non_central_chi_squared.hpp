@@ -30,10 +30,43 @@ namespace boost
       template <class RealType, class Policy>
       class non_central_chi_squared_distribution;
 
+      template <class RealType, class Policy>
+      class frozen_non_central_chi_squared_distribution;
+
       namespace detail{
 
+         //
+         // The Poisson weights used by the series below depend only on the
+         // non-centrality parameter, so when the same distribution is
+         // evaluated repeatedly (see frozen_non_central_chi_squared_distribution)
+         // we compute the starting weights once and pass them in here:
+         //
+         template <class T>
+         struct nccs_series_seeds
+         {
+            int k;         // Starting index for the cdf series: iround(theta / 2).
+            T pois;        // Poisson weight at k.
+            int k_pdf;     // Starting index for the pdf series: itrunc(theta / 2).
+            T pois_pdf;    // Poisson weight at k_pdf.
+            T pois0;       // Poisson weight at zero, used by Ding's method.
+         };
+
          template <class T, class Policy>
-         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         nccs_series_seeds<T> make_nccs_series_seeds(T theta, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            nccs_series_seeds<T> seeds;
+            T lambda = theta / 2;
+            seeds.k = iround(lambda, pol);
+            seeds.pois = boost::math::gamma_p_derivative(static_cast<T>(1 + seeds.k), lambda, pol);
+            seeds.k_pdf = itrunc(lambda);
+            seeds.pois_pdf = seeds.k_pdf == seeds.k ? seeds.pois : boost::math::gamma_p_derivative(static_cast<T>(1 + seeds.k_pdf), lambda, pol);
+            seeds.pois0 = exp(-lambda);
+            return seeds;
+         }
+
+         template <class T, class Policy>
+         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0, const nccs_series_seeds<T>* seeds = 0)
          {
             //
             // Computes the complement of the Non-Central Chi-Square
@@ -71,15 +104,17 @@ namespace boost
             // k is chosen as the peek of the Poisson weights, which
             // will occur *before* the largest term.
             //
-            int k = iround(lambda, pol);
+            int k = seeds ? seeds->k : iround(lambda, pol);
             // Forwards and backwards Poisson weights:
-            T poisf = boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
+            T poisf = seeds ? seeds->pois : boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
             T poisb = poisf * k / lambda;
-            // Initial forwards central chi squared term:
-            T gamf = boost::math::gamma_q(del + k, y, pol);
-            // Forwards and backwards recursion terms on the central chi squared:
-            T xtermf = boost::math::gamma_p_derivative(del + 1 + k, y, pol);
-            T xtermb = xtermf * (del + k) / y;
+            // Initial forwards central chi squared term, the forwards and
+            // backwards recursion terms on the central chi squared are
+            // obtained as a by-product of the same calculation:
+            T xtermf;
+            T gamf = boost::math::detail::gamma_incomplete_imp(static_cast<T>(del + k), y, true, true, pol, &xtermf);
+            T xtermb = xtermf;
+            xtermf *= y / (del + k);
             // Initial backwards central chi squared term:
             T gamb = gamf - xtermb;
 
@@ -128,7 +163,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0, const nccs_series_seeds<T>* seeds = 0)
          {
             //
             // This is an implementation of:
@@ -151,7 +186,7 @@ namespace boost
                return 0;
             T tk = boost::math::gamma_p_derivative(f/2 + 1, x/2, pol);
             T lambda = theta / 2;
-            T vk = exp(-lambda);
+            T vk = seeds ? seeds->pois0 : exp(-lambda);
             T uk = vk;
             T sum = init_sum + tk * vk;
             if(sum == 0)
@@ -183,7 +218,7 @@ namespace boost
 
 
          template <class T, class Policy>
-         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum)
+         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum, const nccs_series_seeds<T>* seeds = 0)
          {
             //
             // This is taken more or less directly from:
@@ -215,21 +250,21 @@ namespace boost
             // function, which ocurrs *after* the largest term in the
             // sum.
             //
-            int k = iround(del, pol);
+            int k = seeds ? seeds->k : iround(del, pol);
             T a = n / 2 + k;
-            // Central chi squared term for forward iteration:
-            T gamkf = boost::math::gamma_p(a, x, pol);
+            // Central chi squared term for forward iteration, plus
+            // the forwards gamma function recursion term:
+            T xtermf;
+            T gamkf = boost::math::detail::gamma_incomplete_imp(a, x, true, false, pol, &xtermf);
 
             if(lambda == 0)
                return gamkf;
             // Central chi squared term for backward iteration:
             T gamkb = gamkf;
             // Forwards Poisson weight:
-            T poiskf = gamma_p_derivative(static_cast<T>(k+1), del, pol);
+            T poiskf = seeds ? seeds->pois : gamma_p_derivative(static_cast<T>(k+1), del, pol);
             // Backwards Poisson weight:
             T poiskb = poiskf;
-            // Forwards gamma function recursion term:
-            T xtermf = boost::math::gamma_p_derivative(a, x, pol);
             // Backwards gamma function recursion term:
             T xtermb = xtermf * x / a;
             T sum = init_sum + poiskf * gamkf;
@@ -282,7 +317,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_chi_square_pdf(T x, T n, T lambda, const Policy& pol)
+         T non_central_chi_square_pdf(T x, T n, T lambda, const Policy& pol, const nccs_series_seeds<T>* seeds = 0)
          {
             //
             // As above but for the PDF:
@@ -294,8 +329,8 @@ namespace boost
             T n2 = n / 2;
             T l2 = lambda / 2;
             T sum = 0;
-            int k = itrunc(l2);
-            T pois = gamma_p_derivative(static_cast<T>(k + 1), l2, pol) * gamma_p_derivative(static_cast<T>(n2 + k), x2);
+            int k = seeds ? seeds->k_pdf : itrunc(l2);
+            T pois = (seeds ? seeds->pois_pdf : gamma_p_derivative(static_cast<T>(k + 1), l2, pol)) * gamma_p_derivative(static_cast<T>(n2 + k), x2);
             if(pois == 0)
                return 0;
             T poisb = pois;
@@ -321,7 +356,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&)
+         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&,
+            const nccs_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -343,7 +379,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  seeds);
                invert = !invert;
             }
             else if(l < 200)
@@ -355,7 +392,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             else
             {
@@ -369,7 +407,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             if(invert)
                result = -result;
@@ -398,7 +437,8 @@ namespace boost
          };
 
          template <class RealType, class Policy>
-         RealType nccs_quantile(const non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& p, bool comp)
+         RealType nccs_quantile(const non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& p, bool comp,
+            const nccs_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             static const char* function = "quantile(non_central_chi_squared_distribution<%1%>, %1%)";
@@ -476,12 +516,23 @@ namespace boost
                if(guess == 0)
                   guess = tools::min_value<value_type>();
             }
-            value_type result = detail::generic_quantile(
-               non_central_chi_squared_distribution<value_type, forwarding_policy>(k, l),
-               p,
-               guess,
-               comp,
-               function);
+            //
+            // When the Poisson weights have been precomputed, reuse them for
+            // every cdf evaluation made by the root finder:
+            //
+            value_type result = seeds ?
+               detail::generic_quantile(
+                  frozen_non_central_chi_squared_distribution<value_type, forwarding_policy>(k, l, *seeds),
+                  p,
+                  guess,
+                  comp,
+                  function)
+               : detail::generic_quantile(
+                  non_central_chi_squared_distribution<value_type, forwarding_policy>(k, l),
+                  p,
+                  guess,
+                  comp,
+                  function);
 
             return policies::checked_narrowing_cast<RealType, forwarding_policy>(
                result,
@@ -489,7 +540,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         RealType nccs_pdf(const non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& x)
+         RealType nccs_pdf(const non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& x,
+            const nccs_series_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             static const char* function = "pdf(non_central_chi_squared_distribution<%1%>, %1%)";
@@ -529,14 +581,14 @@ namespace boost
             return 0;
          if(l > 50)
          {
-            r = non_central_chi_square_pdf(static_cast<value_type>(x), k, l, forwarding_policy());
+            r = non_central_chi_square_pdf(static_cast<value_type>(x), k, l, forwarding_policy(), seeds);
          }
          else
          {
             r = log(x / l) * (k / 4 - 0.5f) - (x + l) / 2;
             if(fabs(r) >= tools::log_max_value<RealType>() / 4)
             {
-               r = non_central_chi_square_pdf(static_cast<value_type>(x), k, l, forwarding_policy());
+               r = non_central_chi_square_pdf(static_cast<value_type>(x), k, l, forwarding_policy(), seeds);
             }
             else
             {
@@ -985,6 +1037,133 @@ namespace boost
          return detail::nccs_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // A non-central chi squared distribution whose Poisson weighting terms are
+      // computed once at construction and reused by every subsequent call to
+      // pdf, cdf and quantile - including each cdf evaluation made by the
+      // quantile root finder.  Results are identical to those of
+      // non_central_chi_squared_distribution, only the per-call cost is reduced,
+      // so use this when a single distribution is evaluated at many points.
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class frozen_non_central_chi_squared_distribution : public non_central_chi_squared_distribution<RealType, Policy>
+      {
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef detail::nccs_series_seeds<eval_type> seeds_type;
+
+         frozen_non_central_chi_squared_distribution(RealType df_, RealType lambda)
+            : non_central_chi_squared_distribution<RealType, Policy>(df_, lambda),
+              seeds(detail::make_nccs_series_seeds(static_cast<eval_type>(lambda), forwarding_policy()))
+         {
+         }
+         frozen_non_central_chi_squared_distribution(RealType df_, RealType lambda, const seeds_type& s)
+            : non_central_chi_squared_distribution<RealType, Policy>(df_, lambda), seeds(s)
+         {
+         }
+
+         const seeds_type& series_seeds() const
+         {
+            return seeds;
+         }
+      private:
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         seeds_type seeds; // Starting Poisson weights for the series.
+      }; // template <class RealType, class Policy> class frozen_non_central_chi_squared_distribution
+
+      typedef frozen_non_central_chi_squared_distribution<double> frozen_non_central_chi_squared; // Reserved name of type double.
+
+      // Most non-member functions are found via the base class, but variance
+      // must be given explicitly, or the generic version in derived_accessors.hpp
+      // would be a better match:
+      template <class RealType, class Policy>
+      inline RealType variance(const frozen_non_central_chi_squared_distribution<RealType, Policy>& dist)
+      {
+         return variance(static_cast<const non_central_chi_squared_distribution<RealType, Policy>&>(dist));
+      }
+
+      template <class RealType, class Policy>
+      inline RealType pdf(const frozen_non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& x)
+      { // Probability Density/Mass Function.
+         return detail::nccs_pdf(dist, x, &dist.series_seeds());
+      } // pdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const frozen_non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& x)
+      {
+         const char* function = "boost::math::non_central_chi_squared_distribution<%1%>::cdf(%1%)";
+         RealType k = dist.degrees_of_freedom();
+         RealType l = dist.non_centrality();
+         RealType r;
+         if(!detail::check_df(
+            function,
+            k, &r, Policy())
+            ||
+         !detail::check_non_centrality(
+            function,
+            l,
+            &r,
+            Policy())
+            ||
+         !detail::check_positive_x(
+            function,
+            x,
+            &r,
+            Policy()))
+               return r;
+
+         return detail::non_central_chi_squared_cdf(x, k, l, false, Policy(), &dist.series_seeds());
+      } // cdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const complemented2_type<frozen_non_central_chi_squared_distribution<RealType, Policy>, RealType>& c)
+      { // Complemented Cumulative Distribution Function
+         const char* function = "boost::math::non_central_chi_squared_distribution<%1%>::cdf(%1%)";
+         frozen_non_central_chi_squared_distribution<RealType, Policy> const& dist = c.dist;
+         RealType x = c.param;
+         RealType k = dist.degrees_of_freedom();
+         RealType l = dist.non_centrality();
+         RealType r;
+         if(!detail::check_df(
+            function,
+            k, &r, Policy())
+            ||
+         !detail::check_non_centrality(
+            function,
+            l,
+            &r,
+            Policy())
+            ||
+         !detail::check_positive_x(
+            function,
+            x,
+            &r,
+            Policy()))
+               return r;
+
+         return detail::non_central_chi_squared_cdf(x, k, l, true, Policy(), &dist.series_seeds());
+      } // ccdf
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const frozen_non_central_chi_squared_distribution<RealType, Policy>& dist, const RealType& p)
+      { // Quantile (or Percent Point) function.
+         return detail::nccs_quantile(dist, p, false, &dist.series_seeds());
+      } // quantile
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const complemented2_type<frozen_non_central_chi_squared_distribution<RealType, Policy>, RealType>& c)
+      { // Quantile (or Percent Point) function.
+         return detail::nccs_quantile(c.dist, c.param, true, &c.dist.series_seeds());
+      } // quantile complement.
+
    } // namespace math
 } // namespace boost
 
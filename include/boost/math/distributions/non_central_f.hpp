@@ -396,6 +396,172 @@ namespace boost
          return (x / (1 - x)) * (c.dist.degrees_of_freedom2() / c.dist.degrees_of_freedom1());
       } // quantile complement.
 
+      //
+      // A non-central F distribution whose Poisson weighting terms are computed
+      // once at construction and reused by every subsequent call to pdf, cdf
+      // and quantile, see frozen_non_central_beta_distribution.
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class frozen_non_central_f_distribution : public non_central_f_distribution<RealType, Policy>
+      {
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef detail::nc_beta_series_seeds<eval_type> seeds_type;
+
+         frozen_non_central_f_distribution(RealType v1_, RealType v2_, RealType lambda)
+            : non_central_f_distribution<RealType, Policy>(v1_, v2_, lambda),
+              seeds(detail::make_nc_beta_series_seeds(static_cast<eval_type>(v1_ / 2), static_cast<eval_type>(v2_ / 2), static_cast<eval_type>(lambda), forwarding_policy()))
+         {
+         }
+
+         const seeds_type& series_seeds() const
+         {
+            return seeds;
+         }
+      private:
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         seeds_type seeds; // Starting Poisson weights for the underlying non-central beta series.
+      }; // template <class RealType, class Policy> class frozen_non_central_f_distribution
+
+      typedef frozen_non_central_f_distribution<double> frozen_non_central_f; // Reserved name of type double.
+
+      // Most non-member functions are found via the base class, but variance
+      // must be given explicitly, or the generic version in derived_accessors.hpp
+      // would be a better match:
+      template <class RealType, class Policy>
+      inline RealType variance(const frozen_non_central_f_distribution<RealType, Policy>& dist)
+      {
+         return variance(static_cast<const non_central_f_distribution<RealType, Policy>&>(dist));
+      }
+
+      template <class RealType, class Policy>
+      inline RealType pdf(const frozen_non_central_f_distribution<RealType, Policy>& dist, const RealType& x)
+      { // Probability Density/Mass Function.
+         typedef typename policies::evaluation<RealType, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         value_type alpha = dist.degrees_of_freedom1() / 2;
+         value_type beta = dist.degrees_of_freedom2() / 2;
+         value_type y = x * alpha / beta;
+         value_type r = pdf(boost::math::frozen_non_central_beta_distribution<value_type, forwarding_policy>(alpha, beta, dist.non_centrality(), dist.series_seeds()), y / (1 + y));
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+            r * (dist.degrees_of_freedom1() / dist.degrees_of_freedom2()) / ((1 + y) * (1 + y)),
+            "pdf(non_central_f_distribution<%1%>, %1%)");
+      } // pdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const frozen_non_central_f_distribution<RealType, Policy>& dist, const RealType& x)
+      {
+         const char* function = "cdf(const non_central_f_distribution<%1%>&, %1%)";
+         RealType r;
+         if(!detail::check_df(
+            function,
+            dist.degrees_of_freedom1(), &r, Policy())
+               ||
+            !detail::check_df(
+               function,
+               dist.degrees_of_freedom2(), &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               dist.non_centrality(),
+               &r,
+               Policy()))
+               return r;
+
+         if((x < 0) || !(boost::math::isfinite)(x))
+         {
+            return policies::raise_domain_error<RealType>(
+               function, "Random Variable parameter was %1%, but must be > 0 !", x, Policy());
+         }
+
+         RealType alpha = dist.degrees_of_freedom1() / 2;
+         RealType beta = dist.degrees_of_freedom2() / 2;
+         RealType y = x * alpha / beta;
+         RealType c = y / (1 + y);
+         RealType cp = 1 / (1 + y);
+         r = detail::non_central_beta_cdf(c, cp, alpha, beta,
+            dist.non_centrality(), false, Policy(), &dist.series_seeds());
+         return r;
+      } // cdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const complemented2_type<frozen_non_central_f_distribution<RealType, Policy>, RealType>& c)
+      { // Complemented Cumulative Distribution Function
+         const char* function = "cdf(complement(const non_central_f_distribution<%1%>&, %1%))";
+         RealType r;
+         if(!detail::check_df(
+            function,
+            c.dist.degrees_of_freedom1(), &r, Policy())
+               ||
+            !detail::check_df(
+               function,
+               c.dist.degrees_of_freedom2(), &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               c.dist.non_centrality(),
+               &r,
+               Policy()))
+               return r;
+
+         if((c.param < 0) || !(boost::math::isfinite)(c.param))
+         {
+            return policies::raise_domain_error<RealType>(
+               function, "Random Variable parameter was %1%, but must be > 0 !", c.param, Policy());
+         }
+
+         RealType alpha = c.dist.degrees_of_freedom1() / 2;
+         RealType beta = c.dist.degrees_of_freedom2() / 2;
+         RealType y = c.param * alpha / beta;
+         RealType x = y / (1 + y);
+         RealType cx = 1 / (1 + y);
+         r = detail::non_central_beta_cdf(x, cx, alpha, beta,
+            c.dist.non_centrality(), true, Policy(), &c.dist.series_seeds());
+         return r;
+      } // ccdf
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const frozen_non_central_f_distribution<RealType, Policy>& dist, const RealType& p)
+      { // Quantile (or Percent Point) function.
+         RealType alpha = dist.degrees_of_freedom1() / 2;
+         RealType beta = dist.degrees_of_freedom2() / 2;
+         RealType x = quantile(boost::math::frozen_non_central_beta_distribution<RealType, Policy>(alpha, beta, dist.non_centrality(), dist.series_seeds()), p);
+         if(x == 1)
+            return policies::raise_overflow_error<RealType>(
+               "quantile(const non_central_f_distribution<%1%>&, %1%)",
+               "Result of non central F quantile is too large to represent.",
+               Policy());
+         return (x / (1 - x)) * (dist.degrees_of_freedom2() / dist.degrees_of_freedom1());
+      } // quantile
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const complemented2_type<frozen_non_central_f_distribution<RealType, Policy>, RealType>& c)
+      { // Quantile (or Percent Point) function.
+         RealType alpha = c.dist.degrees_of_freedom1() / 2;
+         RealType beta = c.dist.degrees_of_freedom2() / 2;
+         RealType x = quantile(complement(boost::math::frozen_non_central_beta_distribution<RealType, Policy>(alpha, beta, c.dist.non_centrality(), c.dist.series_seeds()), c.param));
+         if(x == 1)
+            return policies::raise_overflow_error<RealType>(
+               "quantile(complement(const non_central_f_distribution<%1%>&, %1%))",
+               "Result of non central F quantile is too large to represent.",
+               Policy());
+         return (x / (1 - x)) * (c.dist.degrees_of_freedom2() / c.dist.degrees_of_freedom1());
+      } // quantile complement.
+
    } // namespace math
 } // namespace boost
 
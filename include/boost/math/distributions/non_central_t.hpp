@@ -24,10 +24,60 @@ namespace boost
       template <class RealType, class Policy>
       class non_central_t_distribution;
 
+      template <class RealType, class Policy>
+      class frozen_non_central_t_distribution;
+
       namespace detail{
 
+         //
+         // Terms of the cdf series below which depend only on the distribution
+         // parameters, precomputed by frozen_non_central_t_distribution:
+         //
+         template <class T>
+         struct nc_t_series_seeds
+         {
+            nc_beta_series_seeds<T> beta; // For the non-central beta with a = 1/2, b = v/2 and lambda = delta^2.
+            T pois_p;         // Starting weight for non_central_t2_p, excluding the factor delta / sqrt(2).
+            T pois_q;         // Starting weight for non_central_t2_q, excluding the factor delta / sqrt(2).
+            T delta;          // Non-centrality at which the following were computed:
+            T norm_cdf_neg;   // cdf(normal_distribution(), -delta).
+            T norm_cdf_pos;   // cdf(normal_distribution(), delta).
+         };
+
          template <class T, class Policy>
-         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         bool non_central_t2_q_use_reduced_weight(int k, T d2)
+         {
+            BOOST_MATH_STD_USING
+            return (k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>());
+         }
+
+         template <class T, class Policy>
+         nc_t_series_seeds<T> make_nc_t_series_seeds(T v, T delta, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            nc_t_series_seeds<T> seeds;
+            seeds.beta = make_nc_beta_series_seeds(T(0.5f), T(v / 2), T(delta * delta), pol);
+            T d2 = delta * delta / 2;
+            int k = itrunc(d2);
+            if(k == 0) k = 1;
+            seeds.pois_p = gamma_p_derivative(T(k+1), d2, pol)
+               * tgamma_delta_ratio(T(k + 1), T(0.5f));
+            if(non_central_t2_q_use_reduced_weight<T, Policy>(k, d2))
+            {
+               seeds.pois_q = exp(-d2);
+               seeds.pois_q *= pow(d2, static_cast<T>(k));
+               seeds.pois_q /= boost::math::tgamma(T(k + 1 + 0.5), pol);
+            }
+            else
+               seeds.pois_q = seeds.pois_p;
+            seeds.delta = delta;
+            seeds.norm_cdf_neg = cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+            seeds.norm_cdf_pos = cdf(boost::math::normal_distribution<T, Policy>(), delta);
+            return seeds;
+         }
+
+         template <class T, class Policy>
+         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val, const nc_t_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -47,8 +97,8 @@ namespace boost
             T pois;
             if(k == 0) k = 1;
             // Starting Poisson weight:
-            pois = gamma_p_derivative(T(k+1), d2, pol) 
-               * tgamma_delta_ratio(T(k + 1), T(0.5f))
+            pois = (seeds ? seeds->pois_p : gamma_p_derivative(T(k+1), d2, pol) 
+               * tgamma_delta_ratio(T(k + 1), T(0.5f)))
                * delta / constants::root_two<T>();
             if(pois == 0)
                return init_val;
@@ -105,7 +155,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val, const nc_t_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -125,21 +175,26 @@ namespace boost
             if(k == 0) k = 1;
             // Starting Poisson weight:
             T pois;
-            if((k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>()))
+            if(non_central_t2_q_use_reduced_weight<T, Policy>(k, d2))
             {
                //
                // For small k we can optimise this calculation by using
                // a simpler reduced formula:
                //
-               pois = exp(-d2);
-               pois *= pow(d2, static_cast<T>(k));
-               pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
+               if(seeds)
+                  pois = seeds->pois_q;
+               else
+               {
+                  pois = exp(-d2);
+                  pois *= pow(d2, static_cast<T>(k));
+                  pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
+               }
                pois *= delta / constants::root_two<T>();
             }
             else
             {
-               pois = gamma_p_derivative(T(k+1), d2, pol) 
-                  * tgamma_delta_ratio(T(k + 1), T(0.5f))
+               pois = (seeds ? seeds->pois_q : gamma_p_derivative(T(k+1), d2, pol) 
+                  * tgamma_delta_ratio(T(k + 1), T(0.5f)))
                   * delta / constants::root_two<T>();
             }
             if(pois == 0)
@@ -203,7 +258,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol)
+         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol, const nc_t_series_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             if ((boost::math::isinf)(v))
@@ -258,13 +313,16 @@ namespace boost
                //
                if(x != 0)
                {
-                  result = non_central_beta_p(a, b, d2, x, y, pol);
-                  result = non_central_t2_p(v, delta, x, y, pol, result);
+                  result = non_central_beta_p(a, b, d2, x, y, pol, T(0), seeds ? &seeds->beta : 0);
+                  result = non_central_t2_p(v, delta, x, y, pol, result, seeds);
                   result /= 2;
                }
                else
                   result = 0;
-               result += cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+               if(seeds)
+                  result += delta == seeds->delta ? seeds->norm_cdf_neg : seeds->norm_cdf_pos;
+               else
+                  result += cdf(boost::math::normal_distribution<T, Policy>(), -delta);
             }
             else
             {
@@ -274,8 +332,8 @@ namespace boost
                invert = !invert;
                if(x != 0)
                {
-                  result = non_central_beta_q(a, b, d2, x, y, pol);
-                  result = non_central_t2_q(v, delta, x, y, pol, result);
+                  result = non_central_beta_q(a, b, d2, x, y, pol, T(0), seeds ? &seeds->beta : 0);
+                  result = non_central_t2_q(v, delta, x, y, pol, result, seeds);
                   result /= 2;
                }
                else // x == 0
@@ -287,7 +345,8 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t_quantile(const char* function, T v, T delta, T p, T q, const Policy&)
+         T non_central_t_quantile(const char* function, T v, T delta, T p, T q, const Policy&,
+            const nc_t_series_seeds<typename policies::evaluation<T, Policy>::type>* seeds = 0)
          {
             BOOST_MATH_STD_USING
      //       static const char* function = "quantile(non_central_t_distribution<%1%>, %1%)";
@@ -350,7 +409,8 @@ namespace boost
                static_cast<value_type>(delta), 
                static_cast<value_type>(0), 
                !(p < q), 
-               forwarding_policy());
+               forwarding_policy(),
+               seeds);
             int s;
             if(p < q)
                s = boost::math::sign(p - pzero);
@@ -361,12 +421,23 @@ namespace boost
                guess = static_cast<T>(s);
             }
 
-            value_type result = detail::generic_quantile(
-               non_central_t_distribution<value_type, forwarding_policy>(v, delta), 
-               (p < q ? p : q), 
-               guess, 
-               (p >= q), 
-               function);
+            //
+            // When the parameter dependent terms have been precomputed, reuse
+            // them for every cdf evaluation made by the root finder:
+            //
+            value_type result = seeds ?
+               detail::generic_quantile(
+                  frozen_non_central_t_distribution<value_type, forwarding_policy>(v, delta, *seeds), 
+                  (p < q ? p : q), 
+                  guess, 
+                  (p >= q), 
+                  function)
+               : detail::generic_quantile(
+                  non_central_t_distribution<value_type, forwarding_policy>(v, delta), 
+                  (p < q ? p : q), 
+                  guess, 
+                  (p >= q), 
+                  function);
             return policies::checked_narrowing_cast<T, forwarding_policy>(
                result, 
                function);
@@ -1190,6 +1261,173 @@ namespace boost
          return detail::non_central_t_quantile(function, v, l, RealType(1-q), q, Policy());
       } // quantile complement.
 
+      //
+      // A non-central t distribution whose parameter dependent terms (Poisson
+      // weights and the normal cdf at the non-centrality) are computed once at
+      // construction and reused by every subsequent call to cdf and quantile -
+      // including each cdf evaluation made by the quantile root finder.
+      // Results are identical to those of non_central_t_distribution.
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class frozen_non_central_t_distribution : public non_central_t_distribution<RealType, Policy>
+      {
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef detail::nc_t_series_seeds<eval_type> seeds_type;
+
+         frozen_non_central_t_distribution(RealType v_, RealType lambda)
+            : non_central_t_distribution<RealType, Policy>(v_, lambda),
+              seeds(detail::make_nc_t_series_seeds(static_cast<eval_type>(v_), static_cast<eval_type>(lambda), Policy()))
+         {
+         }
+         frozen_non_central_t_distribution(RealType v_, RealType lambda, const seeds_type& s)
+            : non_central_t_distribution<RealType, Policy>(v_, lambda), seeds(s)
+         {
+         }
+
+         const seeds_type& series_seeds() const
+         {
+            return seeds;
+         }
+      private:
+         seeds_type seeds; // Parameter dependent terms of the cdf series.
+      }; // template <class RealType, class Policy> class frozen_non_central_t_distribution
+
+      typedef frozen_non_central_t_distribution<double> frozen_non_central_t; // Reserved name of type double.
+
+      // Most non-member functions are found via the base class, but variance
+      // and pdf must be given explicitly, or the generic versions in
+      // derived_accessors.hpp would be a better match:
+      template <class RealType, class Policy>
+      inline RealType variance(const frozen_non_central_t_distribution<RealType, Policy>& dist)
+      {
+         return variance(static_cast<const non_central_t_distribution<RealType, Policy>&>(dist));
+      }
+
+      template <class RealType, class Policy>
+      inline RealType pdf(const frozen_non_central_t_distribution<RealType, Policy>& dist, const RealType& t)
+      {
+         return pdf(static_cast<const non_central_t_distribution<RealType, Policy>&>(dist), t);
+      }
+
+      template <class RealType, class Policy>
+      RealType cdf(const frozen_non_central_t_distribution<RealType, Policy>& dist, const RealType& x)
+      { 
+         const char* function = "boost::math::cdf(non_central_t_distribution<%1%>&, %1%)";
+         typedef typename policies::evaluation<RealType, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy, 
+            policies::promote_float<false>, 
+            policies::promote_double<false>, 
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         RealType v = dist.degrees_of_freedom();
+         RealType l = dist.non_centrality();
+         RealType r;
+         if(!detail::check_df_gt0_to_inf(
+            function,
+            v, &r, Policy())
+            ||
+         !detail::check_finite(
+            function,
+            l,
+            &r,
+            Policy())
+            ||
+         !detail::check_x(
+            function,
+            x,
+            &r,
+            Policy()))
+               return (RealType)r;
+
+         if(l == 0)
+         { // NO non-centrality, so use Student's t instead.
+            return cdf(students_t_distribution<RealType, Policy>(v), x);
+         }
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+            detail::non_central_t_cdf(
+               static_cast<value_type>(v), 
+               static_cast<value_type>(l), 
+               static_cast<value_type>(x), 
+               false, Policy(), &dist.series_seeds()),
+            function);
+      } // cdf
+
+      template <class RealType, class Policy>
+      RealType cdf(const complemented2_type<frozen_non_central_t_distribution<RealType, Policy>, RealType>& c)
+      { // Complemented Cumulative Distribution Function
+         const char* function = "boost::math::cdf(const complement(non_central_t_distribution<%1%>&), %1%)";
+         typedef typename policies::evaluation<RealType, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy, 
+            policies::promote_float<false>, 
+            policies::promote_double<false>, 
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         frozen_non_central_t_distribution<RealType, Policy> const& dist = c.dist;
+         RealType x = c.param;
+         RealType v = dist.degrees_of_freedom();
+         RealType l = dist.non_centrality(); // aka delta
+         RealType r;
+         if(!detail::check_df_gt0_to_inf(
+            function,
+            v, &r, Policy())
+            ||
+         !detail::check_finite(
+            function,
+            l,
+            &r,
+            Policy())
+            ||
+         !detail::check_x(
+            function,
+            x,
+            &r,
+            Policy()))
+               return (RealType)r;
+
+         if ((boost::math::isinf)(v))
+         { // Infinite degrees of freedom, so use normal distribution located at delta.
+             normal_distribution<RealType, Policy> n(l, 1); 
+             return cdf(complement(n, x));
+         }
+         if(l == 0)
+         { // zero non-centrality so use Student's t distribution.
+            return cdf(complement(students_t_distribution<RealType, Policy>(v), x));
+         }
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+            detail::non_central_t_cdf(
+               static_cast<value_type>(v), 
+               static_cast<value_type>(l), 
+               static_cast<value_type>(x), 
+               true, Policy(), &dist.series_seeds()),
+            function);
+      } // ccdf
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const frozen_non_central_t_distribution<RealType, Policy>& dist, const RealType& p)
+      { // Quantile (or Percent Point) function.
+         static const char* function = "quantile(const non_central_t_distribution<%1%>, %1%)";
+         RealType v = dist.degrees_of_freedom();
+         RealType l = dist.non_centrality();
+         return detail::non_central_t_quantile(function, v, l, p, RealType(1-p), Policy(), &dist.series_seeds());
+      } // quantile
+
+      template <class RealType, class Policy>
+      inline RealType quantile(const complemented2_type<frozen_non_central_t_distribution<RealType, Policy>, RealType>& c)
+      { // Quantile (or Percent Point) function.
+         static const char* function = "quantile(const complement(non_central_t_distribution<%1%>, %1%))";
+         RealType q = c.param;
+         RealType v = c.dist.degrees_of_freedom();
+         RealType l = c.dist.non_centrality();
+         return detail::non_central_t_quantile(function, v, l, RealType(1-q), q, Policy(), &c.dist.series_seeds());
+      } // quantile complement.
+
    } // namespace math
 } // namespace boost
 
@@ -0,0 +1,1002 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_SAMPLING_HPP
+#define BOOST_MATH_DISTRIBUTIONS_SAMPLING_HPP
+
+//
+// Random variate generation for the distributions in this library.
+//
+// sampler<Distribution> is constructed from a distribution object, does
+// whatever set up the distribution's parameters require, and then produces
+// variates from any UniformRandomBitGenerator.  The free functions
+// sample(dist, gen) and sample(dist, gen, first, last) are shorthands for
+// a single variate and for filling a range.
+//
+// The primary template uses inversion via quantile, which is exact for
+// every continuous distribution, and efficient whenever the quantile has a
+// closed form.  All the distributions whose quantile requires iteration,
+// plus all the discrete distributions, are specialised below.
+//
+
+#include <boost/math/distributions/fwd.hpp>
+#include <boost/math/distributions/detail/random_bits.hpp>
+#include <boost/math/distributions/detail/ziggurat.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <vector>
+
+namespace boost{ namespace math{
+
+namespace detail{
+
+template <class T>
+class standard_normal_sampler
+{
+public:
+   standard_normal_sampler() : m_zig(&normal_ziggurat<T>::get()) {}
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      return (*m_zig)(gen);
+   }
+private:
+   const normal_ziggurat<T>* m_zig;
+};
+
+template <class T>
+class standard_exponential_sampler
+{
+public:
+   standard_exponential_sampler() : m_zig(&exponential_ziggurat<T>::get()) {}
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      return (*m_zig)(gen);
+   }
+private:
+   const exponential_ziggurat<T>* m_zig;
+};
+
+//
+// Gamma variates with unit scale, see "A Simple Method for Generating Gamma
+// Variables", G. Marsaglia and W. W. Tsang, ACM Transactions on Mathematical
+// Software, 26 (2000).  Shapes below 1 are boosted to shape + 1 and then
+// multiplied by U^(1/shape).
+//
+template <class T>
+class standard_gamma_sampler
+{
+public:
+   explicit standard_gamma_sampler(T shape) : m_shape(shape), m_boost(shape < 1)
+   {
+      BOOST_MATH_STD_USING
+      m_d = (m_boost ? T(shape + 1) : shape) - T(1) / 3;
+      m_c = 1 / sqrt(9 * m_d);
+   }
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      T result = marsaglia_tsang(gen);
+      if(m_boost)
+         result *= pow(uniform_01<T>(gen), 1 / m_shape);
+      return result;
+   }
+   //
+   // Returns the log of a gamma variate, this avoids the underflow
+   // that U^(1/shape) suffers when the shape is very small:
+   //
+   template <class URBG>
+   T log_sample(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      T result = log(marsaglia_tsang(gen));
+      if(m_boost)
+         result += log(uniform_01<T>(gen)) / m_shape;
+      return result;
+   }
+private:
+   template <class URBG>
+   T marsaglia_tsang(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      for(;;)
+      {
+         T x = m_normal(gen);
+         T v = 1 + m_c * x;
+         if(v <= 0)
+            continue;
+         v = v * v * v;
+         T u = uniform_01<T>(gen);
+         T x2 = x * x;
+         if(u < 1 - T(0.0331f) * x2 * x2)
+            return m_d * v;
+         if(log(u) < x2 / 2 + m_d * (1 - v + log(v)))
+            return m_d * v;
+      }
+   }
+   T m_shape, m_d, m_c;
+   bool m_boost;
+   standard_normal_sampler<T> m_normal;
+};
+
+//
+// Poisson variates: for small means sequential search by inversion,
+// otherwise the transformed rejection method PTRS from "The transformed
+// rejection method for generating Poisson random variables", W. Hormann,
+// Insurance: Mathematics and Economics, 12 (1993).
+//
+template <class T, class Policy>
+class poisson_sampler_imp
+{
+public:
+   explicit poisson_sampler_imp(T mean) : m_mean(mean)
+   {
+      BOOST_MATH_STD_USING
+      if(mean < 10)
+      {
+         m_exp_mean = exp(-mean);
+      }
+      else
+      {
+         T smu = sqrt(mean);
+         m_b = T(0.931f) + T(2.53f) * smu;
+         m_a = T(-0.059f) + T(0.02483f) * m_b;
+         // inv_alpha in Hormann's notation:
+         m_log_inv_alpha = log(T(1.1239f) + T(1.1328f) / (m_b - T(3.4f)));
+         m_vr = T(0.9277f) - T(3.6224f) / (m_b - 2);
+         m_log_mean = log(mean);
+      }
+   }
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      if(m_mean == 0)
+         return 0;
+      if(m_mean < 10)
+      {
+         for(;;)
+         {
+            T u = uniform_01<T>(gen);
+            T p = m_exp_mean;
+            T s = p;
+            T x = 0;
+            while(u > s)
+            {
+               x += 1;
+               p *= m_mean / x;
+               s += p;
+               if(p == 0)
+                  break;  // u was lost in the rounding error of s, start again
+            }
+            if(u <= s)
+               return x;
+         }
+      }
+      for(;;)
+      {
+         T u = uniform_01<T>(gen) - constants::half<T>();
+         T v = uniform_01<T>(gen);
+         T us = constants::half<T>() - fabs(u);
+         T k = floor((2 * m_a / us + m_b) * u + m_mean + T(0.43f));
+         if((us >= T(0.07f)) && (v <= m_vr))
+            return k;
+         if((k < 0) || ((us < T(0.013f)) && (v > us)))
+            continue;
+         if(log(v) + m_log_inv_alpha - log(m_a / (us * us) + m_b)
+            <= -m_mean + k * m_log_mean - boost::math::lgamma(k + 1, Policy()))
+            return k;
+      }
+   }
+private:
+   T m_mean, m_exp_mean, m_a, m_b, m_log_inv_alpha, m_vr, m_log_mean;
+};
+
+//
+// log(f(y) / f(m)) for the binomial(n, p) pdf f, from Stirling's formula
+// with the correction terms to 1/x^9: the final acceptance test of BTPE.
+//
+template <class T>
+inline T binomial_stirling_correction(T x)
+{
+   T x2 = x * x;
+   return (13860 - (462 - (132 - (99 - 140 / x2) / x2) / x2) / x2) / x / 166320;
+}
+
+template <class T>
+T binomial_log_pdf_ratio(T n, T p, T m, T y)
+{
+   BOOST_MATH_STD_USING
+   T x1 = y + 1;
+   T f1 = m + 1;
+   T z = n + 1 - m;
+   T w = n - y + 1;
+   return (m + constants::half<T>()) * log(f1 / x1) + (n - m + constants::half<T>()) * log(z / w) + (y - m) * log(w * p / (x1 * (1 - p)))
+      + binomial_stirling_correction(f1) + binomial_stirling_correction(z) - binomial_stirling_correction(x1) - binomial_stirling_correction(w);
+}
+
+//
+// Binomial variates: for n * min(p, 1-p) < 30 sequential search by
+// inversion, otherwise algorithm BTPE from "Binomial Random Variate
+// Generation", V. Kachitvichyanukul and B. W. Schmeiser, Communications
+// of the ACM, 31 (1988).
+//
+template <class T>
+class binomial_sampler_imp
+{
+public:
+   binomial_sampler_imp(T n, T p) : m_n(n), m_flip(p > 0.5f)
+   {
+      BOOST_MATH_STD_USING
+      m_r = m_flip ? T(1 - p) : p;
+      m_q = 1 - m_r;
+      if(n * m_r < 30)
+      {
+         m_qn = pow(m_q, n);
+         m_s = m_r / m_q;
+      }
+      else
+      {
+         m_npq = n * m_r * m_q;
+         T fm = n * m_r + m_r;
+         m_m = floor(fm);
+         m_p1 = floor(T(2.195f) * sqrt(m_npq) - T(4.6f) * m_q) + constants::half<T>();
+         m_xm = m_m + constants::half<T>();
+         m_xl = m_xm - m_p1;
+         m_xr = m_xm + m_p1;
+         m_c = T(0.134f) + T(20.5f) / (T(15.3f) + m_m);
+         T a = (fm - m_xl) / (fm - m_xl * m_r);
+         m_laml = a * (1 + a / 2);
+         a = (m_xr - fm) / (m_xr * m_q);
+         m_lamr = a * (1 + a / 2);
+         m_p2 = m_p1 * (1 + 2 * m_c);
+         m_p3 = m_p2 + m_c / m_laml;
+         m_p4 = m_p3 + m_c / m_lamr;
+         m_s = m_r / m_q;
+      }
+   }
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      T result = m_n * m_r < 30 ? inversion(gen) : btpe(gen);
+      return m_flip ? T(m_n - result) : result;
+   }
+private:
+   template <class URBG>
+   T inversion(URBG& gen)const
+   {
+      for(;;)
+      {
+         T u = uniform_01<T>(gen);
+         T p = m_qn;
+         T s = p;
+         T x = 0;
+         while((u > s) && (x < m_n))
+         {
+            p *= (m_n - x) / (x + 1) * m_s;
+            x += 1;
+            s += p;
+         }
+         if(u <= s)
+            return x;
+         // else u was lost in the rounding error of s, start again.
+      }
+   }
+   template <class URBG>
+   T btpe(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      for(;;)
+      {
+         T u = uniform_01<T>(gen) * m_p4;
+         T v = uniform_01<T>(gen);
+         T y;
+         if(u <= m_p1)
+         {
+            // Triangular region, accept immediately:
+            return floor(m_xm - m_p1 * v + u);
+         }
+         else if(u <= m_p2)
+         {
+            // Parallelogram region:
+            T x = m_xl + (u - m_p1) / m_c;
+            v = v * m_c + 1 - fabs(m_m - x + constants::half<T>()) / m_p1;
+            if(v > 1)
+               continue;
+            y = floor(x);
+         }
+         else if(u <= m_p3)
+         {
+            // Left exponential tail:
+            y = floor(m_xl + log(v) / m_laml);
+            if(y < 0)
+               continue;
+            v = v * (u - m_p2) * m_laml;
+         }
+         else
+         {
+            // Right exponential tail:
+            y = floor(m_xr - log(v) / m_lamr);
+            if(y > m_n)
+               continue;
+            v = v * (u - m_p3) * m_lamr;
+         }
+         T k = fabs(y - m_m);
+         if((k <= 20) || (k >= m_npq / 2 - 1))
+         {
+            //
+            // Explicit evaluation of f(y) / f(m) via the recurrence:
+            //
+            T a = m_s * (m_n + 1);
+            T f = 1;
+            if(m_m < y)
+            {
+               for(T i = m_m + 1; i <= y; i += 1)
+                  f *= (a / i - m_s);
+            }
+            else if(m_m > y)
+            {
+               for(T i = y + 1; i <= m_m; i += 1)
+                  f /= (a / i - m_s);
+            }
+            if(v <= f)
+               return y;
+            continue;
+         }
+         //
+         // Squeeze using upper and lower bounds on log(f(y)), and
+         // then the final comparison with Stirling's formula:
+         //
+         T rho = (k / m_npq) * ((k * (k / 3 + T(0.625f)) + T(1) / 6) / m_npq + constants::half<T>());
+         T t = -k * k / (2 * m_npq);
+         T alv = log(v);
+         if(alv < t - rho)
+            return y;
+         if(alv > t + rho)
+            continue;
+         if(alv <= binomial_log_pdf_ratio(m_n, m_r, m_m, y))
+            return y;
+      }
+   }
+
+   T m_n, m_r, m_q, m_qn, m_s;
+   T m_npq, m_m, m_p1, m_xm, m_xl, m_xr, m_c, m_laml, m_lamr, m_p2, m_p3, m_p4;
+   bool m_flip;
+};
+
+//
+// Non-central chi squared variates as a Poisson mixture of central ones:
+// with J ~ Poisson(lambda / 2) then X ~ chi squared(v + 2J).
+//
+template <class T, class Policy>
+class non_central_chi_squared_sampler_imp
+{
+public:
+   non_central_chi_squared_sampler_imp(T v, T lambda) : m_v(v), m_poisson(lambda / 2) {}
+   template <class URBG>
+   T operator()(URBG& gen)const
+   {
+      T j = m_poisson(gen);
+      return 2 * standard_gamma_sampler<T>(m_v / 2 + j)(gen);
+   }
+private:
+   T m_v;
+   poisson_sampler_imp<T, Policy> m_poisson;
+};
+
+} // namespace detail
+
+template <class Distribution>
+class sampler
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type result_type;
+
+   explicit sampler(const Distribution& dist) : m_dist(dist) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // Inversion, for distributions whose quantile is cheap to evaluate:
+      //
+      return quantile(m_dist, detail::uniform_01<result_type>(gen));
+   }
+private:
+   Distribution m_dist;
+};
+
+template <class RealType, class Policy>
+class sampler<normal_distribution<RealType, Policy> >
+{
+public:
+   typedef normal_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_mean(dist.mean()), m_sd(dist.standard_deviation()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_mean + m_sd * m_normal(gen);
+   }
+private:
+   RealType m_mean, m_sd;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+template <class RealType, class Policy>
+class sampler<lognormal_distribution<RealType, Policy> >
+{
+public:
+   typedef lognormal_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_location(dist.location()), m_scale(dist.scale()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      return exp(m_location + m_scale * m_normal(gen));
+   }
+private:
+   RealType m_location, m_scale;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+template <class RealType, class Policy>
+class sampler<skew_normal_distribution<RealType, Policy> >
+{
+public:
+   typedef skew_normal_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_location(dist.location()), m_scale(dist.scale())
+   {
+      BOOST_MATH_STD_USING
+      RealType shape = dist.shape();
+      m_delta = shape / sqrt(1 + shape * shape);
+      m_root_one_minus_delta2 = 1 / sqrt(1 + shape * shape);
+   }
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // If U0 and V are standard normal, then U1 = delta * U0 + sqrt(1 - delta^2) * V
+      // conditioned on U0 >= 0 is skew normal, and by symmetry we can
+      // negate U1 rather than reject when U0 < 0:
+      //
+      RealType u0 = m_normal(gen);
+      RealType u1 = m_delta * u0 + m_root_one_minus_delta2 * m_normal(gen);
+      return m_location + m_scale * (u0 >= 0 ? u1 : RealType(-u1));
+   }
+private:
+   RealType m_location, m_scale, m_delta, m_root_one_minus_delta2;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+template <class RealType, class Policy>
+class sampler<exponential_distribution<RealType, Policy> >
+{
+public:
+   typedef exponential_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_lambda(dist.lambda()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_exponential(gen) / m_lambda;
+   }
+private:
+   RealType m_lambda;
+   detail::standard_exponential_sampler<RealType> m_exponential;
+};
+
+template <class RealType, class Policy>
+class sampler<hyperexponential_distribution<RealType, Policy> >
+{
+public:
+   typedef hyperexponential_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_cumulative(dist.probabilities()), m_rates(dist.rates())
+   {
+      for(std::size_t i = 1; i < m_cumulative.size(); ++i)
+         m_cumulative[i] += m_cumulative[i - 1];
+   }
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      // Pick the phase, then sample the exponential distribution for that phase:
+      RealType u = detail::uniform_01<RealType>(gen) * m_cumulative.back();
+      std::size_t i = 0;
+      while((i + 1 < m_cumulative.size()) && (u > m_cumulative[i]))
+         ++i;
+      return m_exponential(gen) / m_rates[i];
+   }
+private:
+   std::vector<RealType> m_cumulative, m_rates;
+   detail::standard_exponential_sampler<RealType> m_exponential;
+};
+
+template <class RealType, class Policy>
+class sampler<gamma_distribution<RealType, Policy> >
+{
+public:
+   typedef gamma_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_gamma(dist.shape()), m_scale(dist.scale()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_scale * m_gamma(gen);
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   RealType m_scale;
+};
+
+template <class RealType, class Policy>
+class sampler<chi_squared_distribution<RealType, Policy> >
+{
+public:
+   typedef chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_gamma(dist.degrees_of_freedom() / 2) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return 2 * m_gamma(gen);
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_gamma;
+};
+
+template <class RealType, class Policy>
+class sampler<inverse_gamma_distribution<RealType, Policy> >
+{
+public:
+   typedef inverse_gamma_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_gamma(dist.shape()), m_scale(dist.scale()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_scale / m_gamma(gen);
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   RealType m_scale;
+};
+
+template <class RealType, class Policy>
+class sampler<inverse_chi_squared_distribution<RealType, Policy> >
+{
+public:
+   typedef inverse_chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   //
+   // The scaled inverse chi squared distribution is inverse gamma
+   // with shape v/2 and scale v * scale / 2:
+   //
+   explicit sampler(const distribution_type& dist)
+      : m_gamma(dist.degrees_of_freedom() / 2), m_scale(dist.degrees_of_freedom() * dist.scale() / 2) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_scale / m_gamma(gen);
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   RealType m_scale;
+};
+
+template <class RealType, class Policy>
+class sampler<beta_distribution<RealType, Policy> >
+{
+public:
+   typedef beta_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_x(dist.alpha()), m_y(dist.beta()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // X / (X + Y) with X and Y gamma, computed from the logs of the gamma
+      // variates so that small shape parameters don't underflow to 0/0:
+      //
+      BOOST_MATH_STD_USING
+      RealType lx = m_x.log_sample(gen);
+      RealType ly = m_y.log_sample(gen);
+      return 1 / (1 + exp(ly - lx));
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_x, m_y;
+};
+
+template <class RealType, class Policy>
+class sampler<students_t_distribution<RealType, Policy> >
+{
+public:
+   typedef students_t_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_v(dist.degrees_of_freedom()), m_gamma((boost::math::isinf)(m_v) ? RealType(1) : RealType(m_v / 2)) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      RealType z = m_normal(gen);
+      if((boost::math::isinf)(m_v))
+         return z;
+      return z / sqrt(2 * m_gamma(gen) / m_v);
+   }
+private:
+   RealType m_v;
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+template <class RealType, class Policy>
+class sampler<fisher_f_distribution<RealType, Policy> >
+{
+public:
+   typedef fisher_f_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_v1(dist.degrees_of_freedom1()), m_v2(dist.degrees_of_freedom2()), m_x(m_v1 / 2), m_y(m_v2 / 2) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      // (X / v1) / (Y / v2) computed via logs as for the beta distribution:
+      return exp(m_x.log_sample(gen) - m_y.log_sample(gen)) * m_v2 / m_v1;
+   }
+private:
+   RealType m_v1, m_v2;
+   detail::standard_gamma_sampler<RealType> m_x, m_y;
+};
+
+template <class RealType, class Policy>
+class sampler<inverse_gaussian_distribution<RealType, Policy> >
+{
+public:
+   typedef inverse_gaussian_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_mean(dist.mean()), m_lambda(dist.scale()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // Method of "Generating Random Variates Using Transformations with Multiple Roots",
+      // J. R. Michael, W. R. Schucany and R. W. Haas, The American Statistician, 30 (1976).
+      // The smaller root is rearranged to avoid cancellation when mean * y / lambda is large:
+      //
+      BOOST_MATH_STD_USING
+      RealType z = m_normal(gen);
+      RealType my = m_mean * z * z;
+      RealType x = m_mean - 2 * m_mean * my / (my + sqrt(my * (my + 4 * m_lambda)));
+      if(detail::uniform_01<RealType>(gen) * (m_mean + x) <= m_mean)
+         return x;
+      return m_mean * m_mean / x;
+   }
+private:
+   RealType m_mean, m_lambda;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+template <class RealType, class Policy>
+class sampler<non_central_chi_squared_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_imp(dist.degrees_of_freedom(), dist.non_centrality()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_imp(gen);
+   }
+private:
+   detail::non_central_chi_squared_sampler_imp<RealType, Policy> m_imp;
+};
+
+template <class RealType, class Policy>
+class sampler<non_central_beta_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_beta_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_x(2 * dist.alpha(), dist.non_centrality()), m_y(dist.beta()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // X / (X + Y) with X non-central chi squared on 2a degrees of freedom
+      // and Y central chi squared on 2b degrees of freedom:
+      //
+      RealType x = m_x(gen);
+      RealType y = 2 * m_y(gen);
+      return x / (x + y);
+   }
+private:
+   detail::non_central_chi_squared_sampler_imp<RealType, Policy> m_x;
+   detail::standard_gamma_sampler<RealType> m_y;
+};
+
+template <class RealType, class Policy>
+class sampler<non_central_f_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_f_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_v1(dist.degrees_of_freedom1()), m_v2(dist.degrees_of_freedom2()), m_x(m_v1, dist.non_centrality()), m_y(m_v2 / 2) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return (m_x(gen) / m_v1) / (2 * m_y(gen) / m_v2);
+   }
+private:
+   RealType m_v1, m_v2;
+   detail::non_central_chi_squared_sampler_imp<RealType, Policy> m_x;
+   detail::standard_gamma_sampler<RealType> m_y;
+};
+
+template <class RealType, class Policy>
+class sampler<non_central_t_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_t_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_v(dist.degrees_of_freedom()), m_delta(dist.non_centrality()), m_gamma((boost::math::isinf)(m_v) ? RealType(1) : RealType(m_v / 2)) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      RealType z = m_normal(gen) + m_delta;
+      if((boost::math::isinf)(m_v))
+         return z;
+      return z / sqrt(2 * m_gamma(gen) / m_v);
+   }
+private:
+   RealType m_v, m_delta;
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   detail::standard_normal_sampler<RealType> m_normal;
+};
+
+//
+// The frozen non-central distributions sample exactly as the regular ones:
+//
+template <class RealType, class Policy>
+class sampler<frozen_non_central_chi_squared_distribution<RealType, Policy> >
+   : public sampler<non_central_chi_squared_distribution<RealType, Policy> >
+{
+public:
+   typedef frozen_non_central_chi_squared_distribution<RealType, Policy> distribution_type;
+   explicit sampler(const distribution_type& dist)
+      : sampler<non_central_chi_squared_distribution<RealType, Policy> >(dist) {}
+};
+
+template <class RealType, class Policy>
+class sampler<frozen_non_central_beta_distribution<RealType, Policy> >
+   : public sampler<non_central_beta_distribution<RealType, Policy> >
+{
+public:
+   typedef frozen_non_central_beta_distribution<RealType, Policy> distribution_type;
+   explicit sampler(const distribution_type& dist)
+      : sampler<non_central_beta_distribution<RealType, Policy> >(dist) {}
+};
+
+template <class RealType, class Policy>
+class sampler<frozen_non_central_f_distribution<RealType, Policy> >
+   : public sampler<non_central_f_distribution<RealType, Policy> >
+{
+public:
+   typedef frozen_non_central_f_distribution<RealType, Policy> distribution_type;
+   explicit sampler(const distribution_type& dist)
+      : sampler<non_central_f_distribution<RealType, Policy> >(dist) {}
+};
+
+template <class RealType, class Policy>
+class sampler<frozen_non_central_t_distribution<RealType, Policy> >
+   : public sampler<non_central_t_distribution<RealType, Policy> >
+{
+public:
+   typedef frozen_non_central_t_distribution<RealType, Policy> distribution_type;
+   explicit sampler(const distribution_type& dist)
+      : sampler<non_central_t_distribution<RealType, Policy> >(dist) {}
+};
+
+//
+// Discrete distributions:
+//
+template <class RealType, class Policy>
+class sampler<bernoulli_distribution<RealType, Policy> >
+{
+public:
+   typedef bernoulli_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_p(dist.success_fraction()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return detail::uniform_01<RealType>(gen) < m_p ? RealType(1) : RealType(0);
+   }
+private:
+   RealType m_p;
+};
+
+template <class RealType, class Policy>
+class sampler<binomial_distribution<RealType, Policy> >
+{
+public:
+   typedef binomial_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_imp(dist.trials(), dist.success_fraction()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_imp(gen);
+   }
+private:
+   detail::binomial_sampler_imp<RealType> m_imp;
+};
+
+template <class RealType, class Policy>
+class sampler<poisson_distribution<RealType, Policy> >
+{
+public:
+   typedef poisson_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist) : m_imp(dist.mean()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      return m_imp(gen);
+   }
+private:
+   detail::poisson_sampler_imp<RealType, Policy> m_imp;
+};
+
+template <class RealType, class Policy>
+class sampler<negative_binomial_distribution<RealType, Policy> >
+{
+public:
+   typedef negative_binomial_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_gamma(dist.successes()), m_odds((1 - dist.success_fraction()) / dist.success_fraction()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      // A Poisson variate whose mean is gamma distributed:
+      return detail::poisson_sampler_imp<RealType, Policy>(m_odds * m_gamma(gen))(gen);
+   }
+private:
+   detail::standard_gamma_sampler<RealType> m_gamma;
+   RealType m_odds;
+};
+
+template <class RealType, class Policy>
+class sampler<geometric_distribution<RealType, Policy> >
+{
+public:
+   typedef geometric_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+   {
+      BOOST_MATH_STD_USING
+      RealType p = dist.success_fraction();
+      m_log_q = p == 1 ? RealType(0) : RealType(boost::math::log1p(-p, Policy()));
+   }
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      BOOST_MATH_STD_USING
+      if(m_log_q == 0)
+         return 0;
+      // Inversion: the number of failures before the first success:
+      return floor(log(detail::uniform_01<RealType>(gen)) / m_log_q);
+   }
+private:
+   RealType m_log_q;
+};
+
+template <class RealType, class Policy>
+class sampler<hypergeometric_distribution<RealType, Policy> >
+{
+public:
+   typedef hypergeometric_distribution<RealType, Policy> distribution_type;
+   typedef RealType result_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_dist(dist.defective(), dist.sample_count(), dist.total()) {}
+
+   template <class URBG>
+   result_type operator()(URBG& gen)const
+   {
+      //
+      // Inversion: the quantile must round up to give the smallest x with cdf(x) >= u:
+      //
+      return quantile(m_dist, detail::uniform_01<RealType>(gen));
+   }
+private:
+   typedef typename policies::normalise<Policy, policies::discrete_quantile<policies::integer_round_up> >::type inversion_policy;
+   hypergeometric_distribution<RealType, inversion_policy> m_dist;
+};
+
+//
+// Convenience functions:
+//
+template <class Distribution, class URBG>
+inline typename Distribution::value_type sample(const Distribution& dist, URBG& gen)
+{
+   return sampler<Distribution>(dist)(gen);
+}
+
+template <class Distribution, class URBG, class ForwardIterator>
+inline void sample(const Distribution& dist, URBG& gen, ForwardIterator first, ForwardIterator last)
+{
+   //
+   // Any set up cost is paid once for the whole range:
+   //
+   sampler<Distribution> s(dist);
+   for(; first != last; ++first)
+      *first = s(gen);
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_SAMPLING_HPP
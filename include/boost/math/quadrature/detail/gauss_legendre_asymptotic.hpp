@@ -0,0 +1,261 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_LEGENDRE_ASYMPTOTIC_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_LEGENDRE_ASYMPTOTIC_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// P_n(cos(theta)) and its derivative with respect to theta, by the expansion of Stieltjes
+// (Szego, Orthogonal Polynomials, Theorem 8.21.5):
+//
+//   P_n(cos(theta)) = C_n sum_{m=0}^{M-1} h_{n,m} cos(alpha_{n,m})/(2 sin(theta))^(m+1/2) + R_{n,M}(theta),
+//
+// where alpha_{n,m} = (n+m+1/2)theta - (m+1/2)pi/2, h_{n,0} = 1, h_{n,m+1} = h_{n,m} (m+1/2)^2/((m+1)(n+m+3/2)),
+// C_n = 2 Gamma(n+1)/(sqrt(pi) Gamma(n+3/2)), and |R_{n,M}| is less than twice the first omitted term without its cosine.
+// This is the evaluation used by Hale and Townsend, "Fast and accurate computation of Gauss-Legendre and Gauss-Jacobi
+// quadrature nodes and weights", SIAM J. Sci. Comput. 35 (2013), A652-A674: it costs O(1) for a given precision,
+// rather than the O(n) of the recurrence. The terms shrink roughly as m/(2n sin(theta)), so the expansion
+// reaches working precision except within a few zeros of the endpoints, and we return false there.
+//
+template <class Real, class Policy>
+bool legendre_p_stieltjes(unsigned n, Real theta, Real C_n, Real* P, Real* dP)
+{
+   using std::sin;
+   using std::cos;
+   using std::sqrt;
+   Real s = sin(theta);
+   Real c = cos(theta);
+   Real two_s = 2 * s;
+   Real cot = c / s;
+   Real alpha = (n + constants::half<Real>()) * theta - constants::pi<Real>() / 4;
+   Real ca = cos(alpha);
+   Real sa = sin(alpha);
+   Real q = 1 / sqrt(two_s);
+   // The terms of the derivative are larger by n+m+1/2, so both sums are accurate once these are negligible,
+   // provided the terms are still falling quickly enough that the tail is comparable to its first term:
+   Real tol = tools::epsilon<Real>() * q * (n + constants::half<Real>()) / 2;
+   Real sum = 0;
+   Real dsum = 0;
+   boost::uintmax_t max_terms = policies::get_max_series_iterations<Policy>();
+   for (boost::uintmax_t m = 0; m < max_terms; ++m)
+   {
+      Real mh = m + constants::half<Real>();
+      sum += q * ca;
+      dsum -= q * ((n + mh) * sa + mh * cot * ca);
+      Real q_next = q * mh * mh / ((m + 1) * (n + mh + 1) * two_s);
+      if ((q_next * (n + mh + 1) <= tol) && (2 * q_next <= q))
+      {
+         *P = C_n * sum;
+         *dP = C_n * dsum;
+         return true;
+      }
+      if (!(q_next < q))
+      {
+         return false;
+      }
+      q = q_next;
+      // alpha_{n,m+1} = alpha_{n,m} + theta - pi/2:
+      Real ca_next = ca * s + sa * c;
+      sa = sa * s - ca * c;
+      ca = ca_next;
+   }
+   return false;
+}
+
+//
+// P_n(cos(theta)) and its derivative with respect to theta by the three term recurrence, in O(n).
+// Near x = 1 the products x P_k lose the information in t = 1 - x = 2 sin^2(theta/2) to rounding at every step,
+// and the error of the weights there grows as n eps; so the recurrence runs on the differences d_k = P_k - P_{k-1},
+// (k+1) d_{k+1} = k d_k - (2k+1) t P_k, in which t enters unrounded (Reinsch's modification), and the error grows as sqrt(n) eps.
+//
+template <class Real>
+void legendre_p_recurrence(unsigned n, Real theta, Real* P, Real* dP)
+{
+   using std::sin;
+   using std::cos;
+   Real s = sin(theta);
+   Real half_t = sin(theta / 2);
+   Real t = 2 * half_t * half_t;
+   Real p = 1;
+   Real d = -t;
+   Real tail;
+   if (t < constants::half<Real>())
+   {
+      for (unsigned k = 1; k < n; ++k)
+      {
+         p += d;
+         d = (k * d - (2 * k + 1) * t * p) / (k + 1);
+      }
+      // P_{n-1} - x P_n = t P_n - d_n:
+      p += d;
+      tail = t * p - d;
+   }
+   else
+   {
+      Real x = cos(theta);
+      Real p0 = 1;
+      p = x;
+      for (unsigned k = 1; k < n; ++k)
+      {
+         Real p2 = ((2 * k + 1) * x * p - k * p0) / (k + 1);
+         p0 = p;
+         p = p2;
+      }
+      tail = p0 - x * p;
+   }
+   // (1 - x^2) P_n'(x) = n (P_{n-1}(x) - x P_n(x)), and dP/dtheta = -sin(theta) P_n'(x):
+   *P = p;
+   *dP = -(n * tail) / s;
+}
+
+//
+// The k-th non-negative zero x of P_n, counted as by legendre_p_zeros, and the Gauss-Legendre weight 2/((1-x^2)P_n'(x)^2) = 2/(dP/dtheta)^2.
+// Newton's method runs on theta = acos(x), by the Stieltjes expansion from Tricomi's approximation in the interior,
+// and by the recurrence from the approximation theta = psi + (psi cot(psi) - 1)/(8 psi rho^2), psi = j_{0,i}/rho, rho = n + 1/2,
+// for the i-th zero from x = 1 (Gatteschi; see Hale and Townsend, equation 3.9) within the few zeros of the endpoint where the expansion fails.
+// Since P_n(cos(theta)) satisfies P'' + cot(theta)P' + n(n+1)P = 0, at a zero P''/P' = -cot(theta), and a Newton step
+// of size delta leaves an error of about cot(theta) delta^2/2; so one step after delta falls below sqrt(eps) theta, the zero is exact
+// to working precision, and the derivative at that point gives the weight.
+//
+template <class Real, class Policy>
+void gauss_legendre_node(unsigned n, unsigned k, Real C_n, Real* x, Real* w)
+{
+   using std::acos;
+   using std::cos;
+   using std::sin;
+   using std::ceil;
+   using std::abs;
+   using constants::half;
+   using constants::pi;
+   Real P;
+   Real dP;
+   if ((n & 1) && (k == 0))
+   {
+      Real theta = constants::half_pi<Real>();
+      if (!legendre_p_stieltjes<Real, Policy>(n, theta, C_n, &P, &dP))
+      {
+         legendre_p_recurrence(n, theta, &P, &dP);
+      }
+      *x = 0;
+      *w = 2 / (dP * dP);
+      return;
+   }
+   Real half_n = ceil(n * half<Real>());
+   Real theta_nk = ((half_n - half<Real>() * half<Real>() - static_cast<Real>(k)) * pi<Real>()) / (static_cast<Real>(n) + half<Real>());
+   Real inv_n_sq = 1 / (static_cast<Real>(n) * n);
+   Real sin_nk = sin(theta_nk);
+   Real x_guess = (1 - inv_n_sq / 8 + inv_n_sq / (8 * static_cast<Real>(n)) - (inv_n_sq * inv_n_sq / 384) * (39 - 28 / (sin_nk * sin_nk))) * cos(theta_nk);
+   Real theta = (x_guess < 1) ? acos(x_guess) : Real(0);
+   bool asymptotic = (theta > 0) && legendre_p_stieltjes<Real, Policy>(n, theta, C_n, &P, &dP);
+   if (!asymptotic)
+   {
+      unsigned from_one = (n + 1) / 2 - k;
+      Real rho = n + half<Real>();
+      // McMahon's expansion of the zero j_{0,i} of the Bessel function is good to 1e-3 even for i = 1, which Newton's method soon repairs:
+      Real beta = (from_one - half<Real>() * half<Real>()) * pi<Real>();
+      Real inv_beta_sq = 1 / (beta * beta);
+      Real j0 = beta + (1 - inv_beta_sq * (Real(31) / 48 - inv_beta_sq * Real(3779) / 1920)) / (8 * beta);
+      Real psi = j0 / rho;
+      theta = psi + (psi * cos(psi) / sin(psi) - 1) / (8 * psi * rho * rho);
+      legendre_p_recurrence(n, theta, &P, &dP);
+   }
+   Real root_eps = tools::root_epsilon<Real>();
+   boost::uintmax_t max_iterations = policies::get_max_root_iterations<Policy>();
+   bool last = false;
+   for (boost::uintmax_t i = 0; i < max_iterations; ++i)
+   {
+      Real delta = P / dP;
+      theta -= delta;
+      if (last)
+      {
+         break;
+      }
+      last = abs(delta) <= root_eps * theta;
+      if (!asymptotic || !legendre_p_stieltjes<Real, Policy>(n, theta, C_n, &P, &dP))
+      {
+         asymptotic = false;
+         legendre_p_recurrence(n, theta, &P, &dP);
+      }
+   }
+   *x = cos(theta);
+   *w = 2 / (dP * dP);
+}
+
+//
+// The non-negative abscissa of the n point Gauss-Legendre rule in increasing order, as legendre_p_zeros returns them,
+// and their weights, in O(n) operations. The nodes are independent, so they are shared out between up to `threads` threads.
+//
+template <class Real, class Policy>
+void gauss_legendre_nodes_and_weights(unsigned n, std::vector<Real>& abscissa, std::vector<Real>& weights, unsigned threads, const Policy& pol)
+{
+   using std::sqrt;
+   unsigned size = (n + 1) / 2;
+   abscissa.assign(size, Real(0));
+   weights.assign(size, Real(0));
+   if (n == 0)
+   {
+      return;
+   }
+   Real C_n = 2 * boost::math::tgamma_delta_ratio(static_cast<Real>(n + 1), constants::half<Real>(), pol) / constants::root_pi<Real>();
+   auto nodes = [&](unsigned begin, unsigned end)
+   {
+      for (unsigned k = begin; k < end; ++k)
+      {
+         gauss_legendre_node<Real, Policy>(n, k, C_n, &abscissa[k], &weights[k]);
+      }
+   };
+   // A thread must have enough nodes to be worth starting:
+   threads = (std::min)(threads, size / 2048);
+   if (threads <= 1)
+   {
+      nodes(0, size);
+      return;
+   }
+   std::vector<std::thread> workers;
+   std::vector<std::exception_ptr> errors(threads);
+   for (unsigned t = 0; t < threads; ++t)
+   {
+      unsigned begin = static_cast<unsigned>(static_cast<unsigned long long>(size) * t / threads);
+      unsigned end = static_cast<unsigned>(static_cast<unsigned long long>(size) * (t + 1) / threads);
+      workers.emplace_back([&, t, begin, end]()
+      {
+         try
+         {
+            nodes(begin, end);
+         }
+         catch (...)
+         {
+            errors[t] = std::current_exception();
+         }
+      });
+   }
+   for (auto& worker : workers)
+   {
+      worker.join();
+   }
+   for (auto const & e : errors)
+   {
+      if (e)
+      {
+         std::rethrow_exception(e);
+      }
+   }
+}
+
+}}}} // namespaces
+
+#endif
@@ -0,0 +1,167 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_TABLES_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_TABLES_HPP
+
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// The nodes of a Gauss rule in increasing order, and their weights.
+//
+template <class Real>
+struct gauss_rule
+{
+   std::vector<Real> abscissa;
+   std::vector<Real> weights;
+};
+
+//
+// The table of a fixed rule which is computed on first use, for example gauss_detail<Real, N, Category> when no constants
+// are tabulated for Real and N. The table lives in a function local static, so it is computed once however many threads
+// ask for it at once, and is never replaced afterwards. A table installed before its first use, say one read from disk,
+// is taken in place of computing it; one installed later is dropped, as the table in use is already the same.
+//
+template <class Owner, class Real>
+class computed_gauss_rule
+{
+public:
+   template <class Make>
+   static const gauss_rule<Real>& get(Make make)
+   {
+      static const std::shared_ptr<const gauss_rule<Real> > rule = take_or_make(make);
+      return *rule;
+   }
+
+   static void install(const std::shared_ptr<const gauss_rule<Real> >& rule)
+   {
+      std::lock_guard<std::mutex> lock(mutex());
+      if (!in_use())
+      {
+         pending() = rule;
+      }
+   }
+
+private:
+   template <class Make>
+   static std::shared_ptr<const gauss_rule<Real> > take_or_make(Make make)
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex());
+         in_use() = true;
+         if (pending())
+         {
+            std::shared_ptr<const gauss_rule<Real> > rule;
+            rule.swap(pending());
+            return rule;
+         }
+      }
+      return make();
+   }
+   static std::mutex& mutex()
+   {
+      static std::mutex m;
+      return m;
+   }
+   static bool& in_use()
+   {
+      static bool b = false;
+      return b;
+   }
+   static std::shared_ptr<const gauss_rule<Real> >& pending()
+   {
+      static std::shared_ptr<const gauss_rule<Real> > p;
+      return p;
+   }
+};
+
+//
+// Tables are saved as plain text, one section for each rule:
+//
+//   <family> <points> <binary digits of Real> <number of rows> <typeid(Real).name()>
+//   <abscissa> <weight>
+//   ...
+//
+// with enough decimal digits that they read back exactly. A stream may hold the sections of many types, precisions and
+// rules, so that one file may serve a whole program; sections not for Real at its current precision are skipped.
+//
+template <class Real, class Abscissa, class Weights>
+void write_gauss_table(std::ostream& os, const char* family, unsigned points, const Abscissa& abscissa, const Weights& weights)
+{
+   std::ostringstream ss;
+   ss.precision(2 + tools::digits<Real>() * 30103L / 100000);
+   ss << family << " " << points << " " << tools::digits<Real>() << " " << abscissa.size() << " " << typeid(Real).name() << "\n";
+   for (std::size_t i = 0; i < abscissa.size(); ++i)
+   {
+      ss << abscissa[i] << " " << weights[i] << "\n";
+   }
+   os << ss.str();
+}
+
+//
+// Reads the sections of a stream written by write_gauss_table, and passes each one for Real to take(family, points, rule),
+// which returns true if it wanted the rule. Returns the number of rules taken; reading stops at the end of the stream,
+// or at the first malformed section.
+//
+template <class Real, class Take>
+unsigned read_gauss_tables(std::istream& is, Take take)
+{
+   std::string line;
+   unsigned taken = 0;
+   while (std::getline(is, line))
+   {
+      if (line.empty())
+      {
+         continue;
+      }
+      std::istringstream header(line);
+      std::string family;
+      unsigned points;
+      int digits;
+      std::size_t rows;
+      std::string type;
+      if (!(header >> family >> points >> digits >> rows) || !std::getline(header >> std::ws, type))
+      {
+         break;
+      }
+      bool wanted = (digits == tools::digits<Real>()) && (type == typeid(Real).name());
+      std::shared_ptr<gauss_rule<Real> > rule = std::make_shared<gauss_rule<Real> >();
+      rule->abscissa.reserve(wanted ? rows : 0);
+      rule->weights.reserve(wanted ? rows : 0);
+      for (std::size_t i = 0; (i < rows) && std::getline(is, line); ++i)
+      {
+         if (wanted)
+         {
+            std::istringstream row(line);
+            Real x;
+            Real w;
+            if (row >> x >> w)
+            {
+               rule->abscissa.push_back(x);
+               rule->weights.push_back(w);
+            }
+         }
+      }
+      if (wanted && (rule->abscissa.size() == rows) && take(family, points, std::shared_ptr<const gauss_rule<Real> >(rule)))
+      {
+         ++taken;
+      }
+   }
+   return taken;
+}
+
+}}}} // namespaces
+
+#endif
@@ -0,0 +1,280 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GOLUB_WELSCH_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GOLUB_WELSCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/gauss_tables.hpp>
+#include <boost/math/special_functions/hypot.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// The eigenvalues, in increasing order, of the symmetric tridiagonal matrix with diagonal d and off diagonal e,
+// e[i] coupling rows i and i+1, by the implicit QL algorithm with Wilkinson's shift (tql1 of EISPACK), in O(n^2) operations.
+// The eigenvalues overwrite d, and e is destroyed.
+//
+template <class Real, class Policy>
+void symmetric_tridiagonal_eigenvalues(std::vector<Real>& d, std::vector<Real>& e, const char* function, const Policy& pol)
+{
+   using std::abs;
+   std::size_t n = d.size();
+   e.resize(n, Real(0));
+   if (n > 0)
+   {
+      e[n - 1] = 0;
+   }
+   boost::uintmax_t max_iterations = policies::get_max_root_iterations<Policy>();
+   for (std::size_t l = 0; l < n; ++l)
+   {
+      boost::uintmax_t iterations = 0;
+      std::size_t m;
+      do
+      {
+         // Look for a negligible off diagonal element to split the matrix:
+         for (m = l; m + 1 < n; ++m)
+         {
+            Real dd = abs(d[m]) + abs(d[m + 1]);
+            if (abs(e[m]) <= tools::epsilon<Real>() * dd)
+            {
+               break;
+            }
+         }
+         if (m != l)
+         {
+            if (++iterations > max_iterations)
+            {
+               policies::raise_evaluation_error(function, "The eigenvalues of the Jacobi matrix did not converge, the last found was %1%.", d[l], pol);
+               return;
+            }
+            Real g = (d[l + 1] - d[l]) / (2 * e[l]);
+            Real r = boost::math::hypot(g, Real(1), pol);
+            g = d[m] - d[l] + e[l] / (g + (g < 0 ? -r : r));
+            Real s = 1;
+            Real c = 1;
+            Real p = 0;
+            bool deflated = false;
+            for (std::size_t i = m; i-- > l;)
+            {
+               Real f = s * e[i];
+               Real b = c * e[i];
+               r = boost::math::hypot(f, g, pol);
+               e[i + 1] = r;
+               if (r == 0)
+               {
+                  // Recover from underflow:
+                  d[i + 1] -= p;
+                  e[m] = 0;
+                  deflated = true;
+                  break;
+               }
+               s = f / r;
+               c = g / r;
+               g = d[i + 1] - p;
+               r = (d[i] - g) * s + 2 * c * b;
+               p = s * r;
+               d[i + 1] = g + p;
+               g = c * r - b;
+            }
+            if (deflated)
+            {
+               continue;
+            }
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0;
+         }
+      } while (m != l);
+   }
+   std::sort(d.begin(), d.end());
+}
+
+//
+// The orthonormal polynomials of a weight function of total mass mu0 satisfy p_0 = 1/sqrt(mu0) and
+//
+//   sqrt(b_{j+1}) p_{j+1}(x) = (x - a_j) p_j(x) - sqrt(b_j) p_{j-1}(x).
+//
+// Returns p_n(x) and p_n'(x), and sets *christoffel to the Gauss weight 1/sum_{j<n} p_j(x)^2 of the node nearest x.
+// The sum varies steeply near the ends of the interval, by O(n^2) relative to the spacing of the nodes, and should not be
+// taken at the rounded node: so it is moved to the exact node x - p_n(x)/p_n'(x) by its derivative, 2 sum_{j<n} p_j(x) p_j'(x).
+// The polynomials are rescaled whenever their squares grow large, so the weights of the outermost nodes of large rules,
+// such as those of Gauss-Hermite, underflow gracefully to zero rather than the sum overflowing.
+//
+template <class Real>
+std::pair<Real, Real> orthonormal_recurrence(const std::vector<Real>& a, const std::vector<Real>& sqrt_b, Real mu0, Real x, Real* christoffel)
+{
+   using std::sqrt;
+   std::size_t n = a.size();
+   Real big = sqrt(tools::max_value<Real>());
+   Real p0 = 0;
+   Real p1 = 1 / sqrt(mu0);
+   Real dp0 = 0;
+   Real dp1 = 0;
+   Real sum = 0;
+   Real dsum = 0;
+   Real scale = 1;
+   for (std::size_t j = 0; j < n; ++j)
+   {
+      sum += p1 * p1;
+      dsum += 2 * p1 * dp1;
+      if (sum > big)
+      {
+         Real r = sqrt(sum);
+         p0 /= r;
+         p1 /= r;
+         dp0 /= r;
+         dp1 /= r;
+         dsum /= sum;
+         sum = 1;
+         scale *= r;
+      }
+      Real p2 = ((x - a[j]) * p1 - sqrt_b[j] * p0) / sqrt_b[j + 1];
+      Real dp2 = (p1 + (x - a[j]) * dp1 - sqrt_b[j] * dp0) / sqrt_b[j + 1];
+      p0 = p1;
+      p1 = p2;
+      dp0 = dp1;
+      dp1 = dp2;
+   }
+   Real residual = (dp1 == 0) ? Real(0) : p1 / dp1;
+   *christoffel = 1 / ((sum - dsum * residual) * scale * scale);
+   return std::make_pair(p1, dp1);
+}
+
+//
+// The n point Gauss rule of the weight function whose orthonormal polynomials have the recurrence coefficients
+// a_0, ..., a_{n-1} and sqrt(b_0), ..., sqrt(b_n), with sqrt(b_0) = 0, and whose total mass is mu0.
+// The nodes are the eigenvalues of the Jacobi matrix, as Golub and Welsch observed; we take the eigenvalues only,
+// whose absolute errors are those of the largest of them, and polish each by Newton's method on the recurrence,
+// then take its weight from the Christoffel function, rather than from the first components of the eigenvectors,
+// so that the small nodes and the small weights both have small relative errors. All this costs O(n^2) operations.
+// When the weight function is even, only the non-negative nodes are polished, and the rest mirror them exactly.
+//
+template <class Real, class Policy>
+std::shared_ptr<const gauss_rule<Real> > golub_welsch(const std::vector<Real>& a, const std::vector<Real>& sqrt_b, Real mu0, bool even, const char* function, const Policy& pol)
+{
+   using std::abs;
+   std::size_t n = a.size();
+   std::shared_ptr<gauss_rule<Real> > rule = std::make_shared<gauss_rule<Real> >();
+   rule->abscissa = a;
+   std::vector<Real> e(sqrt_b.begin() + 1, sqrt_b.end() - 1);
+   symmetric_tridiagonal_eigenvalues(rule->abscissa, e, function, pol);
+   rule->weights.assign(n, Real(0));
+   Real root_eps = tools::root_epsilon<Real>();
+   boost::uintmax_t max_iterations = policies::get_max_root_iterations<Policy>();
+   for (std::size_t k = even ? n / 2 : 0; k < n; ++k)
+   {
+      Real x = even && (n & 1) && (k == n / 2) ? Real(0) : rule->abscissa[k];
+      Real w;
+      bool last = false;
+      for (boost::uintmax_t i = 0;; ++i)
+      {
+         std::pair<Real, Real> p = orthonormal_recurrence(a, sqrt_b, mu0, x, &w);
+         if (last || (p.first == 0) || (i == max_iterations))
+         {
+            break;
+         }
+         Real delta = p.first / p.second;
+         last = abs(delta) <= root_eps * abs(x);
+         x -= delta;
+      }
+      rule->abscissa[k] = x;
+      rule->weights[k] = w;
+      if (even)
+      {
+         rule->abscissa[n - 1 - k] = -x;
+         rule->weights[n - 1 - k] = w;
+      }
+   }
+   return rule;
+}
+
+//
+// The rules already computed, for each family of weight functions and each type, keyed by the order, up to two parameters of the weight function,
+// and the precision, which may change at runtime for some multiprecision types. The lock is held only to look up and to insert;
+// should two threads ask for the same new rule at once, both compute it and the first to finish is kept, so that a rule
+// once handed out is never replaced. The rules are shared, so they outlive any quadrature object which holds them.
+//
+template <class Family, class Real>
+class gauss_rule_cache
+{
+public:
+   typedef std::tuple<unsigned, Real, Real, int> key_type;
+
+   template <class Make>
+   static std::shared_ptr<const gauss_rule<Real> > get(unsigned n, Real alpha, Real beta, Make make)
+   {
+      key_type key(n, alpha, beta, tools::digits<Real>());
+      {
+         std::lock_guard<std::mutex> lock(mutex());
+         auto it = rules().find(key);
+         if (it != rules().end())
+         {
+            return it->second;
+         }
+      }
+      std::shared_ptr<const gauss_rule<Real> > rule = make();
+      std::lock_guard<std::mutex> lock(mutex());
+      return rules().insert(std::make_pair(key, rule)).first->second;
+   }
+
+   static std::size_t size()
+   {
+      std::lock_guard<std::mutex> lock(mutex());
+      return rules().size();
+   }
+
+   static void clear()
+   {
+      std::lock_guard<std::mutex> lock(mutex());
+      rules().clear();
+   }
+
+private:
+   static std::mutex& mutex()
+   {
+      static std::mutex m;
+      return m;
+   }
+   static std::map<key_type, std::shared_ptr<const gauss_rule<Real> > >& rules()
+   {
+      static std::map<key_type, std::shared_ptr<const gauss_rule<Real> > > r;
+      return r;
+   }
+};
+
+//
+// sum_k w_k f(x_k), and its L1 norm.
+//
+template <class Real, class F>
+auto gauss_rule_sum(F f, const gauss_rule<Real>& rule, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   K result = Real(0);
+   Real L1 = 0;
+   for (std::size_t i = 0; i < rule.abscissa.size(); ++i)
+   {
+      K y = f(rule.abscissa[i]);
+      result += y * rule.weights[i];
+      L1 += abs(y) * rule.weights[i];
+   }
+   if (pL1)
+      *pL1 = L1;
+   return result;
+}
+
+}}}} // namespaces
+
+#endif
@@ -10,9 +10,15 @@
 #pragma once
 #endif
 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/detail/gauss_tables.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -43,27 +49,33 @@ struct gauss_constant_category
 template <class Real, unsigned N, unsigned Category>
 class gauss_detail
 {
-   static std::vector<Real> calculate_weights()
+   typedef computed_gauss_rule<gauss_detail, Real> computed;
+
+   static std::shared_ptr<const gauss_rule<Real> > calculate()
    {
-      std::vector<Real> result(abscissa().size(), 0);
-      for (unsigned i = 0; i < abscissa().size(); ++i)
+      std::shared_ptr<gauss_rule<Real> > result = std::make_shared<gauss_rule<Real> >();
+      result->abscissa = boost::math::legendre_p_zeros<Real>(N);
+      result->weights.resize(result->abscissa.size());
+      for (unsigned i = 0; i < result->abscissa.size(); ++i)
       {
-         Real x = abscissa()[i];
+         Real x = result->abscissa[i];
          Real p = boost::math::legendre_p_prime(N, x);
-         result[i] = 2 / ((1 - x * x) * p * p);
+         result->weights[i] = 2 / ((1 - x * x) * p * p);
       }
       return result;
    }
 public:
    static const std::vector<Real>& abscissa()
    {
-      static std::vector<Real> data = boost::math::legendre_p_zeros<Real>(N);
-      return data;
+      return computed::get(&calculate).abscissa;
    }
    static const std::vector<Real>& weights()
    {
-      static std::vector<Real> data = calculate_weights();
-      return data;
+      return computed::get(&calculate).weights;
+   }
+   static void install(const std::shared_ptr<const gauss_rule<Real> >& rule)
+   {
+      computed::install(rule);
    }
 };
 
@@ -1164,121 +1176,186 @@ public:
    }
 };
 
+//
+// A table read from a stream is installed in a detail class which computes its table on first use; the tabulated
+// rules have nothing to gain from it. take_gauss_rule returns true if the section read is the rule of the family and order wanted,
+// each of which stores its (points + 1) / 2 non-negative abscissa.
+//
+template <class Base, class Real>
+void install_gauss_rule(const std::shared_ptr<const gauss_rule<Real> >& rule, const std::true_type&)
+{
+   Base::install(rule);
+}
+template <class Base, class Real>
+void install_gauss_rule(const std::shared_ptr<const gauss_rule<Real> >&, const std::false_type&)
+{
+}
+template <class Base, class Real>
+bool take_gauss_rule(const std::string& family, unsigned points, const std::shared_ptr<const gauss_rule<Real> >& rule, const char* wanted_family, unsigned wanted_points)
+{
+   if ((family != wanted_family) || (points != wanted_points) || (rule->abscissa.size() != (wanted_points + 1) / 2))
+   {
+      return false;
+   }
+   typedef std::is_same<typename std::decay<decltype(Base::abscissa())>::type, std::vector<Real> > is_computed;
+   install_gauss_rule<Base>(rule, is_computed());
+   return true;
 }
 
-template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
-class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value>
+//
+// The sum over a Legendre rule whose non-negative abscissa are stored in increasing order, with zero first when the order is odd:
+//
+template <class Real, class F, class Abscissa, class Weights>
+auto gauss_sum(F f, const Abscissa& abscissa, const Weights& weights, bool odd, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
 {
-   typedef detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value> base;
-public:
+  // In many math texts, K represents the field of real or complex numbers.
+  // Too bad we can't put blackboard bold into C++ source!
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   unsigned non_zero_start = 1;
+   K result = Real(0);
+   if (odd) {
+      result = f(Real(0)) * weights[0];
+   }
+   else {
+      result = 0;
+      non_zero_start = 0;
+   }
+   Real L1 = abs(result);
+   for (unsigned i = non_zero_start; i < abscissa.size(); ++i)
+   {
+      K fp = f(abscissa[i]);
+      K fm = f(-abscissa[i]);
+      result += (fp + fm) * weights[i];
+      L1 += (abs(fp) + abs(fm)) *  weights[i];
+   }
+   if (pL1)
+      *pL1 = L1;
+   return result;
+}
 
-   template <class F>
-   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+//
+// Maps [a, b], which may be infinite at either end, onto [-1, 1] and applies rule.integrate(f, pL1) there:
+//
+template <class Real, class Policy, class Rule, class F>
+auto gauss_integrate_interval(const Rule& rule, F f, Real a, Real b, Real* pL1, const char* function)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(a)) K;
+   if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
    {
-     // In many math texts, K represents the field of real or complex numbers.
-     // Too bad we can't put blackboard bold into C++ source!
-      typedef decltype(f(Real(0))) K;
-      using std::abs;
-      unsigned non_zero_start = 1;
-      K result = Real(0);
-      if (N & 1) {
-         result = f(Real(0)) * base::weights()[0];
-      }
-      else {
-         result = 0;
-         non_zero_start = 0;
-      }
-      Real L1 = abs(result);
-      for (unsigned i = non_zero_start; i < base::abscissa().size(); ++i)
+      // Infinite limits:
+      Real min_inf = -tools::max_value<Real>();
+      if ((a <= min_inf) && (b >= tools::max_value<Real>()))
       {
-         K fp = f(base::abscissa()[i]);
-         K fm = f(-base::abscissa()[i]);
-         result += (fp + fm) * base::weights()[i];
-         L1 += (abs(fp) + abs(fm)) *  base::weights()[i];
+         auto u = [&](const Real& t)->K
+         {
+            Real t_sq = t*t;
+            Real inv = 1 / (1 - t_sq);
+            K res = f(t*inv)*(1 + t_sq)*inv*inv;
+            return res;
+         };
+         return rule.integrate(u, pL1);
       }
-      if (pL1)
-         *pL1 = L1;
-      return result;
-   }
-   template <class F>
-   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
-   {
-      typedef decltype(f(a)) K;
-      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+
+      // Right limit is infinite:
+      if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
       {
-         // Infinite limits:
-         Real min_inf = -tools::max_value<Real>();
-         if ((a <= min_inf) && (b >= tools::max_value<Real>()))
+         auto u = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z + a - 1;
+            K res = f(arg)*z*z;
+            return res;
+         };
+         K Q = Real(2) * rule.integrate(u, pL1);
+         if (pL1)
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               K res = f(t*inv)*(1 + t_sq)*inv*inv;
-               return res;
-            };
-            return integrate(u, pL1);
+            *pL1 *= 2;
          }
+         return Q;
+      }
 
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         auto v = [&](const Real& t)->K
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            K Q = Real(2) * integrate(u, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z - 1;
+            K res = f(b - arg) * z * z;
+            return res;
+         };
+         K Q = Real(2) * rule.integrate(v, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
          }
+         return Q;
+      }
 
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (b <= a)
          {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               K res = f(b - arg) * z * z;
-               return res;
-            };
-            K Q = Real(2) * integrate(v, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            return policies::raise_domain_error(function, "Arguments to integrate are in wrong order; integration over [a,b] must have b > a.", a, Policy());
          }
+         Real avg = (a + b)*constants::half<Real>();
+         Real scale = (b - a)*constants::half<Real>();
 
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+         auto u = [&](Real z)->K
          {
-            if (b <= a)
-            {
-               return policies::raise_domain_error(function, "Arguments to integrate are in wrong order; integration over [a,b] must have b > a.", a, Policy());
-            }
-            Real avg = (a + b)*constants::half<Real>();
-            Real scale = (b - a)*constants::half<Real>();
-
-            auto u = [&](Real z)->K
-            {
-               return f(avg + scale*z);
-            };
-            K Q = scale*integrate(u, pL1);
+            return f(avg + scale*z);
+         };
+         K Q = scale*rule.integrate(u, pL1);
 
-            if (pL1)
-            {
-               *pL1 *= scale;
-            }
-            return Q;
+         if (pL1)
+         {
+            *pL1 *= scale;
          }
+         return Q;
       }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+   }
+   return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+}
+
+}
+
+template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
+class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value>
+{
+   typedef detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value> base;
+public:
+
+   // Computes the abscissa and weights now, when they are not tabulated, rather than on first use:
+   static void precompute()
+   {
+      base::abscissa();
+      base::weights();
+   }
+   // Writes the abscissa and weights to a stream, whence load_tables may read them back in another run of the program:
+   static void save_tables(std::ostream& os)
+   {
+      detail::write_gauss_table<Real>(os, "gauss", N, base::abscissa(), base::weights());
+   }
+   // Reads tables written by save_tables; they are used in place of computing them, if called before their first use.
+   // Returns false if the stream holds no tables for this order, type and precision:
+   static bool load_tables(std::istream& is)
+   {
+      return detail::read_gauss_tables<Real>(is, [](const std::string& family, unsigned points, const std::shared_ptr<const detail::gauss_rule<Real> >& rule)
+      {
+         return detail::take_gauss_rule<base>(family, points, rule, "gauss", N);
+      }) != 0;
+   }
+
+   template <class F>
+   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_sum(f, base::abscissa(), base::weights(), (N & 1) != 0, pL1);
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
+      return detail::gauss_integrate_interval<Real, Policy>(gauss(), f, a, b, pL1, function);
    }
 };
 
@@ -0,0 +1,74 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_HERMITE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_HERMITE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/golub_welsch.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// The n point Gauss-Hermite rule, which integrates f(x) exp(-x^2) over the real line, and is exact when f is a polynomial of degree less than 2n.
+// Its nodes are the zeros of hermite(n, x). The rules are computed on first use and cached, so constructing one of the same order again is cheap.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_hermite
+{
+public:
+   explicit gauss_hermite(unsigned n)
+   {
+      static const char* function = "boost::math::quadrature::gauss_hermite<%1%>::gauss_hermite(unsigned)";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got %1%.", Real(n), Policy());
+         m_rule = std::make_shared<detail::gauss_rule<Real> >();
+         return;
+      }
+      m_rule = detail::gauss_rule_cache<gauss_hermite, Real>::get(n, Real(0), Real(0), [n]()
+      {
+         using std::sqrt;
+         // H_{j+1}(x) = 2x H_j(x) - 2j H_{j-1}(x), so a_j = 0 and b_j = j/2:
+         std::vector<Real> a(n, Real(0));
+         std::vector<Real> sqrt_b(n + 1);
+         for (unsigned j = 0; j <= n; ++j)
+         {
+            sqrt_b[j] = sqrt(Real(j) / 2);
+         }
+         return detail::golub_welsch(a, sqrt_b, constants::root_pi<Real>(), true, function, Policy());
+      });
+   }
+
+   unsigned order() const { return static_cast<unsigned>(m_rule->abscissa.size()); }
+   // All n nodes in increasing order, and their weights:
+   const std::vector<Real>& abscissa() const { return m_rule->abscissa; }
+   const std::vector<Real>& weights() const { return m_rule->weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_rule_sum(f, *m_rule, pL1);
+   }
+
+   // The number of rules of this type held in the cache, and a means of releasing them:
+   static std::size_t cache_size() { return detail::gauss_rule_cache<gauss_hermite, Real>::size(); }
+   static void clear_cache() { detail::gauss_rule_cache<gauss_hermite, Real>::clear(); }
+
+private:
+   std::shared_ptr<const detail::gauss_rule<Real> > m_rule;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_HERMITE_HPP
@@ -0,0 +1,98 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_JACOBI_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_JACOBI_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/golub_welsch.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// The n point Gauss-Jacobi rule, which integrates f(x) (1-x)^alpha (1+x)^beta over (-1, 1), for alpha, beta > -1,
+// and is exact when f is a polynomial of degree less than 2n. Its nodes are the zeros of jacobi(n, alpha, beta, x).
+// The rules are computed on first use and cached by order, alpha and beta, so constructing the same one again is cheap.
+// For alpha = beta = 0 the O(n) gauss_legendre is much faster at large orders.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_jacobi
+{
+public:
+   gauss_jacobi(unsigned n, Real alpha, Real beta)
+   {
+      static const char* function = "boost::math::quadrature::gauss_jacobi<%1%>::gauss_jacobi(unsigned, %1%, %1%)";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got %1%.", Real(n), Policy());
+         m_rule = std::make_shared<detail::gauss_rule<Real> >();
+         return;
+      }
+      if (!(alpha > -1) || !(boost::math::isfinite)(alpha) || !(beta > -1) || !(boost::math::isfinite)(beta))
+      {
+         policies::raise_domain_error(function, "The exponents alpha and beta must be finite and greater than -1, but alpha = %1%.", alpha, Policy());
+         m_rule = std::make_shared<detail::gauss_rule<Real> >();
+         return;
+      }
+      m_rule = detail::gauss_rule_cache<gauss_jacobi, Real>::get(n, alpha, beta, [n, alpha, beta]()
+      {
+         using std::sqrt;
+         using std::pow;
+         Real ab = alpha + beta;
+         std::vector<Real> a(n);
+         std::vector<Real> sqrt_b(n + 1);
+         // The recurrence of jacobi.hpp, normalized:
+         //   a_j = (beta^2 - alpha^2)/((2j+ab)(2j+ab+2)),
+         //   b_j = 4j(j+alpha)(j+beta)(j+ab)/((2j+ab)^2 (2j+ab+1)(2j+ab-1)),
+         // where the factors j+ab and 2j+ab-1 of b_1, and 2j+ab of a_0, may cancel, and are taken out by hand.
+         a[0] = (beta - alpha) / (ab + 2);
+         for (unsigned j = 1; j < n; ++j)
+         {
+            a[j] = (beta - alpha) * (beta + alpha) / ((2 * j + ab) * (2 * j + ab + 2));
+         }
+         sqrt_b[0] = 0;
+         for (unsigned j = 1; j <= n; ++j)
+         {
+            Real s = 2 * j + ab;
+            Real b = (j == 1) ? 4 * (1 + alpha) * (1 + beta) / ((ab + 2) * (ab + 2) * (ab + 3))
+                              : 4 * j * (j + alpha) * (j + beta) * (j + ab) / (s * s * (s + 1) * (s - 1));
+            sqrt_b[j] = sqrt(b);
+         }
+         Real mu0 = pow(Real(2), ab + 1) * boost::math::beta(alpha + 1, beta + 1, Policy());
+         return detail::golub_welsch(a, sqrt_b, mu0, alpha == beta, function, Policy());
+      });
+   }
+
+   unsigned order() const { return static_cast<unsigned>(m_rule->abscissa.size()); }
+   // The n nodes in increasing order, and their weights:
+   const std::vector<Real>& abscissa() const { return m_rule->abscissa; }
+   const std::vector<Real>& weights() const { return m_rule->weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_rule_sum(f, *m_rule, pL1);
+   }
+
+   // The number of rules of this type held in the cache, and a means of releasing them:
+   static std::size_t cache_size() { return detail::gauss_rule_cache<gauss_jacobi, Real>::size(); }
+   static void clear_cache() { detail::gauss_rule_cache<gauss_jacobi, Real>::clear(); }
+
+private:
+   std::shared_ptr<const detail::gauss_rule<Real> > m_rule;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_JACOBI_HPP
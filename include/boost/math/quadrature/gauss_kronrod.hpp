@@ -13,6 +13,11 @@
 #pragma warning(disable: 4127)
 #endif
 
+#include <algorithm>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/special_functions/legendre_stieltjes.hpp>
@@ -25,51 +30,48 @@ namespace boost { namespace math{ namespace quadrature{ namespace detail{
 template <class Real, unsigned N, unsigned tag>
 class gauss_kronrod_detail
 {
-   static legendre_stieltjes<Real> const& get_legendre_stieltjes()
-   {
-      static const legendre_stieltjes<Real> data((N - 1) / 2 + 1);
-      return data;
-   }
-   static std::vector<Real> calculate_abscissa()
-   {
-      static std::vector<Real> result = boost::math::legendre_p_zeros<Real>((N - 1) / 2);
-      const legendre_stieltjes<Real> E = get_legendre_stieltjes();
-      std::vector<Real> ls_zeros = E.zeros();
-      result.insert(result.end(), ls_zeros.begin(), ls_zeros.end());
-      std::sort(result.begin(), result.end());
-      return result;
-   }
-   static std::vector<Real> calculate_weights()
+   typedef computed_gauss_rule<gauss_kronrod_detail, Real> computed;
+
+   static std::shared_ptr<const gauss_rule<Real> > calculate()
    {
-      std::vector<Real> result(abscissa().size(), 0);
+      std::shared_ptr<gauss_rule<Real> > result = std::make_shared<gauss_rule<Real> >();
       unsigned gauss_order = (N - 1) / 2;
-      unsigned gauss_start = gauss_order & 1 ? 0 : 1;
-      const legendre_stieltjes<Real>& E = get_legendre_stieltjes();
+      const legendre_stieltjes<Real> E(gauss_order + 1);
+      std::vector<Real>& abscissa = result->abscissa;
+      abscissa = boost::math::legendre_p_zeros<Real>(gauss_order);
+      std::vector<Real> ls_zeros = E.zeros();
+      abscissa.insert(abscissa.end(), ls_zeros.begin(), ls_zeros.end());
+      std::sort(abscissa.begin(), abscissa.end());
 
-      for (unsigned i = gauss_start; i < abscissa().size(); i += 2)
+      std::vector<Real>& weights = result->weights;
+      weights.assign(abscissa.size(), Real(0));
+      unsigned gauss_start = gauss_order & 1 ? 0 : 1;
+      for (unsigned i = gauss_start; i < abscissa.size(); i += 2)
       {
-         Real x = abscissa()[i];
+         Real x = abscissa[i];
          Real p = boost::math::legendre_p_prime(gauss_order, x);
          Real gauss_weight = 2 / ((1 - x * x) * p * p);
-         result[i] = gauss_weight + static_cast<Real>(2) / (static_cast<Real>(gauss_order + 1) * legendre_p_prime(gauss_order, x) * E(x));
+         weights[i] = gauss_weight + static_cast<Real>(2) / (static_cast<Real>(gauss_order + 1) * legendre_p_prime(gauss_order, x) * E(x));
       }
-      for (unsigned i = gauss_start ? 0 : 1; i < abscissa().size(); i += 2)
+      for (unsigned i = gauss_start ? 0 : 1; i < abscissa.size(); i += 2)
       {
-         Real x = abscissa()[i];
-         result[i] = static_cast<Real>(2) / (static_cast<Real>(gauss_order + 1) * legendre_p(gauss_order, x) * E.prime(x));
+         Real x = abscissa[i];
+         weights[i] = static_cast<Real>(2) / (static_cast<Real>(gauss_order + 1) * legendre_p(gauss_order, x) * E.prime(x));
       }
       return result;
    }
 public:
    static const std::vector<Real>& abscissa()
    {
-      static std::vector<Real> data = calculate_abscissa();
-      return data;
+      return computed::get(&calculate).abscissa;
    }
    static const std::vector<Real>& weights()
    {
-      static std::vector<Real> data = calculate_weights();
-      return data;
+      return computed::get(&calculate).weights;
+   }
+   static void install(const std::shared_ptr<const gauss_rule<Real> >& rule)
+   {
+      computed::install(rule);
    }
 };
 
@@ -1865,6 +1867,42 @@ private:
    }
 
 public:
+   // Computes the abscissa and weights of both this rule and the Gauss rule embedded in it now, when they are not tabulated,
+   // rather than on first use:
+   static void precompute()
+   {
+      base::abscissa();
+      base::weights();
+      gauss<Real, (N - 1) / 2, Policy>::precompute();
+   }
+   // Writes the tables of both rules to a stream, whence load_tables may read them back in another run of the program:
+   static void save_tables(std::ostream& os)
+   {
+      detail::write_gauss_table<Real>(os, "gauss_kronrod", N, base::abscissa(), base::weights());
+      gauss<Real, (N - 1) / 2, Policy>::save_tables(os);
+   }
+   // Reads tables written by save_tables; they are used in place of computing them, if called before their first use.
+   // Returns false unless the stream holds the tables of both rules for this type and precision:
+   static bool load_tables(std::istream& is)
+   {
+      typedef detail::gauss_detail<Real, (N - 1) / 2, detail::gauss_constant_category<Real>::value> gauss_base;
+      bool kronrod_found = false;
+      bool gauss_found = false;
+      detail::read_gauss_tables<Real>(is, [&](const std::string& family, unsigned points, const std::shared_ptr<const detail::gauss_rule<Real> >& rule)
+      {
+         if (detail::take_gauss_rule<base>(family, points, rule, "gauss_kronrod", N))
+         {
+            return kronrod_found = true;
+         }
+         if (detail::take_gauss_rule<gauss_base>(family, points, rule, "gauss", (N - 1) / 2))
+         {
+            return gauss_found = true;
+         }
+         return false;
+      });
+      return kronrod_found && gauss_found;
+   }
+
    template <class F>
    static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
    {
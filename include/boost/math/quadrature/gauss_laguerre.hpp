@@ -0,0 +1,86 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_LAGUERRE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_LAGUERRE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/quadrature/detail/golub_welsch.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// The n point generalized Gauss-Laguerre rule, which integrates f(x) x^alpha exp(-x) over (0, infinity), for alpha > -1,
+// and is exact when f is a polynomial of degree less than 2n. Its nodes are the zeros of the associated Laguerre polynomial L_n^alpha.
+// The rules are computed on first use and cached by order and alpha, so constructing the same one again is cheap.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_laguerre
+{
+public:
+   explicit gauss_laguerre(unsigned n, Real alpha = 0)
+   {
+      static const char* function = "boost::math::quadrature::gauss_laguerre<%1%>::gauss_laguerre(unsigned, %1%)";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got %1%.", Real(n), Policy());
+         m_rule = std::make_shared<detail::gauss_rule<Real> >();
+         return;
+      }
+      if (!(alpha > -1) || !(boost::math::isfinite)(alpha))
+      {
+         policies::raise_domain_error(function, "The exponent alpha must be finite and greater than -1, but got %1%.", alpha, Policy());
+         m_rule = std::make_shared<detail::gauss_rule<Real> >();
+         return;
+      }
+      m_rule = detail::gauss_rule_cache<gauss_laguerre, Real>::get(n, alpha, Real(0), [n, alpha]()
+      {
+         using std::sqrt;
+         // (j+1) L_{j+1}(x) = (2j+alpha+1-x) L_j(x) - (j+alpha) L_{j-1}(x), so a_j = 2j+alpha+1 and b_j = j(j+alpha):
+         std::vector<Real> a(n);
+         std::vector<Real> sqrt_b(n + 1);
+         for (unsigned j = 0; j <= n; ++j)
+         {
+            if (j < n)
+            {
+               a[j] = 2 * j + alpha + 1;
+            }
+            sqrt_b[j] = sqrt(j * (j + alpha));
+         }
+         return detail::golub_welsch(a, sqrt_b, boost::math::tgamma(alpha + 1, Policy()), false, function, Policy());
+      });
+   }
+
+   unsigned order() const { return static_cast<unsigned>(m_rule->abscissa.size()); }
+   // The n nodes in increasing order, and their weights:
+   const std::vector<Real>& abscissa() const { return m_rule->abscissa; }
+   const std::vector<Real>& weights() const { return m_rule->weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_rule_sum(f, *m_rule, pL1);
+   }
+
+   // The number of rules of this type held in the cache, and a means of releasing them:
+   static std::size_t cache_size() { return detail::gauss_rule_cache<gauss_laguerre, Real>::size(); }
+   static void clear_cache() { detail::gauss_rule_cache<gauss_laguerre, Real>::clear(); }
+
+private:
+   std::shared_ptr<const detail::gauss_rule<Real> > m_rule;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_LAGUERRE_HPP
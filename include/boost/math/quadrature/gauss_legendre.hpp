@@ -0,0 +1,65 @@
+//  Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/detail/gauss_legendre_asymptotic.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// The Gauss-Legendre rule of an order chosen at runtime. gauss<Real, N> tabulates its rules, or finds them by legendre_p_zeros
+// in O(N^2) operations; this class generates them in O(n) operations, from the asymptotic expansion of the Legendre polynomials,
+// so that orders in the millions are practical.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_legendre
+{
+public:
+   explicit gauss_legendre(unsigned n, unsigned threads = std::thread::hardware_concurrency()) : m_order(n)
+   {
+      static const char* function = "boost::math::quadrature::gauss_legendre<%1%>::gauss_legendre(unsigned, unsigned)";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got %1%.", Real(n), Policy());
+         return;
+      }
+      detail::gauss_legendre_nodes_and_weights(n, m_abscissa, m_weights, threads, Policy());
+   }
+
+   unsigned order() const { return m_order; }
+   // The non-negative abscissa in increasing order, and their weights, as gauss<Real, N> stores them:
+   const std::vector<Real>& abscissa() const { return m_abscissa; }
+   const std::vector<Real>& weights() const { return m_weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_sum(f, m_abscissa, m_weights, (m_order & 1) != 0, pL1);
+   }
+   template <class F>
+   auto integrate(F f, Real a, Real b, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss_legendre<%1%>::integrate(f, %1%, %1%)";
+      return detail::gauss_integrate_interval<Real, Policy>(*this, f, a, b, pL1, function);
+   }
+
+private:
+   unsigned m_order;
+   std::vector<Real> m_abscissa;
+   std::vector<Real> m_weights;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
@@ -138,6 +138,30 @@ inline OutputIterator tangent_t2n(const int start_index,
    return boost::math::tangent_t2n<T, OutputIterator>(start_index, number_of_tangent_t2n, out_it, policies::policy<>());
 }
 
+//
+// Calculates the first number_of_bernoullis_b2n Bernoulli and tangent numbers of type T now, rather than
+// as they are first needed, sharing the work between up to `threads` threads (threads = 0 uses one thread
+// per hardware thread).  Reading values already calculated never takes a lock, so calling this at startup
+// stops threads which later need high index values from waiting on each other to calculate them.
+//
+template <class T>
+inline void prefill_bernoulli_b2n(const unsigned number_of_bernoullis_b2n, unsigned threads)
+{
+#ifdef BOOST_MATH_PARALLEL_TANGENT_NUMBERS
+   if(threads == 0)
+      threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+#else
+   threads = 1;
+#endif
+   boost::math::detail::get_bernoulli_numbers_cache<T, policies::policy<> >().prefill(number_of_bernoullis_b2n, threads);
+}
+
+template <class T>
+inline void prefill_bernoulli_b2n(const unsigned number_of_bernoullis_b2n)
+{
+   boost::math::prefill_bernoulli_b2n<T>(number_of_bernoullis_b2n, 0u);
+}
+
 } } // namespace boost::math
 
 #endif // _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
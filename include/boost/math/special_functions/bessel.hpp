@@ -16,6 +16,7 @@
 #endif
 
 #include <limits>
+#include <vector>
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/special_functions/detail/bessel_jy.hpp>
 #include <boost/math/special_functions/detail/bessel_jn.hpp>
@@ -343,6 +344,204 @@ inline T sph_neumann_imp(unsigned v, T x, const Policy& pol)
    return result * tx;
 }
 
+//
+// The orders v0, v0 + 1, ..., v0 + n - 1 of each function at one x, from no more than two evaluations of the function itself
+// and the three term recurrence
+//
+//    C_{v-1}(x) + C_{v+1}(x) = (2v / x) C_v(x)
+//
+// (with the sign of C_{v+1} reversed for I and K) run in whichever direction is stable. The recurrences need v0 >= 0 and x > 0,
+// or x < 0 for J and I of integer order, by reflection; in any other case each order is evaluated separately,
+// which raises whatever errors the single functions raise.
+//
+template <class T>
+bool bessel_sequence_by_recurrence(T v0, unsigned n, T x, bool reflectable)
+{
+   BOOST_MATH_STD_USING
+   if ((n < 2) || !(v0 >= 0) || !(boost::math::isfinite)(x) || (x == 0) || ((x < 0) && !(reflectable && (floor(v0) == v0))))
+   {
+      return false;
+   }
+   // 2v / x must not overflow:
+   return abs(x) > 4 * (v0 + n) / tools::max_value<T>();
+}
+
+template <class T>
+void bessel_sequence_reflect(T v0, T x, std::vector<T>& result)
+{
+   BOOST_MATH_STD_USING
+   // C_n(-x) = (-1)^n C_n(x) for J and I of integer order:
+   if (x < 0)
+   {
+      for (std::size_t k = (floor(v0 / 2) == v0 / 2) ? 1 : 0; k < result.size(); k += 2)
+      {
+         result[k] = -result[k];
+      }
+   }
+}
+
+//
+// Miller's algorithm: J_v and I_v are the minimal solutions of their recurrences as v increases, so we start at the highest order,
+// from the ratio of continued fraction CF1, run the recurrence C_{v-1} = (2v / x) C_v + sign * C_{v+1} downwards, and normalise
+// the whole sequence once at the bottom. The unnormalised values grow downwards, and are rescaled whenever the next step might overflow.
+//
+template <class T>
+void bessel_sequence_backwards(T v0, T x, T ratio, int sign, std::vector<T>& result)
+{
+   BOOST_MATH_STD_USING
+   std::size_t n = result.size();
+   T current = 1;
+   T above = ratio;
+   result[n - 1] = current;
+   for (std::size_t k = n - 1; k > 0; --k)
+   {
+      T fact = 2 * (v0 + k) / x;
+      if ((fact > 1) && ((tools::max_value<T>() - abs(above)) / fact < abs(current)))
+      {
+         T scale = 1 / current;
+         for (std::size_t j = k; j < n; ++j)
+         {
+            result[j] *= scale;
+         }
+         above *= scale;
+         current = 1;
+      }
+      T below = fact * current + sign * above;
+      above = current;
+      current = below;
+      result[k - 1] = current;
+   }
+}
+
+template <class T, class Policy>
+void cyl_bessel_j_sequence_imp(T v0, unsigned n, T x, std::vector<T>& result, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   result.resize(n);
+   if (!bessel_sequence_by_recurrence(v0, n, x, true))
+   {
+      for (unsigned k = 0; k < n; ++k)
+      {
+         result[k] = cyl_bessel_j_imp(T(v0 + k), x, bessel_maybe_int_tag(), pol);
+      }
+      return;
+   }
+   T ax = abs(x);
+   T j0 = cyl_bessel_j_imp(v0, ax, bessel_maybe_int_tag(), pol);
+   T j1 = cyl_bessel_j_imp(T(v0 + 1), ax, bessel_maybe_int_tag(), pol);
+   if (v0 + n - 1 <= ax)
+   {
+      // Every order is below x, where J_v oscillates and the forward recurrence is as stable as the backward one, and needs no CF1:
+      result[0] = j0;
+      result[1] = j1;
+      for (unsigned k = 2; k < n; ++k)
+      {
+         result[k] = 2 * (v0 + k - 1) * result[k - 1] / ax - result[k - 2];
+      }
+   }
+   else
+   {
+      T ratio;
+      int s;
+      CF1_jy(T(v0 + n - 1), ax, &ratio, &s, pol);
+      bessel_sequence_backwards(v0, ax, ratio, -1, result);
+      // J_v0 and J_v0+1 have no zero in common, so normalising by the larger of them is always accurate:
+      T norm = abs(j0) >= abs(j1) ? T(j0 / result[0]) : T(j1 / result[1]);
+      for (unsigned k = 0; k < n; ++k)
+      {
+         result[k] *= norm;
+      }
+      result[0] = j0;
+      result[1] = j1;
+   }
+   bessel_sequence_reflect(v0, x, result);
+}
+
+template <class T, class Policy>
+void cyl_bessel_i_sequence_imp(T v0, unsigned n, T x, std::vector<T>& result, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   result.resize(n);
+   if (!bessel_sequence_by_recurrence(v0, n, x, true))
+   {
+      for (unsigned k = 0; k < n; ++k)
+      {
+         result[k] = cyl_bessel_i_imp(T(v0 + k), x, pol);
+      }
+      return;
+   }
+   T ax = abs(x);
+   T i0 = cyl_bessel_i_imp(v0, ax, pol);
+   T ratio;
+   CF1_ik(T(v0 + n - 1), ax, &ratio, pol);
+   bessel_sequence_backwards(v0, ax, ratio, 1, result);
+   T norm = i0 / result[0];
+   for (unsigned k = 0; k < n; ++k)
+   {
+      result[k] *= norm;
+   }
+   result[0] = i0;
+   bessel_sequence_reflect(v0, x, result);
+}
+
+//
+// Y_v and K_v are the dominant solutions as v increases, so the recurrence C_{v+1} = (2v / x) C_v + sign * C_{v-1} runs forwards
+// from the first two orders. They grow without bound, and once the next order would overflow, so do all the rest.
+//
+template <class T, class Policy>
+void bessel_sequence_forwards(T v0, T x, int sign, std::vector<T>& result, const char* function, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   for (std::size_t k = 2; k < result.size(); ++k)
+   {
+      T fact = 2 * (v0 + k - 1) / x;
+      if ((fact > 1) && ((tools::max_value<T>() - abs(result[k - 2])) / fact < abs(result[k - 1])))
+      {
+         T overflow = policies::raise_overflow_error<T>(function, 0, pol);
+         for (; k < result.size(); ++k)
+         {
+            result[k] = result[k - 1] < 0 ? T(-overflow) : overflow;
+         }
+         return;
+      }
+      result[k] = fact * result[k - 1] + sign * result[k - 2];
+   }
+}
+
+template <class T, class Policy>
+void cyl_neumann_sequence_imp(T v0, unsigned n, T x, std::vector<T>& result, const Policy& pol)
+{
+   result.resize(n);
+   if (!bessel_sequence_by_recurrence(v0, n, x, false))
+   {
+      for (unsigned k = 0; k < n; ++k)
+      {
+         result[k] = cyl_neumann_imp(T(v0 + k), x, bessel_maybe_int_tag(), pol);
+      }
+      return;
+   }
+   result[0] = cyl_neumann_imp(v0, x, bessel_maybe_int_tag(), pol);
+   result[1] = cyl_neumann_imp(T(v0 + 1), x, bessel_maybe_int_tag(), pol);
+   bessel_sequence_forwards(v0, x, -1, result, "boost::math::cyl_neumann_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class Policy>
+void cyl_bessel_k_sequence_imp(T v0, unsigned n, T x, std::vector<T>& result, const Policy& pol)
+{
+   result.resize(n);
+   if (!bessel_sequence_by_recurrence(v0, n, x, false))
+   {
+      for (unsigned k = 0; k < n; ++k)
+      {
+         result[k] = cyl_bessel_k_imp(T(v0 + k), x, bessel_maybe_int_tag(), pol);
+      }
+      return;
+   }
+   result[0] = cyl_bessel_k_imp(v0, x, bessel_maybe_int_tag(), pol);
+   result[1] = cyl_bessel_k_imp(T(v0 + 1), x, bessel_maybe_int_tag(), pol);
+   bessel_sequence_forwards(v0, x, 1, result, "boost::math::cyl_bessel_k_sequence<%1%>(%1%,%1%)", pol);
+}
+
 template <class T, class Policy>
 inline T cyl_bessel_j_zero_imp(T v, int m, const Policy& pol)
 {
@@ -501,6 +700,20 @@ inline T cyl_neumann_zero_imp(T v, int m, const Policy& pol)
    return yvm;
 }
 
+//
+// Narrows each element of a sequence to the result type, and writes it out:
+//
+template <class Result, class Policy, class T, class OutputIterator>
+OutputIterator bessel_sequence_copy(const std::vector<T>& values, OutputIterator out_it, const char* function)
+{
+   for (std::size_t k = 0; k < values.size(); ++k)
+   {
+      *out_it = policies::checked_narrowing_cast<Result, Policy>(values[k], function);
+      ++out_it;
+   }
+   return out_it;
+}
+
 } // namespace detail
 
 template <class T1, class T2, class Policy>
@@ -754,6 +967,98 @@ inline OutputIterator cyl_neumann_zero(T v,
    return cyl_neumann_zero(v, start_index, number_of_zeros, out_it, policies::policy<>());
 }
 
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_j_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values;
+   detail::cyl_bessel_j_sequence_imp(static_cast<value_type>(v0), number_of_orders, static_cast<value_type>(x), values, forwarding_policy());
+   return detail::bessel_sequence_copy<result_type, Policy>(values, out_it, "boost::math::cyl_bessel_j_sequence<%1%>(%1%,%1%)");
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_j_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_j_sequence(v0, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_neumann_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values;
+   detail::cyl_neumann_sequence_imp(static_cast<value_type>(v0), number_of_orders, static_cast<value_type>(x), values, forwarding_policy());
+   return detail::bessel_sequence_copy<result_type, Policy>(values, out_it, "boost::math::cyl_neumann_sequence<%1%>(%1%,%1%)");
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_neumann_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_neumann_sequence(v0, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_i_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values;
+   detail::cyl_bessel_i_sequence_imp(static_cast<value_type>(v0), number_of_orders, static_cast<value_type>(x), values, forwarding_policy());
+   return detail::bessel_sequence_copy<result_type, Policy>(values, out_it, "boost::math::cyl_bessel_i_sequence<%1%>(%1%,%1%)");
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_i_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_i_sequence(v0, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_k_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values;
+   detail::cyl_bessel_k_sequence_imp(static_cast<value_type>(v0), number_of_orders, static_cast<value_type>(x), values, forwarding_policy());
+   return detail::bessel_sequence_copy<result_type, Policy>(values, out_it, "boost::math::cyl_bessel_k_sequence<%1%>(%1%,%1%)");
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_k_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_k_sequence(v0, number_of_orders, x, out_it, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
@@ -0,0 +1,169 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Tables of the zeros of the Bessel and Airy functions for many orders and ranks at once,
+// computed by several threads. Requires C++11.
+//
+#ifndef BOOST_MATH_SF_BULK_ZEROS_HPP
+#define BOOST_MATH_SF_BULK_ZEROS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/airy.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+
+namespace boost { namespace math { namespace detail {
+
+//
+// Fills the rows x columns table, row by row, by calling block(row, column, count, out) for runs of up to
+// bulk_zeros_block consecutive columns of a row. The zeros are independent of one another, and each takes about
+// as long as the next, so the blocks are handed out in turn to up to `threads` threads; a block is large enough
+// that the cost of handing it out is lost in the cost of its zeros.
+//
+static const unsigned bulk_zeros_block = 64;
+
+template <class T, class Block>
+std::vector<T> bulk_zeros_table(std::size_t rows, unsigned columns, unsigned threads, Block block)
+{
+   std::vector<T> table(rows * columns);
+   const std::size_t blocks_per_row = (columns + bulk_zeros_block - 1) / bulk_zeros_block;
+   const std::size_t blocks = rows * blocks_per_row;
+   std::atomic<std::size_t> next(0);
+   auto work = [&]()
+   {
+      for (std::size_t b = next++; b < blocks; b = next++)
+      {
+         std::size_t row = b / blocks_per_row;
+         unsigned column = static_cast<unsigned>(b % blocks_per_row) * bulk_zeros_block;
+         unsigned count = (std::min)(bulk_zeros_block, columns - column);
+         block(row, column, count, &table[row * columns + column]);
+      }
+   };
+   threads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(threads), blocks));
+   if (threads <= 1)
+   {
+      work();
+      return table;
+   }
+   std::vector<std::thread> workers;
+   std::vector<std::exception_ptr> errors(threads);
+   for (unsigned t = 0; t < threads; ++t)
+   {
+      workers.emplace_back([&, t]()
+      {
+         try
+         {
+            work();
+         }
+         catch (...)
+         {
+            errors[t] = std::current_exception();
+            // Have the other threads stop at the end of their current block:
+            next = blocks;
+         }
+      });
+   }
+   for (auto& worker : workers)
+   {
+      worker.join();
+   }
+   for (auto const & e : errors)
+   {
+      if (e)
+      {
+         std::rethrow_exception(e);
+      }
+   }
+   return table;
+}
+
+} // namespace detail
+
+//
+// The zeros of ranks start_index, ..., start_index + number_of_zeros - 1 of J_v for each v in orders, as one table
+// stored row by row: element [i * number_of_zeros + k] is cyl_bessel_j_zero(orders[i], start_index + k).
+// Each element is exactly as the single zero functions return it.
+//
+template <class T, class Policy>
+std::vector<typename detail::bessel_traits<T, T, Policy>::result_type> cyl_bessel_j_zeros(const std::vector<T>& orders, int start_index, unsigned number_of_zeros, unsigned threads, const Policy& pol)
+{
+   typedef typename detail::bessel_traits<T, T, Policy>::result_type result_type;
+   return detail::bulk_zeros_table<result_type>(orders.size(), number_of_zeros, threads,
+      [&](std::size_t row, unsigned column, unsigned count, result_type* out)
+      {
+         boost::math::cyl_bessel_j_zero(orders[row], start_index + static_cast<int>(column), count, out, pol);
+      });
+}
+
+template <class T>
+std::vector<typename detail::bessel_traits<T, T, policies::policy<> >::result_type> cyl_bessel_j_zeros(const std::vector<T>& orders, int start_index, unsigned number_of_zeros, unsigned threads = std::thread::hardware_concurrency())
+{
+   return cyl_bessel_j_zeros(orders, start_index, number_of_zeros, threads, policies::policy<>());
+}
+
+template <class T, class Policy>
+std::vector<typename detail::bessel_traits<T, T, Policy>::result_type> cyl_neumann_zeros(const std::vector<T>& orders, int start_index, unsigned number_of_zeros, unsigned threads, const Policy& pol)
+{
+   typedef typename detail::bessel_traits<T, T, Policy>::result_type result_type;
+   return detail::bulk_zeros_table<result_type>(orders.size(), number_of_zeros, threads,
+      [&](std::size_t row, unsigned column, unsigned count, result_type* out)
+      {
+         boost::math::cyl_neumann_zero(orders[row], start_index + static_cast<int>(column), count, out, pol);
+      });
+}
+
+template <class T>
+std::vector<typename detail::bessel_traits<T, T, policies::policy<> >::result_type> cyl_neumann_zeros(const std::vector<T>& orders, int start_index, unsigned number_of_zeros, unsigned threads = std::thread::hardware_concurrency())
+{
+   return cyl_neumann_zeros(orders, start_index, number_of_zeros, threads, policies::policy<>());
+}
+
+//
+// The zeros of ranks start_index, ..., start_index + number_of_zeros - 1 of Ai and Bi:
+//
+template <class T, class Policy>
+std::vector<T> airy_ai_zeros(int start_index, unsigned number_of_zeros, unsigned threads, const Policy& pol)
+{
+   return detail::bulk_zeros_table<T>(1, number_of_zeros, threads,
+      [&](std::size_t, unsigned column, unsigned count, T* out)
+      {
+         boost::math::airy_ai_zero<T>(start_index + static_cast<int>(column), count, out, pol);
+      });
+}
+
+template <class T>
+std::vector<T> airy_ai_zeros(int start_index, unsigned number_of_zeros, unsigned threads = std::thread::hardware_concurrency())
+{
+   return airy_ai_zeros<T>(start_index, number_of_zeros, threads, policies::policy<>());
+}
+
+template <class T, class Policy>
+std::vector<T> airy_bi_zeros(int start_index, unsigned number_of_zeros, unsigned threads, const Policy& pol)
+{
+   return detail::bulk_zeros_table<T>(1, number_of_zeros, threads,
+      [&](std::size_t, unsigned column, unsigned count, T* out)
+      {
+         boost::math::airy_bi_zero<T>(start_index + static_cast<int>(column), count, out, pol);
+      });
+}
+
+template <class T>
+std::vector<T> airy_bi_zeros(int start_index, unsigned number_of_zeros, unsigned threads = std::thread::hardware_concurrency())
+{
+   return airy_bi_zeros<T>(start_index, number_of_zeros, threads, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_BULK_ZEROS_HPP
@@ -14,6 +14,17 @@
 #include <boost/math/tools/toms748_solve.hpp>
 #include <vector>
 
+//
+// With C++11 threads, prefilling the cache shares the tangent number recurrence between threads:
+//
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT) && !defined(BOOST_NO_CXX11_HDR_THREAD) \
+   && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_LAMBDAS) && !defined(BOOST_NO_CXX11_AUTO_DECLARATIONS)
+#  define BOOST_MATH_PARALLEL_TANGENT_NUMBERS
+#  include <atomic>
+#  include <exception>
+#  include <thread>
+#endif
+
 namespace boost{ namespace math{ namespace detail{
 //
 // Asymptotic expansion for B2n due to
@@ -238,147 +249,311 @@ private:
    unsigned m_used, m_capacity;
 };
 
-template <class T, class Policy>
-class bernoulli_numbers_cache
-{
-public:
-   bernoulli_numbers_cache() : m_overflow_limit((std::numeric_limits<std::size_t>::max)())
-#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
-      , m_counter(0)
-#endif
-      , m_current_precision(boost::math::tools::digits<T>())
-   {}
-
-   typedef fixed_vector<T> container_type;
+#ifdef BOOST_MATH_PARALLEL_TANGENT_NUMBERS
+//
+// Runs rows [first_row, last_row) of the tangent number recurrence in bernoulli_numbers_cache::tables::tangent
+// on several threads.  Each element of a row depends on the element to its left in the same row, and on
+// the element above it in the previous row, so the columns are split into blocks which are dealt out to the
+// threads in turn, and a block of a row is calculated once the block to its left has finished that row.
+// A block also waits for the block to its right to finish the previous row, before it overwrites the column
+// which that block reads.  Each element is calculated by exactly the same operations as the serial recurrence,
+// so the results are identical.
+//
+static const std::size_t tangent_numbers_block = 64;
 
-   void tangent(std::size_t m)
+template <class T, class Container>
+void parallel_tangent_rows(std::vector<T>& intermediates, Container& tn, std::size_t first_row, std::size_t last_row, unsigned threads)
+{
+   // Columns 1 to last_row - 1 are used:
+   const std::size_t blocks = (last_row + tangent_numbers_block - 2) / tangent_numbers_block;
+   threads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(threads), blocks));
+   // rows_done[b] is the first row which block b has not finished:
+   std::vector<std::atomic<std::size_t> > rows_done(blocks);
+   for(auto& r : rows_done)
    {
-      static const std::size_t min_overflow_index = b2n_overflow_limit<T, Policy>() - 1;
-      tn.resize(static_cast<typename container_type::size_type>(m), T(0U));
-
-      BOOST_MATH_INSTRUMENT_VARIABLE(min_overflow_index);
-
-      std::size_t prev_size = m_intermediates.size();
-      m_intermediates.resize(m, T(0U));
-
-      if(prev_size == 0)
+      r.store(first_row, std::memory_order_relaxed);
+   }
+   std::atomic<bool> failed(false);
+   auto wait_for = [&](std::size_t block, std::size_t row) -> bool
+   {
+      while(rows_done[block].load(std::memory_order_acquire) <= row)
       {
-         m_intermediates[1] = tangent_scale_factor<T>() /*T(1U)*/;
-         tn[0U] = T(0U);
-         tn[1U] = tangent_scale_factor<T>()/* T(1U)*/;
-         BOOST_MATH_INSTRUMENT_VARIABLE(tn[0]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(tn[1]);
+         if(failed.load(std::memory_order_relaxed))
+            return false;
+         std::this_thread::yield();
       }
-
-      for(std::size_t i = std::max<size_t>(2, prev_size); i < m; i++)
+      return true;
+   };
+   // Thread t takes blocks t, t + stride, t + 2 * stride, . . . skipping any which have already finished the row:
+   auto work = [&](unsigned t, unsigned stride)
+   {
+      for(std::size_t i = first_row; i < last_row; ++i)
       {
-         bool overflow_check = false;
-         if(i >= min_overflow_index && (boost::math::tools::max_value<T>() / (i-1) < m_intermediates[1]) )
+         for(std::size_t b = t; b < blocks; b += stride)
          {
-            std::fill(tn.begin() + i, tn.end(), boost::math::tools::max_value<T>());
-            break;
+            std::size_t first = 1 + b * tangent_numbers_block;
+            if(first > i)
+               break;
+            if(rows_done[b].load(std::memory_order_relaxed) > i)
+               continue;
+            std::size_t last = (std::min)(first + tangent_numbers_block, i + 1);
+            if(b && !wait_for(b - 1, i))
+               return;
+            if((b + 1 < blocks) && (first + tangent_numbers_block < i) && !wait_for(b + 1, i - 1))
+               return;
+            if(b == 0)
+            {
+               intermediates[1] = intermediates[1] * (i - 1);
+               first = 2;
+            }
+            for(std::size_t j = first; j < last; ++j)
+               intermediates[j] = intermediates[j] * (i - j) + intermediates[j - 1] * (i - j + 2);
+            if(last == i + 1)
+               tn[static_cast<typename Container::size_type>(i)] = intermediates[i];
+            rows_done[b].store(i + 1, std::memory_order_release);
          }
-         m_intermediates[1] = m_intermediates[1] * (i-1);
-         for(std::size_t j = 2; j <= i; j++)
+      }
+   };
+   std::vector<std::thread> workers;
+   workers.reserve(threads);
+   std::vector<std::exception_ptr> errors(threads);
+   bool all_started = true;
+   try
+   {
+      for(unsigned t = 0; t < threads; ++t)
+      {
+         workers.emplace_back([&, t]()
          {
-            overflow_check =
-                  (i >= min_overflow_index) && (
-                  (boost::math::tools::max_value<T>() / (i - j) < m_intermediates[j])
-                  || (boost::math::tools::max_value<T>() / (i - j + 2) < m_intermediates[j-1])
-                  || (boost::math::tools::max_value<T>() - m_intermediates[j] * (i - j) < m_intermediates[j-1] * (i - j + 2))
-                  || ((boost::math::isinf)(m_intermediates[j]))
-                );
-
-            if(overflow_check)
+            try
             {
-               std::fill(tn.begin() + i, tn.end(), boost::math::tools::max_value<T>());
-               break;
+               work(t, threads);
             }
-            m_intermediates[j] = m_intermediates[j] * (i - j) + m_intermediates[j-1] * (i - j + 2);
-         }
-         if(overflow_check)
-            break; // already filled the tn...
-         tn[static_cast<typename container_type::size_type>(i)] = m_intermediates[i];
-         BOOST_MATH_INSTRUMENT_VARIABLE(i);
-         BOOST_MATH_INSTRUMENT_VARIABLE(tn[static_cast<typename container_type::size_type>(i)]);
+            catch(...)
+            {
+               errors[t] = std::current_exception();
+               // Have the other threads stop rather than wait for this one:
+               failed = true;
+            }
+         });
       }
    }
-
-   void tangent_numbers_series(const std::size_t m)
+   catch(...)
    {
-      BOOST_MATH_STD_USING
-      static const std::size_t min_overflow_index = b2n_overflow_limit<T, Policy>() - 1;
+      // A thread could not be started, so the blocks dealt to it would never be done:
+      // stop the threads which were started, and finish their work below.
+      failed = true;
+      all_started = false;
+   }
+   for(auto& worker : workers)
+   {
+      worker.join();
+   }
+   for(auto const & e : errors)
+   {
+      if(e)
+      {
+         std::rethrow_exception(e);
+      }
+   }
+   if(!all_started)
+   {
+      // Each block is left at the end of a row, and no block is more than a row ahead of the one to its right,
+      // so taking every block in turn from there is the serial recurrence:
+      failed = false;
+      work(0, 1);
+   }
+}
+#endif
 
-      typename container_type::size_type old_size = bn.size();
+//
+// One cache is shared by all the policies used with T: the values it stores do not depend on the policy,
+// only the errors raised when reading them do.
+//
+template <class T>
+class bernoulli_numbers_cache
+{
+   //
+   // The tables for one precision of T.  The caches for Bernoulli and tangent numbers, once allocated,
+   // must NEVER EVER reallocate as it breaks our thread safety guarantees.  For the same reason, when the
+   // precision of T increases, a new set of tables is started and the old ones are kept until the cache itself
+   // is destroyed, so that readers which loaded the old tables may carry on reading them without a lock.
+   //
+   struct tables
+   {
+      typedef fixed_vector<T> container_type;
 
-      tangent(m);
-      bn.resize(static_cast<typename container_type::size_type>(m));
+      tables(int precision) : m_overflow_limit((std::numeric_limits<std::size_t>::max)()), m_precision(precision)
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         , m_counter(0)
+#endif
+      {}
 
-      if(!old_size)
+      void tangent(std::size_t m, unsigned threads)
       {
-         bn[0] = 1;
-         old_size = 1;
-      }
+         static const std::size_t min_overflow_index = b2n_overflow_limit<T, policies::policy<> >() - 1;
+         tn.resize(static_cast<typename container_type::size_type>(m), T(0U));
 
-      T power_two(ldexp(T(1), static_cast<int>(2 * old_size)));
+         BOOST_MATH_INSTRUMENT_VARIABLE(min_overflow_index);
 
-      for(std::size_t i = old_size; i < m; i++)
-      {
-         T b(static_cast<T>(i * 2));
+         std::size_t prev_size = m_intermediates.size();
+         m_intermediates.resize(m, T(0U));
+
+         if(prev_size == 0)
+         {
+            m_intermediates[1] = tangent_scale_factor<T>() /*T(1U)*/;
+            tn[0U] = T(0U);
+            tn[1U] = tangent_scale_factor<T>()/* T(1U)*/;
+            BOOST_MATH_INSTRUMENT_VARIABLE(tn[0]);
+            BOOST_MATH_INSTRUMENT_VARIABLE(tn[1]);
+         }
+
+         std::size_t first_row = (std::max)(std::size_t(2), prev_size);
+#ifdef BOOST_MATH_PARALLEL_TANGENT_NUMBERS
          //
-         // Not only do we need to take care to avoid spurious over/under flow in
-         // the calculation, but we also need to avoid overflow altogether in case
-         // we're calculating with a type where "bad things" happen in that case:
+         // The rows before overflow is possible need no checks, and may be shared out between threads
+         // when there are enough of them:
          //
-         b  = b / (power_two * tangent_scale_factor<T>());
-         b /= (power_two - 1);
-         bool overflow_check = (i >= min_overflow_index) && (tools::max_value<T>() / tn[static_cast<typename container_type::size_type>(i)] < b);
-         if(overflow_check)
+         std::size_t last_parallel_row = (std::min)(m, min_overflow_index);
+         if((threads > 1) && (last_parallel_row > first_row) && (last_parallel_row > 2 * tangent_numbers_block))
+         {
+            parallel_tangent_rows(m_intermediates, tn, first_row, last_parallel_row, threads);
+            first_row = last_parallel_row;
+         }
+#else
+         (void)threads;
+#endif
+
+         for(std::size_t i = first_row; i < m; i++)
          {
-            m_overflow_limit = i;
-            while(i < m)
+            bool overflow_check = false;
+            if(i >= min_overflow_index && (boost::math::tools::max_value<T>() / (i-1) < m_intermediates[1]) )
             {
-               b = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : tools::max_value<T>();
-               bn[static_cast<typename container_type::size_type>(i)] = ((i % 2U) ? b : T(-b));
-               ++i;
+               std::fill(tn.begin() + i, tn.end(), boost::math::tools::max_value<T>());
+               break;
             }
-            break;
+            m_intermediates[1] = m_intermediates[1] * (i-1);
+            for(std::size_t j = 2; j <= i; j++)
+            {
+               overflow_check =
+                     (i >= min_overflow_index) && (
+                     (boost::math::tools::max_value<T>() / (i - j) < m_intermediates[j])
+                     || (boost::math::tools::max_value<T>() / (i - j + 2) < m_intermediates[j-1])
+                     || (boost::math::tools::max_value<T>() - m_intermediates[j] * (i - j) < m_intermediates[j-1] * (i - j + 2))
+                     || ((boost::math::isinf)(m_intermediates[j]))
+                   );
+
+               if(overflow_check)
+               {
+                  std::fill(tn.begin() + i, tn.end(), boost::math::tools::max_value<T>());
+                  break;
+               }
+               m_intermediates[j] = m_intermediates[j] * (i - j) + m_intermediates[j-1] * (i - j + 2);
+            }
+            if(overflow_check)
+               break; // already filled the tn...
+            tn[static_cast<typename container_type::size_type>(i)] = m_intermediates[i];
+            BOOST_MATH_INSTRUMENT_VARIABLE(i);
+            BOOST_MATH_INSTRUMENT_VARIABLE(tn[static_cast<typename container_type::size_type>(i)]);
          }
-         else
+      }
+
+      void tangent_numbers_series(const std::size_t m, unsigned threads)
+      {
+         BOOST_MATH_STD_USING
+         static const std::size_t min_overflow_index = b2n_overflow_limit<T, policies::policy<> >() - 1;
+
+         typename container_type::size_type old_size = bn.size();
+
+         tangent(m, threads);
+         bn.resize(static_cast<typename container_type::size_type>(m));
+
+         if(!old_size)
          {
-            b *= tn[static_cast<typename container_type::size_type>(i)];
+            bn[0] = 1;
+            old_size = 1;
          }
 
-         power_two = ldexp(power_two, 2);
+         T power_two(ldexp(T(1), static_cast<int>(2 * old_size)));
 
-         const bool b_neg = i % 2 == 0;
+         for(std::size_t i = old_size; i < m; i++)
+         {
+            T b(static_cast<T>(i * 2));
+            //
+            // Not only do we need to take care to avoid spurious over/under flow in
+            // the calculation, but we also need to avoid overflow altogether in case
+            // we're calculating with a type where "bad things" happen in that case:
+            //
+            b  = b / (power_two * tangent_scale_factor<T>());
+            b /= (power_two - 1);
+            bool overflow_check = (i >= min_overflow_index) && (tools::max_value<T>() / tn[static_cast<typename container_type::size_type>(i)] < b);
+            if(overflow_check)
+            {
+               m_overflow_limit = i;
+               while(i < m)
+               {
+                  b = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : tools::max_value<T>();
+                  bn[static_cast<typename container_type::size_type>(i)] = ((i % 2U) ? b : T(-b));
+                  ++i;
+               }
+               break;
+            }
+            else
+            {
+               b *= tn[static_cast<typename container_type::size_type>(i)];
+            }
+
+            power_two = ldexp(power_two, 2);
 
-         bn[static_cast<typename container_type::size_type>(i)] = ((!b_neg) ? b : T(-b));
+            const bool b_neg = i % 2 == 0;
+
+            bn[static_cast<typename container_type::size_type>(i)] = ((!b_neg) ? b : T(-b));
+         }
       }
+
+      fixed_vector<T> bn, tn;
+      std::vector<T> m_intermediates;
+      // The value at which we know overflow has already occurred for the Bn:
+      std::size_t m_overflow_limit;
+      // The value of tools::digits<T>() the tables were calculated at, which never changes:
+      const int m_precision;
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+      // The number of values in bn and tn which readers may use:
+      atomic_counter_type m_counter;
+#endif
+   private:
+      tables(const tables&);
+      tables& operator=(const tables&);
+   };
+
+public:
+   typedef fixed_vector<T> container_type;
+
+   bernoulli_numbers_cache()
+   {
+      m_generations.push_back(new tables(boost::math::tools::digits<T>()));
+      m_tables = m_generations.back();
+      m_capacity = m_generations.back()->bn.capacity();
+   }
+   ~bernoulli_numbers_cache()
+   {
+      for(typename std::vector<tables*>::iterator i = m_generations.begin(); i != m_generations.end(); ++i)
+         delete *i;
    }
 
-   template <class OutputIterator>
+   template <class OutputIterator, class Policy>
    OutputIterator copy_bernoulli_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
    {
-      //
-      // There are basically 3 thread safety options:
-      //
-      // 1) There are no threads (BOOST_HAS_THREADS is not defined).
-      // 2) There are threads, but we do not have a true atomic integer type, 
-      //    in this case we just use a mutex to guard against race conditions.
-      // 3) There are threads, and we have an atomic integer: in this case we can
-      //    use the double-checked locking pattern to avoid thread synchronisation
-      //    when accessing values already in the cache.
       //
       // First off handle the common case for overflow and/or asymptotic expansion:
       //
-      if(start + n > bn.capacity())
+      std::size_t capacity = m_capacity;
+      if(start + n > capacity)
       {
-         if(start < bn.capacity())
+         if(start < capacity)
          {
-            out = copy_bernoulli_numbers(out, start, bn.capacity() - start, pol);
-            n -= bn.capacity() - start;
-            start = static_cast<std::size_t>(bn.capacity());
+            out = copy_bernoulli_numbers(out, start, capacity - start, pol);
+            n -= capacity - start;
+            start = capacity;
          }
          if(start < b2n_overflow_limit<T, Policy>() + 2u)
          {
@@ -395,117 +570,36 @@ public:
          }
          return out;
       }
-   #if !defined(BOOST_HAS_THREADS)
-      //
-      // Single threaded code, very simple:
-      //
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
-
-      for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
-      {
-         *out = (i >= m_overflow_limit) ? policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol) : bn[i];
-         ++out;
-      }
-   #elif defined(BOOST_MATH_NO_ATOMIC_INT)
+#if defined(BOOST_HAS_THREADS) && defined(BOOST_MATH_NO_ATOMIC_INT)
       //
       // We need to grab a mutex every time we get here, for both readers and writers:
       //
       boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
-
-      for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
-      {
-         *out = (i >= m_overflow_limit) ? policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol) : bn[i];
-         ++out;
-      }
-
-   #else
-      //
-      // Double-checked locking pattern, lets us access cached already cached values
-      // without locking:
-      //
-      // Get the counter and see if we need to calculate more constants:
-      //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-      {
-         boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-         {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
-            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
-         }
-      }
+#endif
+      const tables& t = get_tables(start + n, 1);
 
       for(std::size_t i = (std::max)(static_cast<std::size_t>(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
       {
-         *out = (i >= m_overflow_limit) ? policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol) : bn[static_cast<typename container_type::size_type>(i)];
+         *out = (i >= t.m_overflow_limit) ? policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol) : t.bn[static_cast<typename container_type::size_type>(i)];
          ++out;
       }
-
-   #endif
       return out;
    }
 
-   template <class OutputIterator>
+   template <class OutputIterator, class Policy>
    OutputIterator copy_tangent_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
    {
-      //
-      // There are basically 3 thread safety options:
-      //
-      // 1) There are no threads (BOOST_HAS_THREADS is not defined).
-      // 2) There are threads, but we do not have a true atomic integer type, 
-      //    in this case we just use a mutex to guard against race conditions.
-      // 3) There are threads, and we have an atomic integer: in this case we can
-      //    use the double-checked locking pattern to avoid thread synchronisation
-      //    when accessing values already in the cache.
-      //
       //
       // First off handle the common case for overflow and/or asymptotic expansion:
       //
-      if(start + n > bn.capacity())
+      std::size_t capacity = m_capacity;
+      if(start + n > capacity)
       {
-         if(start < bn.capacity())
+         if(start < capacity)
          {
-            out = copy_tangent_numbers(out, start, bn.capacity() - start, pol);
-            n -= bn.capacity() - start;
-            start = static_cast<std::size_t>(bn.capacity());
+            out = copy_tangent_numbers(out, start, capacity - start, pol);
+            n -= capacity - start;
+            start = capacity;
          }
          if(start < b2n_overflow_limit<T, Policy>() + 2u)
          {
@@ -522,149 +616,144 @@ public:
          }
          return out;
       }
-   #if !defined(BOOST_HAS_THREADS)
-      //
-      // Single threaded code, very simple:
-      //
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
-
-      for(std::size_t i = start; i < start + n; ++i)
-      {
-         if(i >= m_overflow_limit)
-            *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
-         else
-         {
-            if(tools::max_value<T>() * tangent_scale_factor<T>() < tn[static_cast<typename container_type::size_type>(i)])
-               *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
-            else
-               *out = tn[static_cast<typename container_type::size_type>(i)] / tangent_scale_factor<T>();
-         }
-         ++out;
-      }
-   #elif defined(BOOST_MATH_NO_ATOMIC_INT)
+#if defined(BOOST_HAS_THREADS) && defined(BOOST_MATH_NO_ATOMIC_INT)
       //
       // We need to grab a mutex every time we get here, for both readers and writers:
       //
       boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
+#endif
+      const tables& t = get_tables(start + n, 1);
 
       for(std::size_t i = start; i < start + n; ++i)
       {
-         if(i >= m_overflow_limit)
+         if(i >= t.m_overflow_limit)
             *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
          else
          {
-            if(tools::max_value<T>() * tangent_scale_factor<T>() < tn[static_cast<typename container_type::size_type>(i)])
+            if(tools::max_value<T>() * tangent_scale_factor<T>() < t.tn[static_cast<typename container_type::size_type>(i)])
                *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
             else
-               *out = tn[static_cast<typename container_type::size_type>(i)] / tangent_scale_factor<T>();
+               *out = t.tn[static_cast<typename container_type::size_type>(i)] / tangent_scale_factor<T>();
          }
          ++out;
       }
+      return out;
+   }
 
-   #else
-      //
-      // Double-checked locking pattern, lets us access cached already cached values
-      // without locking:
+   //
+   // Calculates the first n Bernoulli and tangent numbers now, sharing the work between up to
+   // `threads` threads, rather than on first use:
+   //
+   void prefill(std::size_t n, unsigned threads)
+   {
+      n = (std::min)(n, m_capacity);
+#if defined(BOOST_HAS_THREADS) && defined(BOOST_MATH_NO_ATOMIC_INT)
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+#endif
+      get_tables(n, threads);
+   }
+
+private:
+   //
+   // There are basically 3 thread safety options:
+   //
+   // 1) There are no threads (BOOST_HAS_THREADS is not defined).
+   // 2) There are threads, but we do not have a true atomic integer type,
+   //    in this case the callers hold a mutex to guard against race conditions.
+   // 3) There are threads, and we have an atomic integer: in this case readers
+   //    of values already in the cache never lock, see get_tables below.
+   //
+#if !defined(BOOST_HAS_THREADS) || defined(BOOST_MATH_NO_ATOMIC_INT)
+   const tables& get_tables(std::size_t m, unsigned threads)
+   {
+      if((m_tables->m_precision < boost::math::tools::digits<T>()) || (m >= m_tables->bn.size()))
+         grow(m_tables, m, threads);
+      return *m_tables;
+   }
+#else
+   const tables& get_tables(std::size_t m, unsigned threads)
+   {
       //
-      // Get the counter and see if we need to calculate more constants:
+      // The read path: load the tables for the current precision, and their count of finished values,
+      // and if they have all we need, read them without locking.  Values are only ever appended to
+      // a set of tables, and a set of tables is never freed while the cache is in use, so nothing
+      // a reader has loaded can change under it.  Otherwise extend the tables under the mutex, checking
+      // again in case another thread got there first (double-checked locking):
       //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+      tables* t = m_tables.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire);
+      if((t->m_precision < boost::math::tools::digits<T>())
+         || (static_cast<std::size_t>(t->m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire)) < m))
       {
          boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+         t = m_tables.load(BOOST_MATH_ATOMIC_NS::memory_order_relaxed);
+         if((t->m_precision < boost::math::tools::digits<T>())
+            || (static_cast<std::size_t>(t->m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_relaxed)) < m))
          {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
-            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+            grow(t, m, threads);
+            m_tables.store(t, BOOST_MATH_ATOMIC_NS::memory_order_release);
          }
       }
-
-      for(std::size_t i = start; i < start + n; ++i)
+      return *t;
+   }
+#endif
+   //
+   // Makes sure t has at least the first m values at the current precision, called only with the mutex held
+   // when there are threads:
+   //
+   void grow(tables*& t, std::size_t m, unsigned threads)
+   {
+      tables* current = t;
+      if(current->m_precision < boost::math::tools::digits<T>())
       {
-         if(i >= m_overflow_limit)
-            *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
-         else
-         {
-            if(tools::max_value<T>() * tangent_scale_factor<T>() < tn[static_cast<typename container_type::size_type>(i)])
-               *out = policies::raise_overflow_error<T>("boost::math::bernoulli_b2n<%1%>(std::size_t)", 0, T(i), pol);
-            else
-               *out = tn[static_cast<typename container_type::size_type>(i)] / tangent_scale_factor<T>();
-         }
-         ++out;
+         m_generations.reserve(m_generations.size() + 1);
+         m_generations.push_back(new tables(boost::math::tools::digits<T>()));
+         current = m_generations.back();
       }
-
-   #endif
-      return out;
+      if(m >= current->bn.size())
+      {
+         std::size_t new_size = (std::min)((std::max)((std::max)(m, std::size_t(current->bn.size() + 20)), std::size_t(50)), std::size_t(current->bn.capacity()));
+         current->tangent_numbers_series(new_size, threads);
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         current->m_counter.store(static_cast<atomic_integer_type>(current->bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+#endif
+      }
+      t = current;
    }
 
-private:
-   //
-   // The caches for Bernoulli and tangent numbers, once allocated,
-   // these must NEVER EVER reallocate as it breaks our thread
-   // safety guarantees:
-   //
-   fixed_vector<T> bn, tn;
-   std::vector<T> m_intermediates;
-   // The value at which we know overflow has already occurred for the Bn:
-   std::size_t m_overflow_limit;
+   bernoulli_numbers_cache(const bernoulli_numbers_cache&);
+   bernoulli_numbers_cache& operator=(const bernoulli_numbers_cache&);
+
+   // Every set of tables ever started, the last is the current one:
+   std::vector<tables*> m_generations;
+   // The capacity of the tables, which is the same at every precision:
+   std::size_t m_capacity;
 #if !defined(BOOST_HAS_THREADS)
-   int m_current_precision;
+   tables* m_tables;
 #elif defined(BOOST_MATH_NO_ATOMIC_INT)
    boost::detail::lightweight_mutex m_mutex;
-   int m_current_precision;
+   tables* m_tables;
 #else
    boost::detail::lightweight_mutex m_mutex;
-   atomic_counter_type m_counter, m_current_precision;
+   BOOST_MATH_ATOMIC_NS::atomic<tables*> m_tables;
 #endif
 };
 
+template <class T>
+inline bernoulli_numbers_cache<T>& get_shared_bernoulli_numbers_cache()
+{
+   static bernoulli_numbers_cache<T> data;
+   return data;
+}
+
 template <class T, class Policy>
-inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache()
+inline bernoulli_numbers_cache<T>& get_bernoulli_numbers_cache()
 {
    //
    // Force this function to be called at program startup so all the static variables
    // get initialized then (thread safety).
    //
    bernoulli_initializer<T, Policy>::force_instantiate();
-   static bernoulli_numbers_cache<T, Policy> data;
-   return data;
+   return get_shared_bernoulli_numbers_cache<T>();
 }
 
 }}}
@@ -0,0 +1,595 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// A segmented sieve of Eratosthenes, used by prime(n) beyond the static table, and by
+// prime_count, next_prime, is_prime and prime_range.  Included by prime.hpp: do not
+// include this header directly.
+//
+#ifndef BOOST_MATH_SF_DETAIL_PRIME_SIEVE_HPP
+#define BOOST_MATH_SF_DETAIL_PRIME_SIEVE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/detail/lightweight_mutex.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+//
+// With C++11 threads, the segments of the sieve are shared out between threads:
+//
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS) \
+   && !defined(BOOST_NO_CXX11_AUTO_DECLARATIONS) && !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#  define BOOST_MATH_PARALLEL_PRIME_SIEVE
+#  include <exception>
+#  include <thread>
+#endif
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Deterministic Miller-Rabin for 64-bit integers.  Without a 128-bit integer type, products
+// of values which don't fit in 32 bits are formed by doubling and adding modulo m:
+//
+inline boost::uint64_t prime_mulmod(boost::uint64_t a, boost::uint64_t b, boost::uint64_t m)
+{
+#ifdef BOOST_HAS_INT128
+   return static_cast<boost::uint64_t>((static_cast<boost::uint128_type>(a) * b) % m);
+#else
+   if(((a | b) >> 32) == 0)
+      return (a * b) % m;
+   boost::uint64_t result = 0;
+   a %= m;
+   while(b)
+   {
+      if(b & 1)
+         result = (result >= m - a) ? result - (m - a) : result + a;
+      a = (a >= m - a) ? a - (m - a) : a + a;
+      b >>= 1;
+   }
+   return result;
+#endif
+}
+
+inline boost::uint64_t prime_powmod(boost::uint64_t a, boost::uint64_t e, boost::uint64_t m)
+{
+   boost::uint64_t result = 1;
+   while(e)
+   {
+      if(e & 1)
+         result = prime_mulmod(result, a, m);
+      a = prime_mulmod(a, a, m);
+      e >>= 1;
+   }
+   return result;
+}
+
+//
+// Returns true if n, odd with n - 1 = d * 2^s, is a strong probable prime to base a:
+//
+inline bool miller_rabin_passes(boost::uint64_t n, boost::uint64_t a, boost::uint64_t d, unsigned s)
+{
+   a %= n;
+   if(a == 0)
+      return true;
+   boost::uint64_t x = prime_powmod(a, d, n);
+   if((x == 1) || (x == n - 1))
+      return true;
+   for(unsigned r = 1; r < s; ++r)
+   {
+      x = prime_mulmod(x, x, n);
+      if(x == n - 1)
+         return true;
+   }
+   return false;
+}
+
+inline bool is_prime_imp(boost::uint64_t n)
+{
+   static const unsigned bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+   if(n < 2)
+      return false;
+   for(unsigned i = 0; i < sizeof(bases) / sizeof(bases[0]); ++i)
+   {
+      if(n % bases[i] == 0)
+         return n == bases[i];
+   }
+   if(n < 41 * 41)
+      return true;
+   boost::uint64_t d = n - 1;
+   unsigned s = 0;
+   while((d & 1) == 0)
+   {
+      d >>= 1;
+      ++s;
+   }
+   //
+   // The first 4 prime bases are enough below 3215031751, and the first 12 for all 64-bit n,
+   // see https://oeis.org/A014233:
+   //
+   unsigned n_bases = n < 3215031751u ? 4 : 12;
+   for(unsigned i = 0; i < n_bases; ++i)
+   {
+      if(!miller_rabin_passes(n, bases[i], d, s))
+         return false;
+   }
+   return true;
+}
+
+//
+// The sieve works on segments of prime_sieve_segment consecutive integers, segment k covering
+// [k * prime_sieve_segment, (k + 1) * prime_sieve_segment), and stores one byte per odd number, so
+// that a segment fits comfortably in the level 2 cache.  Segments are sieved by the odd primes below
+// the square root of their end, taken from prime's static table, or for segments beyond 104729^2 from
+// a table of the primes below prime_sieve_base_limit.  Beyond prime_sieve_base_limit^2 = 2^48 that is
+// no longer enough, and the numbers left unmarked are confirmed by Miller-Rabin instead, which keeps
+// the memory used bounded.
+//
+static const boost::uint64_t prime_sieve_segment = 1u << 18;
+static const boost::uint32_t prime_sieve_base_limit = 1u << 24;
+//
+// prime(n) and prime_count keep the number of primes below the start of each segment, up to 2^32:
+//
+static const boost::uint64_t prime_sieve_max_checkpoint = static_cast<boost::uint64_t>(1u) << 32;
+//
+// Segments are sieved in rounds of up to this many segments per thread, so that the memory used
+// by prime_range is bounded:
+//
+static const unsigned prime_sieve_round = 16;
+//
+// The multiples of the primes up to 13 take up almost half the work of sieving, but fall in a
+// pattern which repeats every 3*5*7*11*13 odd numbers, so each segment starts from a copy of it:
+//
+static const unsigned prime_sieve_pattern_length = 3 * 5 * 7 * 11 * 13;
+static const unsigned prime_sieve_presieved = 13;
+
+inline void make_prime_sieve_pattern(std::vector<unsigned char>& pattern)
+{
+   static const unsigned primes[] = { 3, 5, 7, 11, 13 };
+   pattern.assign(prime_sieve_pattern_length, 0);
+   for(unsigned i = 0; i < prime_sieve_pattern_length; ++i)
+   {
+      for(unsigned j = 0; j < sizeof(primes) / sizeof(primes[0]); ++j)
+      {
+         if((2 * i + 1) % primes[j] == 0)
+            pattern[i] = 1;
+      }
+   }
+}
+
+//
+// Marks the odd numbers in segment k which are divisible by one of the odd primes in [first, last) other
+// than themselves: flags[i] is set when k * prime_sieve_segment + 2i + 1 is composite (or is 1).  pattern
+// is from make_prime_sieve_pattern.
+//
+template <class Iterator>
+void sieve_prime_segment(boost::uint64_t k, std::vector<unsigned char>& flags, Iterator first, Iterator last, const std::vector<unsigned char>& pattern)
+{
+   const std::size_t n = static_cast<std::size_t>(prime_sieve_segment / 2);
+   const boost::uint64_t lo = k * prime_sieve_segment;
+   const boost::uint64_t hi = lo + prime_sieve_segment;
+   flags.resize(n);
+   std::size_t offset = static_cast<std::size_t>((lo / 2) % prime_sieve_pattern_length);
+   for(std::size_t i = 0; i < n;)
+   {
+      std::size_t count = (std::min)(n - i, prime_sieve_pattern_length - offset);
+      std::copy(pattern.begin() + offset, pattern.begin() + offset + count, flags.begin() + i);
+      i += count;
+      offset = 0;
+   }
+   for(; first != last; ++first)
+   {
+      boost::uint64_t p = *first;
+      if(p <= prime_sieve_presieved)
+         continue;
+      boost::uint64_t start = p * p;
+      if(start >= hi)
+         break;
+      if(start < lo)
+      {
+         start = ((lo + p - 1) / p) * p;
+         if((start & 1) == 0)
+            start += p;
+      }
+      unsigned char* data = &flags[0];
+      for(std::size_t i = static_cast<std::size_t>((start - lo) / 2); i < n; i += static_cast<std::size_t>(p))
+         data[i] = 1;
+   }
+   if(k == 0)
+   {
+      // 1 isn't prime, but the presieved primes are:
+      flags[0] = 1;
+      flags[1] = flags[2] = flags[3] = flags[5] = flags[6] = 0;
+   }
+}
+
+//
+// Calls f(p) for each prime p in [a, b) in segment k, in order, given the flags from sieve_prime_segment.
+// When `complete` is false the segment was sieved by too few primes to be sure of the values left
+// unmarked, and those are tested by Miller-Rabin:
+//
+template <class F>
+void for_each_prime_in_segment(boost::uint64_t k, const std::vector<unsigned char>& flags, bool complete, boost::uint64_t a, boost::uint64_t b, F& f)
+{
+   const boost::uint64_t lo = k * prime_sieve_segment;
+   if((k == 0) && (a <= 2) && (2 < b))
+      f(static_cast<boost::uint64_t>(2u));
+   std::size_t first = a > lo ? static_cast<std::size_t>((a - lo) / 2) : 0u;
+   std::size_t last = static_cast<std::size_t>((std::min)((b - lo) / 2, prime_sieve_segment / 2));
+   for(std::size_t i = first; i < last; ++i)
+   {
+      if(!flags[i])
+      {
+         boost::uint64_t p = lo + 2 * i + 1;
+         if(complete || is_prime_imp(p))
+            f(p);
+      }
+   }
+}
+
+//
+// The number of primes in [a, b) in segment k, as for for_each_prime_in_segment:
+//
+inline boost::uint64_t count_primes_in_segment(boost::uint64_t k, const std::vector<unsigned char>& flags, bool complete, boost::uint64_t a, boost::uint64_t b)
+{
+   const boost::uint64_t lo = k * prime_sieve_segment;
+   boost::uint64_t count = (k == 0) && (a <= 2) && (2 < b) ? 1 : 0;
+   std::size_t first = a > lo ? static_cast<std::size_t>((a - lo) / 2) : 0u;
+   std::size_t last = static_cast<std::size_t>((std::min)((b - lo) / 2, prime_sieve_segment / 2));
+   if(first >= last)
+      return count;
+   if(complete)
+      return count + static_cast<boost::uint64_t>(std::count(flags.begin() + first, flags.begin() + last, 0));
+   for(std::size_t i = first; i < last; ++i)
+   {
+      if(!flags[i] && is_prime_imp(lo + 2 * i + 1))
+         ++count;
+   }
+   return count;
+}
+
+struct prime_collector
+{
+   prime_collector(std::vector<boost::uint64_t>& v) : values(v) {}
+   void operator()(boost::uint64_t p) { values.push_back(p); }
+   std::vector<boost::uint64_t>& values;
+};
+
+inline unsigned prime_sieve_threads(boost::uint64_t segments)
+{
+#ifdef BOOST_MATH_PARALLEL_PRIME_SIEVE
+   // A thread is only worth starting for a few segments:
+   boost::uint64_t threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+   return static_cast<unsigned>((std::max)((std::min)(threads, segments / 4), static_cast<boost::uint64_t>(1u)));
+#else
+   (void)segments;
+   return 1;
+#endif
+}
+
+class prime_sieve_cache
+{
+public:
+   prime_sieve_cache() : m_large_base_ready(false)
+   {
+      make_prime_sieve_pattern(m_pattern);
+      m_table.reserve(max_prime + 1);
+      for(unsigned i = 0; i <= max_prime; ++i)
+         m_table.push_back(prime(i));
+      m_counts.push_back(0);
+   }
+
+   //
+   // The number of primes below x, x < 2^64 - prime_sieve_segment:
+   //
+   boost::uint64_t count_below(boost::uint64_t x)
+   {
+      if(x <= m_table.back())
+         return std::lower_bound(m_table.begin(), m_table.end(), x) - m_table.begin();
+      boost::uint64_t k = (std::min)(x, prime_sieve_max_checkpoint) / prime_sieve_segment;
+      boost::uint64_t count = checkpoint(k);
+      count_visitor v(k * prime_sieve_segment, x);
+      visit_segments(k, (x - 1) / prime_sieve_segment + 1, v);
+      return count + v.count;
+   }
+
+   //
+   // The n'th prime, starting from prime(0) = 2, for n such that it is below 2^32:
+   //
+   boost::uint32_t nth(boost::uint64_t n)
+   {
+      std::size_t k;
+      boost::uint64_t below;
+      {
+         boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+         while(m_counts.back() <= n)
+         {
+            // p_n < n(ln n + ln ln n), so this is enough segments in one go:
+            double estimate = static_cast<double>(n + 1) * (std::log(static_cast<double>(n + 1)) + std::log(std::log(static_cast<double>(n + 1))));
+            std::size_t target = static_cast<std::size_t>(estimate / static_cast<double>(prime_sieve_segment)) + 2;
+            extend_checkpoints((std::max)(target, 2 * m_counts.size()));
+         }
+         k = (std::upper_bound(m_counts.begin(), m_counts.end(), n) - m_counts.begin()) - 1;
+         below = m_counts[k];
+      }
+      std::vector<unsigned char> flags;
+      sieve_prime_segment(k, flags, m_table.begin(), m_table.end(), m_pattern);
+      nth_finder f(n - below);
+      for_each_prime_in_segment(k, flags, true, k * prime_sieve_segment, (k + 1) * prime_sieve_segment, f);
+      return static_cast<boost::uint32_t>(f.result);
+   }
+
+   template <class OutputIterator>
+   OutputIterator copy_primes(boost::uint64_t a, boost::uint64_t b, OutputIterator out)
+   {
+      range_visitor<OutputIterator> v(a, b, out);
+      visit_segments(a / prime_sieve_segment, (b - 1) / prime_sieve_segment + 1, v);
+      return v.out;
+   }
+
+private:
+   struct count_visitor
+   {
+      count_visitor(boost::uint64_t first, boost::uint64_t last) : a(first), b(last), count(0) {}
+      void begin_round(std::size_t slots) { counts.assign(slots, 0); }
+      void segment(std::size_t slot, boost::uint64_t k, const std::vector<unsigned char>& flags, bool complete)
+      {
+         counts[slot] = count_primes_in_segment(k, flags, complete, a, b);
+      }
+      void end_round()
+      {
+         for(std::size_t i = 0; i < counts.size(); ++i)
+            count += counts[i];
+      }
+      boost::uint64_t a, b, count;
+      std::vector<boost::uint64_t> counts;
+   };
+
+   template <class OutputIterator>
+   struct range_visitor
+   {
+      range_visitor(boost::uint64_t first, boost::uint64_t last, OutputIterator o) : a(first), b(last), out(o) {}
+      void begin_round(std::size_t slots) { values.assign(slots, std::vector<boost::uint64_t>()); }
+      void segment(std::size_t slot, boost::uint64_t k, const std::vector<unsigned char>& flags, bool complete)
+      {
+         prime_collector c(values[slot]);
+         for_each_prime_in_segment(k, flags, complete, a, b, c);
+      }
+      void end_round()
+      {
+         for(std::size_t i = 0; i < values.size(); ++i)
+            out = std::copy(values[i].begin(), values[i].end(), out);
+      }
+      boost::uint64_t a, b;
+      OutputIterator out;
+      std::vector<std::vector<boost::uint64_t> > values;
+   };
+
+   struct nth_finder
+   {
+      nth_finder(boost::uint64_t n) : remaining(n), result(0) {}
+      void operator()(boost::uint64_t p)
+      {
+         if(remaining-- == 0)
+            result = p;
+      }
+      boost::uint64_t remaining, result;
+   };
+
+   //
+   // The number of primes below k * prime_sieve_segment, k * prime_sieve_segment <= 2^32:
+   //
+   boost::uint64_t checkpoint(boost::uint64_t k)
+   {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+      if(k >= m_counts.size())
+         extend_checkpoints((std::max)(static_cast<std::size_t>(k + 1), 2 * m_counts.size()));
+      return m_counts[static_cast<std::size_t>(k)];
+   }
+
+   struct checkpoint_visitor
+   {
+      checkpoint_visitor(std::vector<boost::uint64_t>& c) : checkpoints(c) {}
+      void begin_round(std::size_t slots) { counts.assign(slots, 0); }
+      void segment(std::size_t slot, boost::uint64_t k, const std::vector<unsigned char>& flags, bool complete)
+      {
+         counts[slot] = count_primes_in_segment(k, flags, complete, 0, (k + 1) * prime_sieve_segment);
+      }
+      void end_round()
+      {
+         for(std::size_t i = 0; i < counts.size(); ++i)
+            checkpoints.push_back(checkpoints.back() + counts[i]);
+      }
+      std::vector<boost::uint64_t>& checkpoints;
+      std::vector<boost::uint64_t> counts;
+   };
+
+   //
+   // Called with m_mutex held, makes m_counts hold the counts for the first `size` segment boundaries,
+   // or as many as there are up to 2^32:
+   //
+   void extend_checkpoints(std::size_t size)
+   {
+      size = (std::min)(size, static_cast<std::size_t>(prime_sieve_max_checkpoint / prime_sieve_segment + 1));
+      if(size <= m_counts.size())
+         return;
+      m_counts.reserve(size);
+      checkpoint_visitor v(m_counts);
+      visit_segments(m_counts.size() - 1, size - 1, v);
+   }
+
+   //
+   // The primes to sieve segments below hi with, `complete` is set when they are all the primes
+   // below the square root of hi:
+   //
+   const std::vector<boost::uint32_t>& base_primes(boost::uint64_t hi, bool& complete)
+   {
+      const boost::uint64_t table_limit = m_table.back();
+      if(hi <= table_limit * table_limit)
+      {
+         complete = true;
+         return m_table;
+      }
+      complete = hi <= static_cast<boost::uint64_t>(prime_sieve_base_limit) * prime_sieve_base_limit;
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+      if(!m_large_base_ready)
+      {
+         std::vector<unsigned char> flags;
+         std::vector<boost::uint64_t> values;
+         for(boost::uint64_t k = 0; k < prime_sieve_base_limit / prime_sieve_segment; ++k)
+         {
+            sieve_prime_segment(k, flags, m_table.begin(), m_table.end(), m_pattern);
+            prime_collector c(values);
+            for_each_prime_in_segment(k, flags, true, 0, (k + 1) * prime_sieve_segment, c);
+         }
+         m_large_base.assign(values.begin(), values.end());
+         m_large_base_ready = true;
+      }
+      return m_large_base;
+   }
+
+   //
+   // Sieves the segments first <= k < last in rounds, calling v.segment(k - round start, k, flags, complete)
+   // for each, with the segments of a round shared out between threads, and v.end_round() after each round:
+   //
+   template <class Visitor>
+   void visit_segments(boost::uint64_t first, boost::uint64_t last, Visitor& v)
+   {
+      if(first >= last)
+         return;
+      bool complete;
+      const std::vector<boost::uint32_t>& base = base_primes(last * prime_sieve_segment, complete);
+      const unsigned threads = prime_sieve_threads(last - first);
+      const boost::uint64_t round = static_cast<boost::uint64_t>(threads) * prime_sieve_round;
+      for(boost::uint64_t start = first; start < last; start += round)
+      {
+         const std::size_t slots = static_cast<std::size_t>((std::min)(round, last - start));
+         v.begin_round(slots);
+#ifdef BOOST_MATH_PARALLEL_PRIME_SIEVE
+         if(threads > 1)
+         {
+            // Thread t takes the slots t, t + threads, t + 2 * threads, . . . of the round:
+            auto work = [&](unsigned t)
+            {
+               std::vector<unsigned char> flags;
+               for(std::size_t s = t; s < slots; s += threads)
+               {
+                  sieve_prime_segment(start + s, flags, base.begin(), base.end(), m_pattern);
+                  v.segment(s, start + s, flags, complete);
+               }
+            };
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            std::vector<std::exception_ptr> errors(threads);
+            try
+            {
+               for(unsigned t = 0; t < threads; ++t)
+               {
+                  workers.emplace_back([&, t]()
+                  {
+                     try
+                     {
+                        work(t);
+                     }
+                     catch(...)
+                     {
+                        errors[t] = std::current_exception();
+                     }
+                  });
+               }
+            }
+            catch(...)
+            {
+               // A thread could not be started, its slots are sieved below once the others have finished.
+            }
+            const unsigned started = static_cast<unsigned>(workers.size());
+            for(auto& worker : workers)
+            {
+               worker.join();
+            }
+            for(auto const & e : errors)
+            {
+               if(e)
+               {
+                  std::rethrow_exception(e);
+               }
+            }
+            for(unsigned t = started; t < threads; ++t)
+            {
+               work(t);
+            }
+         }
+         else
+#endif
+         {
+            std::vector<unsigned char> flags;
+            for(std::size_t s = 0; s < slots; ++s)
+            {
+               sieve_prime_segment(start + s, flags, base.begin(), base.end(), m_pattern);
+               v.segment(s, start + s, flags, complete);
+            }
+         }
+         v.end_round();
+      }
+   }
+
+   prime_sieve_cache(const prime_sieve_cache&);
+   prime_sieve_cache& operator=(const prime_sieve_cache&);
+
+   // The primes in prime's static table:
+   std::vector<boost::uint32_t> m_table;
+   // The multiples of the primes up to 13 among the odd numbers:
+   std::vector<unsigned char> m_pattern;
+   // The primes below prime_sieve_base_limit, once they are needed, never changed after:
+   std::vector<boost::uint32_t> m_large_base;
+   bool m_large_base_ready;
+   // m_counts[k] is the number of primes below k * prime_sieve_segment:
+   std::vector<boost::uint64_t> m_counts;
+   boost::detail::lightweight_mutex m_mutex;
+};
+
+//
+// Initializer: ensure the cache is constructed prior to the first call of main:
+//
+template <class T>
+struct prime_sieve_initializer
+{
+   struct init
+   {
+      init()
+      {
+         get_cache();
+      }
+      void force_instantiate()const{}
+   };
+   static const init initializer;
+   static prime_sieve_cache& get_cache()
+   {
+      static prime_sieve_cache data;
+      return data;
+   }
+   static void force_instantiate()
+   {
+      initializer.force_instantiate();
+   }
+};
+
+template <class T>
+const typename prime_sieve_initializer<T>::init prime_sieve_initializer<T>::initializer;
+
+inline prime_sieve_cache& get_prime_sieve_cache()
+{
+   prime_sieve_initializer<void>::force_instantiate();
+   return prime_sieve_initializer<void>::get_cache();
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_SF_DETAIL_PRIME_SIEVE_HPP
@@ -0,0 +1,564 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_HURWITZ_ZETA_HPP
+#define BOOST_MATH_SF_HURWITZ_ZETA_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <vector>
+#include <boost/math/special_functions/math_fwd.hpp>
+#include <boost/math/special_functions/zeta.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/sin_pi.hpp>
+#include <boost/math/special_functions/cos_pi.hpp>
+#include <boost/math/special_functions/powm1.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost{ namespace math{
+
+//
+// Evaluates the Riemann and Hurwitz zeta functions and the polylogarithm at many points of one precision.
+// The Bernoulli terms of the Euler-Maclaurin tail, and for types of unknown precision the weights of
+// Borwein's zeta series along with the logarithms they multiply, are tabulated once on construction.
+// The ranges overloads also share the values of zeta(s - k) that the polylogarithm series need for a
+// fixed order s.  All the member functions are const, so one evaluator may be shared between threads.
+//
+template <class T, class Policy = policies::policy<> >
+class zeta_evaluator
+{
+   typedef typename policies::evaluation<T, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename policies::precision<T, Policy>::type precision_type;
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   //
+   // The values of zeta(s - k) and eta(s - k) for k = 0, 1, 2 ..., and of n^-s for n = 1, 2, 3 ...,
+   // for one order s, computed as they are first needed:
+   //
+   class order_values
+   {
+   public:
+      order_values(const zeta_evaluator& evaluator, value_type s) : m_evaluator(evaluator), m_s(s) {}
+      value_type order()const { return m_s; }
+      value_type zeta(unsigned k)
+      {
+         while(m_zetas.size() <= k)
+         {
+            // The pole at 1 is never used, the series take its limit instead:
+            value_type t = m_s - m_zetas.size();
+            m_zetas.push_back(t == 1 ? value_type(0) : m_evaluator.riemann(t));
+         }
+         return m_zetas[k];
+      }
+      value_type eta(unsigned k)
+      {
+         value_type t = m_s - k;
+         if(t == 1)
+            return constants::ln_two<value_type>();
+         return -boost::math::powm1(value_type(2), value_type(1 - t), forwarding_policy()) * zeta(k);
+      }
+      value_type power(unsigned n)
+      {
+         BOOST_MATH_STD_USING
+         while(m_powers.size() < n)
+            m_powers.push_back(pow(value_type(m_powers.size() + 1), -m_s));
+         return m_powers[n - 1];
+      }
+   private:
+      const zeta_evaluator& m_evaluator;
+      value_type m_s;
+      std::vector<value_type> m_zetas;
+      std::vector<value_type> m_powers;
+   };
+
+public:
+   explicit zeta_evaluator(const Policy& = Policy())
+   {
+      BOOST_MATH_STD_USING
+      detail::zeta_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+      const value_type log_epsilon = -log(tools::epsilon<value_type>());
+      //
+      // The sum is taken directly up to x = m_shift + |s|/pi, where the Euler-Maclaurin tail
+      // has a smallest term below epsilon, and we have enough Bernoulli terms to reach it:
+      //
+      m_shift = 3 * log_epsilon / (4 * constants::pi<value_type>());
+      unsigned terms = itrunc(log_epsilon, forwarding_policy()) + 2;
+      m_tail.reserve(terms);
+      value_type factorial = 1;
+      for(unsigned j = 1; j <= terms; ++j)
+      {
+         factorial *= value_type(2 * j - 1) * (2 * j);
+         m_tail.push_back(boost::math::bernoulli_b2n<value_type>(static_cast<int>(j), forwarding_policy()) / factorial);
+      }
+      if(tag_type::value == 0)
+      {
+         //
+         // The weights of algorithm 3 of Borwein, as used by zeta_polynomial_series, so that
+         // zeta(s) = sum(w[j] * exp(-s * log(j + 1))) / (1 - 2^(1-s)):
+         //
+         int n = itrunc(value_type(log_epsilon / 2), forwarding_policy());
+         value_type two_n = ldexp(value_type(1), n);
+         m_weights.reserve(2 * n);
+         m_logs.reserve(2 * n);
+         int ej_sign = 1;
+         for(int j = 0; j < n; ++j)
+         {
+            m_weights.push_back(value_type(ej_sign));
+            m_logs.push_back(log(value_type(j + 1)));
+            ej_sign = -ej_sign;
+         }
+         value_type ej_sum = 1;
+         value_type ej_term = 1;
+         for(int j = n; j <= 2 * n - 1; ++j)
+         {
+            m_weights.push_back(ej_sign * (1 - ej_sum / two_n));
+            m_logs.push_back(log(value_type(j + 1)));
+            ej_sign = -ej_sign;
+            ej_term *= 2 * n - j;
+            ej_term /= j - n + 1;
+            ej_sum += ej_term;
+         }
+      }
+   }
+
+   T zeta(T s)const
+   {
+      return policies::checked_narrowing_cast<T, forwarding_policy>(riemann(static_cast<value_type>(s)), "boost::math::zeta<%1%>(%1%)");
+   }
+   T hurwitz_zeta(T s, T a)const
+   {
+      order_values row(*this, 1 - static_cast<value_type>(s));
+      return policies::checked_narrowing_cast<T, forwarding_policy>(hurwitz(static_cast<value_type>(s), static_cast<value_type>(a), row), "boost::math::hurwitz_zeta<%1%>(%1%, %1%)");
+   }
+   T polylog(T s, T z)const
+   {
+      order_values row(*this, static_cast<value_type>(s));
+      return policies::checked_narrowing_cast<T, forwarding_policy>(polylogarithm(static_cast<value_type>(z), row), "boost::math::polylog<%1%>(%1%, %1%)");
+   }
+
+   template <class InputIterator, class OutputIterator>
+   OutputIterator zeta(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for(; first != last; ++first, ++out)
+         *out = zeta(static_cast<T>(*first));
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator hurwitz_zeta(T s, InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      order_values row(*this, 1 - static_cast<value_type>(s));
+      for(; first != last; ++first, ++out)
+         *out = policies::checked_narrowing_cast<T, forwarding_policy>(hurwitz(static_cast<value_type>(s), static_cast<value_type>(static_cast<T>(*first)), row), "boost::math::hurwitz_zeta<%1%>(%1%, %1%)");
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator polylog(T s, InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      order_values row(*this, static_cast<value_type>(s));
+      for(; first != last; ++first, ++out)
+         *out = policies::checked_narrowing_cast<T, forwarding_policy>(polylogarithm(static_cast<value_type>(static_cast<T>(*first)), row), "boost::math::polylog<%1%>(%1%, %1%)");
+      return out;
+   }
+
+private:
+   value_type riemann(value_type s)const
+   {
+      BOOST_MATH_STD_USING
+      //
+      // Only the series for types of unknown precision is tabulated, everything else is as zeta() does it:
+      //
+      if((tag_type::value != 0) || (floor(s) == s) || (fabs(s) < tools::root_epsilon<value_type>()) || (s > policies::digits<value_type, forwarding_policy>()))
+         return detail::zeta_imp(s, value_type(1 - s), forwarding_policy(), tag_type());
+      if(s > 0)
+         return borwein_series(s);
+      //
+      // Reflection, exactly as zeta_imp:
+      //
+      static const char* function = "boost::math::zeta<%1%>";
+      value_type sc = 1 - s;
+      value_type result;
+      if(sc > max_factorial<value_type>::value)
+      {
+         value_type mult = boost::math::sin_pi(value_type(s / 2), forwarding_policy()) * 2 * borwein_series(sc);
+         result = boost::math::lgamma(sc, forwarding_policy());
+         result -= sc * log(2 * constants::pi<value_type>());
+         if(result > tools::log_max_value<value_type>())
+            return sign(mult) * policies::raise_overflow_error<value_type>(function, 0, forwarding_policy());
+         result = exp(result);
+         if(tools::max_value<value_type>() / fabs(mult) < result)
+            return sign(mult) * policies::raise_overflow_error<value_type>(function, 0, forwarding_policy());
+         result *= mult;
+      }
+      else
+      {
+         result = boost::math::sin_pi(value_type(s / 2), forwarding_policy())
+            * 2 * pow(2 * constants::pi<value_type>(), -sc)
+            * boost::math::tgamma(sc, forwarding_policy())
+            * borwein_series(sc);
+      }
+      return result;
+   }
+
+   value_type borwein_series(value_type s)const
+   {
+      BOOST_MATH_STD_USING
+      value_type sum = 0;
+      for(std::size_t j = 0; j < m_weights.size(); ++j)
+         sum += m_weights[j] * exp(-s * m_logs[j]);
+      return sum / -boost::math::powm1(value_type(2), value_type(1 - s), forwarding_policy());
+   }
+
+   value_type hurwitz(value_type s, value_type a, order_values& row)const
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::hurwitz_zeta<%1%>(%1%, %1%)";
+      if(!(boost::math::isfinite)(s))
+         return policies::raise_domain_error<value_type>(function, "Hurwitz zeta function requires a finite s, but got s=%1%.", s, forwarding_policy());
+      if(!(a > 0) || !(boost::math::isfinite)(a))
+         return policies::raise_domain_error<value_type>(function, "Hurwitz zeta function requires a finite a > 0, but got a=%1%.", a, forwarding_policy());
+      if(s == 1)
+         return policies::raise_pole_error<value_type>(function, "Evaluation of Hurwitz zeta function at pole %1%", s, forwarding_policy());
+      if(a == 1)
+         return riemann(s);
+      value_type x_min = m_shift + fabs(s) / constants::pi<value_type>();
+      if((s < 0) && (a < x_min))
+      {
+         //
+         // The Euler-Maclaurin sum would cancel catastrophically, so we step down to a0 in (0, 1]
+         // and use Hurwitz's formula there, zeta(s, a) = zeta(s, a0) - sum(x^-s), x = a0, a0 + 1, ... a - 1:
+         //
+         value_type a0 = a - floor(a);
+         if(a0 == 0)
+            a0 = 1;
+         value_type result;
+         if(a0 == 1)
+            result = riemann(s);
+         else if(a0 == 0.5f)
+            result = boost::math::powm1(value_type(2), s, forwarding_policy()) * riemann(s);
+         else
+            result = hurwitz_fourier(a0, row);
+         for(value_type x = a0; x < a; x += 1)
+            result -= pow(x, -s);
+         return result;
+      }
+      return hurwitz_euler_maclaurin(s, a, x_min);
+   }
+
+   value_type hurwitz_euler_maclaurin(value_type s, value_type a, value_type x_min)const
+   {
+      BOOST_MATH_STD_USING
+      const value_type eps = tools::epsilon<value_type>();
+      value_type sum = 0;
+      value_type scale = 0;
+      value_type x = a;
+      for(unsigned k = 0; x < x_min; x = a + ++k)
+      {
+         value_type term = pow(x, -s);
+         sum += term;
+         // What remains is no more than term * x / (s - 1):
+         if((s > 1) && (term * x / (s - 1) <= eps * sum))
+            return sum;
+      }
+      value_type xs = pow(x, -s);
+      sum += x * xs / (s - 1) + xs / 2;
+      scale = fabs(sum) + fabs(x * xs / (s - 1));
+      value_type factor = s * xs / x;
+      value_type x2 = x * x;
+      for(unsigned j = 0; j < m_tail.size(); ++j)
+      {
+         value_type term = m_tail[j] * factor;
+         sum += term;
+         if(fabs(term) <= eps * scale)
+            return sum;
+         factor *= (s + 2 * j + 1) * (s + 2 * j + 2) / x2;
+      }
+      return policies::raise_evaluation_error<value_type>("boost::math::hurwitz_zeta<%1%>(%1%, %1%)", "Series did not converge, best value is %1%", sum, forwarding_policy());
+   }
+
+   //
+   // Hurwitz's formula for s < 0 and 0 < a < 1, with sigma = 1 - s:
+   // zeta(s, a) = 2 Gamma(sigma) / (2 pi)^sigma * sum(cos(pi sigma / 2 - 2 pi n a) / n^sigma).
+   // The row holds the values for order sigma.
+   //
+   value_type hurwitz_fourier(value_type a, order_values& row)const
+   {
+      BOOST_MATH_STD_USING
+      const value_type sigma = row.order();
+      const bool reflect = a > 0.5f;
+      const value_type theta = 2 * constants::pi<value_type>() * (reflect ? value_type(1 - a) : a);
+      value_type c = 0;
+      value_type sn = 0;
+      if(sigma * 4 * constants::ln_two<value_type>() >= -log(tools::epsilon<value_type>()))
+      {
+         // Sixteen terms or fewer:
+         const value_type eps = tools::epsilon<value_type>();
+         for(unsigned n = 1; ; ++n)
+         {
+            value_type p = row.power(n);
+            c += cos(n * theta) * p;
+            sn += sin(n * theta) * p;
+            if(p <= eps * (fabs(c) + fabs(sn)))
+               break;
+         }
+      }
+      else
+      {
+         // C + iS is the polylogarithm of order sigma at exp(i theta):
+         exp_series(value_type(0), theta, row, c, sn);
+      }
+      if(reflect)
+         sn = -sn;
+      value_type sum = boost::math::cos_pi(value_type(sigma / 2), forwarding_policy()) * c + boost::math::sin_pi(value_type(sigma / 2), forwarding_policy()) * sn;
+      if(sigma > max_factorial<value_type>::value)
+      {
+         value_type result = boost::math::lgamma(sigma, forwarding_policy()) - sigma * log(2 * constants::pi<value_type>());
+         if(result > tools::log_max_value<value_type>())
+            return sign(sum) * policies::raise_overflow_error<value_type>("boost::math::hurwitz_zeta<%1%>(%1%, %1%)", 0, forwarding_policy());
+         return 2 * exp(result) * sum;
+      }
+      return 2 * boost::math::tgamma(sigma, forwarding_policy()) * pow(2 * constants::pi<value_type>(), -sigma) * sum;
+   }
+
+   //
+   // The polylogarithm of order s = row.order() at exp(mu), for complex mu = mr + i mi with |mu| < 2 pi:
+   // Li_s(exp(mu)) = Gamma(1 - s) (-mu)^(s-1) + sum(zeta(s - k) mu^k / k!).
+   // For integer s = n > 0 the poles of Gamma(1 - s) and zeta(s - n + 1) cancel, leaving the term
+   // mu^(n-1) / (n-1)! (H(n-1) - log(-mu)) in place of the k = n - 1 term of the sum.
+   //
+   void exp_series(value_type mr, value_type mi, order_values& row, value_type& re, value_type& im)const
+   {
+      BOOST_MATH_STD_USING
+      const value_type s = row.order();
+      const value_type eps = tools::epsilon<value_type>();
+      const value_type r = sqrt(mr * mr + mi * mi);
+      const value_type phi = atan2(-mi, -mr);
+      const bool integer_order = (s >= 1) && (floor(s) == s);
+      const unsigned n = integer_order ? itrunc(s, forwarding_policy()) : 0;
+      re = 0;
+      im = 0;
+      if(!integer_order)
+      {
+         value_type g = boost::math::tgamma(value_type(1 - s), forwarding_policy()) * pow(r, s - 1);
+         re = g * cos((s - 1) * phi);
+         im = g * sin((s - 1) * phi);
+      }
+      // mu^k / k!
+      value_type pr = 1;
+      value_type pi = 0;
+      boost::uintmax_t max_iter = policies::get_max_series_iterations<forwarding_policy>();
+      unsigned small_terms = 0;
+      for(unsigned k = 0; ; ++k)
+      {
+         value_type tr, ti;
+         if(integer_order && (k + 1 == n))
+         {
+            value_type h = 0;
+            for(unsigned i = 1; i < n; ++i)
+               h += value_type(1) / i;
+            value_type lr = h - log(r);
+            value_type li = -phi;
+            tr = pr * lr - pi * li;
+            ti = pr * li + pi * lr;
+         }
+         else
+         {
+            value_type z = row.zeta(k);
+            tr = z * pr;
+            ti = z * pi;
+         }
+         re += tr;
+         im += ti;
+         // Every other zeta(s - k) may be a trivial zero, so we wait for two small terms in a row:
+         if((k > s) && (fabs(tr) + fabs(ti) <= eps * (fabs(re) + fabs(im))))
+         {
+            if(++small_terms == 2)
+               break;
+         }
+         else
+            small_terms = 0;
+         if(k >= max_iter)
+         {
+            policies::raise_evaluation_error<value_type>("boost::math::polylog<%1%>(%1%, %1%)", "Series did not converge, best value is %1%", re, forwarding_policy());
+            break;
+         }
+         value_type next_r = (pr * mr - pi * mi) / (k + 1);
+         pi = (pr * mi + pi * mr) / (k + 1);
+         pr = next_r;
+      }
+   }
+
+   value_type polylogarithm(value_type z, order_values& row)const
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::polylog<%1%>(%1%, %1%)";
+      const value_type s = row.order();
+      const value_type eps = tools::epsilon<value_type>();
+      if(!(boost::math::isfinite)(s))
+         return policies::raise_domain_error<value_type>(function, "Polylogarithm requires a finite order, but got s=%1%.", s, forwarding_policy());
+      if(!(z <= 1) || !(boost::math::isfinite)(z))
+         return policies::raise_domain_error<value_type>(function, "Polylogarithm is complex valued for z > 1, and requires a finite z, but got z=%1%.", z, forwarding_policy());
+      if(z == 1)
+      {
+         if(s > 1)
+            return riemann(s);
+         return policies::raise_overflow_error<value_type>(function, "Polylogarithm diverges at z = 1 for orders s <= 1.", forwarding_policy());
+      }
+      if(z == 0)
+         return 0;
+      const bool integer_order = floor(s) == s;
+      if(integer_order && (s == 0))
+         return z / (1 - z);
+      if(integer_order && (s == 1))
+         return -boost::math::log1p(-z, forwarding_policy());
+      //
+      // The series in log(-z) is used for -2 <= z <= -1/2, and for s < 0 down to z = -exp(-2), as the
+      // terms of the defining series then grow and alternate in sign before they fall:
+      //
+      const bool log_series = (z < 0) && (z >= -2) && ((z <= -0.5f) || ((s < 0) && (log(-z) >= -2)));
+      if(!log_series && ((fabs(z) <= 0.5f) || ((fabs(z) <= 1) && (s * 4 * constants::ln_two<value_type>() >= -log(eps)))))
+      {
+         // The defining series:
+         value_type sum = 0;
+         value_type zk = 1;
+         boost::uintmax_t max_iter = policies::get_max_series_iterations<forwarding_policy>();
+         for(unsigned k = 1; ; ++k)
+         {
+            zk *= z;
+            value_type term = zk * row.power(k);
+            sum += term;
+            // For s < 0 the terms grow at first, so we only stop once they are falling:
+            if((fabs(term) <= eps * fabs(sum)) && ((s >= 0) || (k * -log(fabs(z)) > -s)))
+               break;
+            if(k >= max_iter)
+               return policies::raise_evaluation_error<value_type>(function, "Series did not converge, best value is %1%", sum, forwarding_policy());
+         }
+         return sum;
+      }
+      if(z > 0)
+      {
+         value_type re, im;
+         exp_series(value_type(log(z)), value_type(0), row, re, im);
+         return re;
+      }
+      if(log_series)
+      {
+         //
+         // Li_s(-exp(u)) = -sum(eta(s - k) u^k / k!), convergent for |u| < pi:
+         //
+         const value_type u = log(-z);
+         value_type sum = 0;
+         value_type p = 1;
+         unsigned small_terms = 0;
+         boost::uintmax_t max_iter = policies::get_max_series_iterations<forwarding_policy>();
+         for(unsigned k = 0; ; ++k)
+         {
+            value_type term = row.eta(k) * p;
+            sum += term;
+            if((k > s) && (fabs(term) <= eps * fabs(sum)))
+            {
+               if(++small_terms == 2)
+                  break;
+            }
+            else
+               small_terms = 0;
+            if(k >= max_iter)
+               return policies::raise_evaluation_error<value_type>(function, "Series did not converge, best value is %1%", value_type(-sum), forwarding_policy());
+            p *= u / (k + 1);
+         }
+         return -sum;
+      }
+      if(!integer_order)
+         return policies::raise_domain_error<value_type>(function, "Polylogarithm of non-integer order is only implemented for z >= -2, but got z=%1%.", z, forwarding_policy());
+      //
+      // Inversion for integer orders n, with x = -z > 2:
+      // Li_n(-x) = -(-1)^n Li_n(-1/x) - log(x)^n / n! - 2 sum(log(x)^(n-2k) / (n-2k)! eta(2k)), k = 1..n/2,
+      // and Li_-n(-x) = (-1)^(n+1) Li_-n(-1/x).
+      //
+      int n = itrunc(s, forwarding_policy());
+      value_type inverse = polylogarithm(value_type(1 / z), row);
+      if(n < 0)
+         return (n & 1) ? inverse : value_type(-inverse);
+      value_type result = (n & 1) ? inverse : value_type(-inverse);
+      const value_type lx = log(-z);
+      value_type p = 1;
+      for(int j = 0; j <= n; ++j)
+      {
+         if(((n - j) & 1) == 0)
+         {
+            int k = (n - j) / 2;
+            if(k == 0)
+               result -= p;
+            else
+               result -= 2 * p * -boost::math::powm1(value_type(2), value_type(1 - 2 * k), forwarding_policy()) * riemann(value_type(2 * k));
+         }
+         p *= lx / (j + 1);
+      }
+      return result;
+   }
+
+   value_type m_shift;
+   std::vector<value_type> m_tail;
+   std::vector<value_type> m_weights;
+   std::vector<value_type> m_logs;
+};
+
+namespace detail{
+
+//
+// The free functions share one evaluator per thread, rebuilt whenever the precision of T changes:
+//
+template <class T, class Policy>
+const zeta_evaluator<T, Policy>& get_zeta_evaluator()
+{
+   typedef typename policies::evaluation<T, Policy>::type value_type;
+   static BOOST_MATH_THREAD_LOCAL zeta_evaluator<T, Policy> evaluator;
+   static BOOST_MATH_THREAD_LOCAL int digits = tools::digits<value_type>();
+   int current_digits = tools::digits<value_type>();
+   if(digits != current_digits)
+   {
+      // Oh my precision has changed...
+      evaluator = zeta_evaluator<T, Policy>();
+      digits = current_digits;
+   }
+   return evaluator;
+}
+
+} // namespace detail
+
+template <class T1, class T2, class Policy>
+inline typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a, const Policy&)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   return detail::get_zeta_evaluator<result_type, Policy>().hurwitz_zeta(static_cast<result_type>(s), static_cast<result_type>(a));
+}
+
+template <class T1, class T2>
+inline typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a)
+{
+   return hurwitz_zeta(s, a, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_HURWITZ_ZETA_HPP
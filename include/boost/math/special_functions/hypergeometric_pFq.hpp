@@ -17,6 +17,8 @@
 #include <boost/math/special_functions/detail/hypergeometric_pFq_checked_series.hpp>
 #include <chrono>
 #include <initializer_list>
+#include <limits>
+#include <vector>
 
 namespace boost {
    namespace math {
@@ -89,6 +91,329 @@ namespace boost {
          return hypergeometric_pFq<std::initializer_list<R>, Real>(aj, bj, z, p_abs_error);
       }
 
+      //
+      // Evaluates pFq with fixed a and b parameters at many z.  The ratios of successive terms of the series,
+      // without the factor z, are tabulated once, and the series is then summed for a block of z values at
+      // a time, each z leaving the block as soon as its own sum has converged.  Values of z for which the
+      // series needs more than straightforward summation from the zeroth term - where one of the b's crosses
+      // the origin, where 1F1 has a late maximum, or where an error has to be raised - are passed on to the
+      // same checked series as hypergeometric_pFq.
+      //
+      template <class Real, class Policy = policies::policy<> >
+      class hypergeometric_pFq_evaluator
+      {
+         typedef typename policies::evaluation<Real, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         // The number of z values summed together:
+         static const std::size_t block_size = 64;
+         // The number of ratios tabulated by the constructor, later ratios are computed as they are needed:
+         static const std::size_t tabulated_ratios = 256;
+         // The number of terms each z is taken through before moving on to the next:
+         static const std::size_t run_length = 8;
+
+      public:
+         template <class Seq>
+         hypergeometric_pFq_evaluator(const Seq& aj, const Seq& bj, const Policy& pol = Policy())
+            : m_a(aj.begin(), aj.end()), m_b(bj.begin(), bj.end()), m_policy(pol)
+         {
+            init();
+         }
+         template <class R>
+         hypergeometric_pFq_evaluator(const std::initializer_list<R>& aj, const std::initializer_list<R>& bj, const Policy& pol = Policy())
+            : m_a(aj.begin(), aj.end()), m_b(bj.begin(), bj.end()), m_policy(pol)
+         {
+            init();
+         }
+
+         Real operator()(const Real& z, Real* p_abs_error = 0)const
+         {
+            value_type x(z), result, error;
+            evaluate_block(&x, 1, &result, &error);
+            if (p_abs_error)
+               *p_abs_error = static_cast<Real>(error);
+            return policies::checked_narrowing_cast<Real, Policy>(result, "boost::math::hypergeometric_pFq<%1%>(%1%,%1%,%1%)");
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out)const
+         {
+            return evaluate(first, last, out, static_cast<Real**>(0));
+         }
+
+         //
+         // As above, but also writes the estimated absolute error in each result to abs_errors:
+         //
+         template <class InputIterator, class OutputIterator, class ErrorIterator>
+         OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out, ErrorIterator abs_errors)const
+         {
+            return evaluate(first, last, out, &abs_errors);
+         }
+
+      private:
+         void init()
+         {
+            BOOST_MATH_STD_USING
+            const std::size_t p = m_a.size();
+            const std::size_t q = m_b.size();
+            m_always_checked = (p > q + 1) || (q > BOOST_MATH_PFQ_MAX_B_TERMS);
+            m_checked_above_one = (p == q + 1);
+            //
+            // The first term at which one of the b's is zero, unless one of the a's is zero there first
+            // and terminates the series:
+            //
+            m_pole = (std::numeric_limits<boost::uintmax_t>::max)();
+            boost::uintmax_t polynomial_end = (std::numeric_limits<boost::uintmax_t>::max)();
+            for (auto ai = m_a.begin(); ai != m_a.end(); ++ai)
+            {
+               if ((*ai <= 0) && (floor(*ai) == *ai))
+                  polynomial_end = (std::min)(polynomial_end, static_cast<boost::uintmax_t>(lltrunc(-*ai)));
+            }
+            //
+            // Beyond the 1F1 case, the series restarts where each b crosses the origin, and only
+            // sums which stop before that are handled here:
+            //
+            m_crossover = 0;
+            for (auto bi = m_b.begin(); bi != m_b.end(); ++bi)
+            {
+               // b == 0 is a pole at the very first term:
+               if (*bi <= 0)
+               {
+                  m_crossover = (std::max)(m_crossover, static_cast<boost::uintmax_t>(lltrunc(-*bi)) + 1);
+                  if ((floor(*bi) == *bi) && (static_cast<boost::uintmax_t>(lltrunc(-*bi)) < polynomial_end))
+                     m_pole = (std::min)(m_pole, static_cast<boost::uintmax_t>(lltrunc(-*bi)));
+               }
+            }
+            m_end = (std::min)(m_pole, polynomial_end);
+            m_ratios.reserve(tabulated_ratios);
+            for (std::size_t k = 0; k < tabulated_ratios; ++k)
+               m_ratios.push_back(ratio(k));
+         }
+
+         //
+         // The ratio of term k + 1 to term k, without the factor z, or zero when the series terminates:
+         //
+         value_type ratio(boost::uintmax_t k)const
+         {
+            if (k < m_ratios.size())
+               return m_ratios[static_cast<std::size_t>(k)];
+            if (k >= m_end)
+               return 0;
+            value_type r = 1;
+            for (auto ai = m_a.begin(); ai != m_a.end(); ++ai)
+               r *= *ai + k;
+            if (r == 0)
+               return r;
+            for (auto bi = m_b.begin(); bi != m_b.end(); ++bi)
+               r /= *bi + k;
+            return r / (k + 1);
+         }
+
+         template <class InputIterator, class OutputIterator, class ErrorIterator>
+         OutputIterator evaluate(InputIterator first, InputIterator last, OutputIterator out, ErrorIterator* abs_errors)const
+         {
+            value_type z[block_size], results[block_size], errors[block_size];
+            while (first != last)
+            {
+               std::size_t n = 0;
+               for (; (n < block_size) && (first != last); ++n, ++first)
+                  z[n] = static_cast<value_type>(*first);
+               evaluate_block(z, n, results, errors);
+               for (std::size_t i = 0; i < n; ++i)
+               {
+                  *out = policies::checked_narrowing_cast<Real, Policy>(results[i], "boost::math::hypergeometric_pFq<%1%>(%1%,%1%,%1%)");
+                  ++out;
+                  if (abs_errors)
+                  {
+                     **abs_errors = static_cast<Real>(errors[i]);
+                     ++*abs_errors;
+                  }
+               }
+            }
+            return out;
+         }
+
+         //
+         // The checked series, exactly as used by hypergeometric_pFq:
+         //
+         void checked(const value_type& z, value_type& result, value_type& error)const
+         {
+            BOOST_MATH_STD_USING
+            int scale = 0;
+            std::pair<value_type, value_type> r = boost::math::detail::hypergeometric_pFq_checked_series_impl(m_a, m_b, z, m_policy, boost::math::detail::iteration_terminator(boost::math::policies::get_max_series_iterations<forwarding_policy>()), scale);
+            result = r.first * exp(value_type(scale));
+            error = r.second * exp(value_type(scale)) * boost::math::tools::epsilon<Real>();
+         }
+
+         void evaluate_block(const value_type* z, std::size_t n, value_type* results, value_type* errors)const
+         {
+            BOOST_MATH_STD_USING
+            const value_type tol = boost::math::policies::get_epsilon<value_type, Policy>();
+            const value_type upper_limit(sqrt(boost::math::tools::max_value<value_type>()));
+            const value_type lower_limit(1 / upper_limit);
+            const int log_scaling_factor = itrunc(boost::math::tools::log_max_value<value_type>()) - 2;
+            const value_type scaling_factor = exp(value_type(log_scaling_factor));
+            const boost::uintmax_t max_iter = boost::math::policies::get_max_series_iterations<forwarding_policy>();
+
+            value_type term[block_size], sum[block_size], abs_sum[block_size], term0[block_size];
+            int log_scale[block_size];
+            std::size_t active[block_size];
+            std::size_t n_active = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               if (m_always_checked || !(boost::math::isfinite)(z[i]) || (m_checked_above_one && (fabs(z[i]) >= 1)))
+                  checked(z[i], results[i], errors[i]);
+               else
+               {
+                  term[i] = 1;
+                  sum[i] = 1;
+                  abs_sum[i] = 1;
+                  term0[i] = 0;
+                  log_scale[i] = 0;
+                  active[n_active++] = i;
+               }
+            }
+            boost::uintmax_t k = 0;
+            while (n_active && (k < max_iter))
+            {
+               if (k == m_pole)
+               {
+                  // Let the checked series raise the error:
+                  for (std::size_t j = 0; j < n_active; ++j)
+                     checked(z[active[j]], results[active[j]], errors[active[j]]);
+                  return;
+               }
+               //
+               // Each z in turn is taken through the next few terms, so that its state stays in registers:
+               //
+               value_type r[run_length];
+               boost::uintmax_t steps = run_length;
+               if (m_pole - k < steps)
+                  steps = m_pole - k;
+               if (max_iter - k < steps)
+                  steps = max_iter - k;
+               for (std::size_t s = 0; s < steps; ++s)
+                  r[s] = ratio(k + s);
+               std::size_t still_active = 0;
+               for (std::size_t j = 0; j < n_active; ++j)
+               {
+                  const std::size_t i = active[j];
+                  value_type t = term[i], s = sum[i], a = abs_sum[i], t0 = term0[i];
+                  int ls = log_scale[i];
+                  bool done = true;
+                  for (std::size_t m = 0;; ++m)
+                  {
+                     if (m == steps)
+                     {
+                        done = false;
+                        break;
+                     }
+                     t *= r[m];
+                     if (t == 0)
+                     {
+                        // One of the a's is a negative integer, and the series has terminated:
+                        finish(s, a, ls, results[i], errors[i]);
+                        break;
+                     }
+                     t *= z[i];
+                     s += t;
+                     a += fabs(t);
+                     if (a >= upper_limit)
+                     {
+                        a /= scaling_factor;
+                        s /= scaling_factor;
+                        t /= scaling_factor;
+                        ls += log_scaling_factor;
+                     }
+                     if (a < lower_limit)
+                     {
+                        a *= scaling_factor;
+                        s *= scaling_factor;
+                        t *= scaling_factor;
+                        ls -= log_scaling_factor;
+                     }
+                     if ((fabs(s * tol) > fabs(t)) && (fabs(t0) > fabs(t)))
+                     {
+                        if (crosses_origin_after(z[i], k + m + 1))
+                           checked(z[i], results[i], errors[i]);
+                        else
+                           finish(s, a, ls, results[i], errors[i]);
+                        break;
+                     }
+                     if (a * tol > fabs(s))
+                     {
+                        // No correct bits left, let the checked series raise the error:
+                        checked(z[i], results[i], errors[i]);
+                        break;
+                     }
+                     t0 = t;
+                  }
+                  if (!done)
+                  {
+                     term[i] = t;
+                     sum[i] = s;
+                     abs_sum[i] = a;
+                     term0[i] = t0;
+                     log_scale[i] = ls;
+                     active[still_active++] = i;
+                  }
+               }
+               n_active = still_active;
+               k += steps;
+            }
+            //
+            // Any left have run out of iterations, and the checked series stops at the same point:
+            //
+            for (std::size_t j = 0; j < n_active; ++j)
+            {
+               const std::size_t i = active[j];
+               if (crosses_origin_after(z[i], k))
+                  checked(z[i], results[i], errors[i]);
+               else
+                  finish(sum[i], abs_sum[i], log_scale[i], results[i], errors[i]);
+            }
+         }
+
+         void finish(const value_type& sum, const value_type& abs_sum, int log_scale, value_type& result, value_type& error)const
+         {
+            BOOST_MATH_STD_USING
+            value_type scale = exp(value_type(log_scale));
+            result = sum * scale;
+            error = abs_sum * scale * boost::math::tools::epsilon<Real>();
+         }
+
+         //
+         // True if the checked series would carry on beyond term k for this z:
+         //
+         bool crosses_origin_after(const value_type& z, boost::uintmax_t k)const
+         {
+            if ((m_a.size() == 1) && (m_b.size() == 1))
+            {
+               unsigned crossover_locations[BOOST_MATH_PFQ_MAX_B_TERMS];
+               unsigned n = boost::math::detail::set_crossover_locations(m_a, m_b, z, crossover_locations);
+               for (unsigned i = 0; i < n; ++i)
+               {
+                  if (k < crossover_locations[i])
+                     return true;
+               }
+               return false;
+            }
+            return k < m_crossover;
+         }
+
+         std::vector<value_type> m_a, m_b;
+         std::vector<value_type> m_ratios;
+         // The first term at which a b is zero, the first term with no later terms, and as set_crossover_locations:
+         boost::uintmax_t m_pole, m_end, m_crossover;
+         bool m_always_checked, m_checked_above_one;
+         Policy m_policy;
+      };
+
       template <class T>
       struct scoped_precision
       {
@@ -311,6 +311,12 @@ namespace boost
    typename tools::promote_args<T1, T2>::type
       spherical_harmonic_i(unsigned n, int m, T1 theta, T2 phi, const Policy& pol);
 
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator spherical_harmonics(unsigned max_degree, T1 theta, T2 phi, OutputIterator out);
+
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator spherical_harmonics(unsigned max_degree, T1 theta, T2 phi, OutputIterator out, const Policy& pol);
+
    // Elliptic integrals:
    template <class T1, class T2, class T3>
    typename tools::promote_args<T1, T2, T3>::type
@@ -778,6 +784,30 @@ namespace boost
                          OutputIterator out_it,
                          const Policy&);
 
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_j_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it);
+
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_j_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy&);
+
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_neumann_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it);
+
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_neumann_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy&);
+
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_i_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it);
+
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_i_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy&);
+
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_k_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it);
+
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_k_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy&);
+
    template <class T1, class T2>
    std::complex<typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type> cyl_hankel_1(T1 v, T2 x);
 
@@ -1017,6 +1047,18 @@ namespace boost
    template <class T>
    typename tools::promote_args<T>::type zeta(T s);
 
+   template <class T1, class T2, class Policy>
+   typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a, const Policy&);
+
+   template <class T1, class T2>
+   typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a);
+
+   template <class T1, class T2, class Policy>
+   typename tools::promote_args<T1, T2>::type polylog(T1 s, T2 z, const Policy&);
+
+   template <class T1, class T2>
+   typename tools::promote_args<T1, T2>::type polylog(T1 s, T2 z);
+
    // pow:
    template <int N, typename T, class Policy>
    typename tools::promote_args<T>::type pow(T base, const Policy& policy);
@@ -1084,6 +1126,10 @@ namespace boost
    OutputIterator tangent_t2n(const int start_index,
                                        const unsigned number_of_bernoullis_b2n,
                                        OutputIterator out_it);
+   template <class T>
+   void prefill_bernoulli_b2n(const unsigned number_of_bernoullis_b2n, unsigned threads);
+   template <class T>
+   void prefill_bernoulli_b2n(const unsigned number_of_bernoullis_b2n);
 
    // Lambert W:
    template <class T, class Policy>
@@ -1285,6 +1331,9 @@ namespace boost
    template <class T1, class T2, class Policy>\
    inline typename boost::math::tools::promote_args<T1, T2>::type \
       spherical_harmonic_i(unsigned n, int m, T1 theta, T2 phi, const Policy& pol);\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator spherical_harmonics(unsigned max_degree, T1 theta, T2 phi, OutputIterator out){ return boost::math::spherical_harmonics(max_degree, theta, phi, out, Policy()); }\
 \
    template <class T1, class T2, class T3>\
    inline typename boost::math::tools::promote_args<T1, T2, T3>::type \
@@ -1508,6 +1557,22 @@ template <class OutputIterator, class T>\
                                 unsigned number_of_zeros,\
                                 OutputIterator out_it)\
    { boost::math::cyl_neumann_zero(v, start_index, number_of_zeros, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_j_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_j_sequence(v0, number_of_orders, x, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_neumann_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)\
+   { return boost::math::cyl_neumann_sequence(v0, number_of_orders, x, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_i_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_i_sequence(v0, number_of_orders, x, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_k_sequence(T1 v0, unsigned number_of_orders, T2 x, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_k_sequence(v0, number_of_orders, x, out_it, Policy()); }\
 \
    template <class T>\
    inline typename boost::math::tools::promote_args<T>::type sin_pi(T x){ return boost::math::sin_pi(x); }\
@@ -1535,6 +1600,12 @@ template <class OutputIterator, class T>\
    template <class T>\
    inline typename boost::math::tools::promote_args<T>::type zeta(T s){ return boost::math::zeta(s, Policy()); }\
    \
+   template <class T1, class T2>\
+   inline typename boost::math::tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a){ return boost::math::hurwitz_zeta(s, a, Policy()); }\
+   \
+   template <class T1, class T2>\
+   inline typename boost::math::tools::promote_args<T1, T2>::type polylog(T1 s, T2 z){ return boost::math::polylog(s, z, Policy()); }\
+   \
    template <class T>\
    inline T round(const T& v){ using boost::math::round; return round(v, Policy()); }\
    \
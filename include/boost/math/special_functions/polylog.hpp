@@ -0,0 +1,32 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_POLYLOG_HPP
+#define BOOST_MATH_SF_POLYLOG_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <boost/math/special_functions/hurwitz_zeta.hpp>
+
+namespace boost{ namespace math{
+
+template <class T1, class T2, class Policy>
+inline typename tools::promote_args<T1, T2>::type polylog(T1 s, T2 z, const Policy&)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   return detail::get_zeta_evaluator<result_type, Policy>().polylog(static_cast<result_type>(s), static_cast<result_type>(z));
+}
+
+template <class T1, class T2>
+inline typename tools::promote_args<T1, T2>::type polylog(T1 s, T2 z)
+{
+   return polylog(s, z, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_POLYLOG_HPP
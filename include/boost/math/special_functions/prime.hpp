@@ -19,6 +19,13 @@
 
 namespace boost{ namespace math{
 
+   namespace detail{
+
+   template <class Policy>
+   boost::uint32_t sieved_prime(unsigned n, const Policy& pol);
+
+   }
+
    template <class Policy>
    BOOST_MATH_CONSTEXPR_TABLE_FUNCTION boost::uint32_t prime(unsigned n, const Policy& pol)
    {
@@ -1221,8 +1228,8 @@ namespace boost{ namespace math{
          return a2[n - b1 - 1];
       if(n >= b3)
       {
-         return boost::math::policies::raise_domain_error<boost::uint32_t>(
-            "boost::math::prime<%1%>", "Argument n out of range: got %1%", n, pol);
+         // Beyond the table, find the prime with a segmented sieve:
+         return boost::math::detail::sieved_prime(n, pol);
       }
       return static_cast<boost::uint32_t>(a3[n - b2 - 1]) + 0xFFFFu;
    }
@@ -1233,6 +1240,111 @@ namespace boost{ namespace math{
    }
 
    static const unsigned max_prime = 9999;
+   //
+   // The largest value of n for which prime(n) fits in 32 bits, values above max_prime
+   // are found by sieving:
+   //
+   static const unsigned max_sieved_prime = 203280220;
+
+}} // namespace boost and math
+
+#include <boost/math/special_functions/detail/prime_sieve.hpp>
+
+namespace boost{ namespace math{
+
+   namespace detail{
+
+   template <class Policy>
+   boost::uint32_t sieved_prime(unsigned n, const Policy& pol)
+   {
+      if(n > max_sieved_prime)
+      {
+         return boost::math::policies::raise_domain_error<boost::uint32_t>(
+            "boost::math::prime<%1%>", "Argument n out of range: got %1%", n, pol);
+      }
+      return get_prime_sieve_cache().nth(n);
+   }
+
+   // The sieve can't go beyond this:
+   static const boost::uint64_t max_sieve_argument = ~static_cast<boost::uint64_t>(0u) - prime_sieve_segment;
+
+   }
+
+   //
+   // The number of primes not greater than x:
+   //
+   template <class Policy>
+   boost::uint64_t prime_count(boost::uint64_t x, const Policy& pol)
+   {
+      if(x > detail::max_sieve_argument)
+      {
+         return boost::math::policies::raise_domain_error<boost::uint64_t>(
+            "boost::math::prime_count<%1%>", "Argument x out of range: got %1%", x, pol);
+      }
+      return detail::get_prime_sieve_cache().count_below(x + 1);
+   }
+
+   inline boost::uint64_t prime_count(boost::uint64_t x)
+   {
+      return boost::math::prime_count(x, boost::math::policies::policy<>());
+   }
+
+   //
+   // Deterministic for all 64-bit n:
+   //
+   inline bool is_prime(boost::uint64_t n)
+   {
+      return detail::is_prime_imp(n);
+   }
+
+   //
+   // The smallest prime greater than n:
+   //
+   template <class Policy>
+   boost::uint64_t next_prime(boost::uint64_t n, const Policy& pol)
+   {
+      // The largest prime which fits in 64 bits:
+      static const boost::uint64_t largest = ~static_cast<boost::uint64_t>(0u) - 58;
+      if(n >= largest)
+      {
+         return boost::math::policies::raise_domain_error<boost::uint64_t>(
+            "boost::math::next_prime<%1%>", "No larger prime fits in 64 bits: got %1%", n, pol);
+      }
+      if(n < 2)
+         return 2;
+      boost::uint64_t p = (n + 1) | 1u;
+      while(!detail::is_prime_imp(p))
+         p += 2;
+      return p;
+   }
+
+   inline boost::uint64_t next_prime(boost::uint64_t n)
+   {
+      return boost::math::next_prime(n, boost::math::policies::policy<>());
+   }
+
+   //
+   // Writes the primes p with a <= p < b to out, in order:
+   //
+   template <class OutputIterator, class Policy>
+   OutputIterator prime_range(boost::uint64_t a, boost::uint64_t b, OutputIterator out, const Policy& pol)
+   {
+      if(b > detail::max_sieve_argument)
+      {
+         boost::math::policies::raise_domain_error<boost::uint64_t>(
+            "boost::math::prime_range<%1%>", "Argument b out of range: got %1%", b, pol);
+         return out;
+      }
+      if(b <= a)
+         return out;
+      return detail::get_prime_sieve_cache().copy_primes(a, b, out);
+   }
+
+   template <class OutputIterator>
+   inline OutputIterator prime_range(boost::uint64_t a, boost::uint64_t b, OutputIterator out)
+   {
+      return boost::math::prime_range(a, b, out, boost::math::policies::policy<>());
+   }
 
 }} // namespace boost and math
 
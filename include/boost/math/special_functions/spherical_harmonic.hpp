@@ -15,6 +15,8 @@
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/tools/workaround.hpp>
 #include <complex>
+#include <cstddef>
+#include <vector>
 
 namespace boost{
 namespace math{
@@ -196,6 +198,150 @@ inline typename tools::promote_args<T1, T2>::type
    return boost::math::spherical_harmonic_i(n, m, theta, phi, policies::policy<>());
 }
 
+//
+// Evaluates all the spherical harmonics Y_n^m(theta, phi) of degree n <= max_degree and order 0 <= m <= n at once, in
+// O(max_degree^2) operations for each direction, writing them to an output iterator as a triangular array: Y_n^m is
+// element index(n, m) = n(n+1)/2 + m. The harmonics of negative order follow from Y_n^-m = (-1)^m conj(Y_n^m).
+//
+// The normalised associated Legendre functions N_n^m P_n^m(cos(theta)) are found by the recurrences
+//
+//   N_m^m P_m^m = -sqrt((2m+1)/(2m)) sin(theta) N_{m-1}^{m-1} P_{m-1}^{m-1},   N_0^0 P_0^0 = 1/sqrt(4 pi),
+//   N_n^m P_n^m = a_{n,m} cos(theta) N_{n-1}^m P_{n-1}^m - (a_{n,m}/a_{n-1,m}) N_{n-2}^m P_{n-2}^m,
+//
+// with a_{n,m} = sqrt((4n^2-1)/(n^2-m^2)), which are stable and free of the factorial ratios of the unnormalised
+// functions. The coefficients depend only on the degree and order, so they are tabulated once, when the evaluator is
+// constructed, and shared by every direction it is used for. The diagonal terms go as sin(theta)^m, which underflows for
+// the orders of large expansions long before the terms of higher degree have grown back into range, so each order
+// carries a binary exponent of its own until its terms are representable.
+//
+template <class T, class Policy = policies::policy<> >
+class spherical_harmonic_evaluator
+{
+   typedef typename policies::evaluation<T, Policy>::type value_type;
+public:
+   explicit spherical_harmonic_evaluator(unsigned max_degree, const Policy& = Policy())
+      : m_max_degree(max_degree), m_diagonal(max_degree + 1), m_a(size()), m_c(size())
+   {
+      BOOST_MATH_STD_USING
+      for(unsigned m = 1; m <= max_degree; ++m)
+      {
+         m_diagonal[m] = -sqrt(value_type(2 * m + 1) / (2 * m));
+      }
+      for(unsigned n = 1; n <= max_degree; ++n)
+      {
+         for(unsigned m = 0; m < n; ++m)
+         {
+            m_a[index(n, m)] = sqrt(value_type(4 * value_type(n) * n - 1) / ((value_type(n) - m) * (value_type(n) + m)));
+            m_c[index(n, m)] = (m + 1 < n) ? value_type(m_a[index(n, m)] / m_a[index(n - 1, m)]) : value_type(0);
+         }
+      }
+   }
+
+   unsigned max_degree() const { return m_max_degree; }
+   std::size_t size() const { return (static_cast<std::size_t>(m_max_degree) + 1) * (m_max_degree + 2) / 2; }
+   static std::size_t index(unsigned n, unsigned m) { return static_cast<std::size_t>(n) * (n + 1) / 2 + m; }
+
+   template <class OutputIterator>
+   OutputIterator operator()(T theta, T phi, OutputIterator out) const
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::spherical_harmonic_evaluator<%1%>::operator()(%1%, %1%)";
+
+      const value_type x = cos(value_type(theta));
+      const value_type s = sin(value_type(theta));
+
+      // Terms are kept between 2^-scale_exponent and 2^scale_exponent, with the rest of their exponent alongside:
+      const int scale_exponent = itrunc(tools::log_max_value<value_type>() / (2 * constants::ln_two<value_type>()), Policy());
+      const value_type scale = ldexp(value_type(1), scale_exponent);
+      const value_type inverse_scale = ldexp(value_type(1), -scale_exponent);
+
+      std::vector<value_type> cos_m_phi(m_max_degree + 1);
+      std::vector<value_type> sin_m_phi(m_max_degree + 1);
+      for(unsigned m = 0; m <= m_max_degree; ++m)
+      {
+         cos_m_phi[m] = cos(m * value_type(phi));
+         sin_m_phi[m] = sin(m * value_type(phi));
+      }
+
+      // The last two terms of each order, and their exponents:
+      std::vector<value_type> p1(m_max_degree + 1);
+      std::vector<value_type> p2(m_max_degree + 1);
+      std::vector<int> exponent(m_max_degree + 1);
+      value_type diagonal = 1 / (2 * constants::root_pi<value_type>());
+      int diagonal_exponent = 0;
+
+      for(unsigned n = 0; n <= m_max_degree; ++n)
+      {
+         if(n > 0)
+         {
+            diagonal *= m_diagonal[n] * s;
+            if((diagonal != 0) && (fabs(diagonal) < inverse_scale))
+            {
+               diagonal *= scale;
+               diagonal_exponent -= scale_exponent;
+            }
+         }
+         for(unsigned m = 0; m <= n; ++m)
+         {
+            value_type p;
+            if(m == n)
+            {
+               p = diagonal;
+               p2[m] = 0;
+               exponent[m] = diagonal_exponent;
+            }
+            else
+            {
+               p = m_a[index(n, m)] * x * p1[m] - m_c[index(n, m)] * p2[m];
+               p2[m] = p1[m];
+               if((exponent[m] < 0) && (fabs(p) > scale))
+               {
+                  p *= inverse_scale;
+                  p2[m] *= inverse_scale;
+                  exponent[m] += scale_exponent;
+               }
+            }
+            p1[m] = p;
+            if(exponent[m] != 0)
+            {
+               // |p| < 2^scale_exponent, so once the exponent is below -3 * scale_exponent the term is below the smallest
+               // normalised value:
+               p = (exponent[m] < -3 * scale_exponent) ? value_type(0) : value_type(ldexp(p, exponent[m]));
+            }
+            // Terms too small for T are flushed to zero without ado, as they are many near the poles of large expansions:
+            if(fabs(p) < tools::min_value<T>())
+            {
+               p = 0;
+            }
+            *out = std::complex<T>(
+               policies::checked_narrowing_cast<T, Policy>(p * cos_m_phi[m], function),
+               policies::checked_narrowing_cast<T, Policy>(p * sin_m_phi[m], function));
+            ++out;
+         }
+      }
+      return out;
+   }
+
+private:
+   unsigned m_max_degree;
+   std::vector<value_type> m_diagonal;   // -sqrt((2m+1)/(2m)).
+   std::vector<value_type> m_a;          // a_{n,m} at index(n, m), for m < n.
+   std::vector<value_type> m_c;          // a_{n,m}/a_{n-1,m} at index(n, m), for m < n - 1.
+};
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator spherical_harmonics(unsigned max_degree, T1 theta, T2 phi, OutputIterator out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   return spherical_harmonic_evaluator<result_type, Policy>(max_degree, pol)(static_cast<result_type>(theta), static_cast<result_type>(phi), out);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator spherical_harmonics(unsigned max_degree, T1 theta, T2 phi, OutputIterator out)
+{
+   return boost::math::spherical_harmonics(max_degree, theta, phi, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
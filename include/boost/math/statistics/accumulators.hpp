@@ -0,0 +1,360 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_ACCUMULATORS_HPP
+#define BOOST_MATH_STATISTICS_ACCUMULATORS_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <boost/assert.hpp>
+#include <boost/math/statistics/detail/central_moments.hpp>
+
+// Online versions of the functionals in univariate_statistics.hpp, bivariate_statistics.hpp and linear_regression.hpp.
+// Data may be pushed one sample at a time or a range at a time, the state of accumulators fed disjoint
+// parts of a dataset may be merged, and the statistics may be read off at any point without disturbing the state.
+// Every accumulator is a small aggregate of numbers, so it may be copied, or shipped to another process, in place of the data.
+
+namespace boost::math::statistics {
+
+namespace detail {
+
+template<class T, class = void>
+struct is_range : std::false_type {};
+
+template<class T>
+struct is_range<T, std::void_t<decltype(std::cbegin(std::declval<T const &>())), decltype(std::cend(std::declval<T const &>()))>> : std::true_type {};
+
+}
+
+// Mean, variance, skewness and kurtosis, via the single pass and pairwise update formulas of
+// https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
+// along with the minimum and maximum.
+template<class Real>
+class moments_accumulator
+{
+public:
+    void push(Real x)
+    {
+        if (m_.n == 0 || x < min_)
+        {
+            min_ = x;
+        }
+        if (m_.n == 0 || x > max_)
+        {
+            max_ = x;
+        }
+        m_.push(x);
+    }
+
+    template<class ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last)
+    {
+        for (auto it = first; it != last; ++it)
+        {
+            push(static_cast<Real>(*it));
+        }
+    }
+
+    template<class Container, std::enable_if_t<detail::is_range<Container>::value, bool> = true>
+    void push(Container const & v)
+    {
+        push(std::cbegin(v), std::cend(v));
+    }
+
+    void merge(moments_accumulator const & other)
+    {
+        if (other.m_.n == 0)
+        {
+            return;
+        }
+        if (m_.n == 0 || other.min_ < min_)
+        {
+            min_ = other.min_;
+        }
+        if (m_.n == 0 || other.max_ > max_)
+        {
+            max_ = other.max_;
+        }
+        m_.merge(other.m_);
+    }
+
+    std::size_t count() const
+    {
+        return static_cast<std::size_t>(m_.n);
+    }
+
+    Real min() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute the minimum.");
+        return min_;
+    }
+
+    Real max() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute the maximum.");
+        return max_;
+    }
+
+    Real mean() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute the mean.");
+        return m_.M1;
+    }
+
+    Real variance() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute mean and variance.");
+        return m_.M2/m_.n;
+    }
+
+    Real sample_variance() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 1, "At least two samples are required to compute the sample variance.");
+        return m_.M2/(m_.n-1);
+    }
+
+    Real skewness() const
+    {
+        using std::sqrt;
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute skewness.");
+        Real var = m_.M2/m_.n;
+        if (var == 0)
+        {
+            // A constant dataset has no skewness, as in univariate_statistics.hpp.
+            return Real(0);
+        }
+        return m_.M3/(m_.M2*sqrt(var));
+    }
+
+    Real kurtosis() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute kurtosis.");
+        if (m_.M2 == 0)
+        {
+            return Real(0);
+        }
+        return m_.n*m_.M4/(m_.M2*m_.M2);
+    }
+
+    Real excess_kurtosis() const
+    {
+        return kurtosis() - 3;
+    }
+
+    // Same conventions as first_four_moments in univariate_statistics.hpp:
+    // the mean followed by the second, third and fourth central moments.
+    std::tuple<Real, Real, Real, Real> first_four_moments() const
+    {
+        BOOST_ASSERT_MSG(m_.n > 0, "At least one sample is required to compute the first four moments.");
+        return std::make_tuple(m_.M1, m_.M2/m_.n, m_.M3/m_.n, m_.M4/m_.n);
+    }
+
+private:
+    detail::central_moments<Real, 4> m_;
+    Real min_ = 0;
+    Real max_ = 0;
+};
+
+// Means, covariance and correlation of paired samples.
+// push() uses equation III.9 of "Numerically Stable, Single-Pass, Parallel Statistics Algorithms", Bennett et al.,
+// as means_and_covariance does, and merge() uses their equation III.5.
+template<class Real>
+class covariance_accumulator
+{
+public:
+    void push(Real u, Real v)
+    {
+        Real i = n_;
+        n_ += 1;
+        Real u_tmp = (u - mu_u_)/n_;
+        Real v_tmp = v - mu_v_;
+        Qu_ += i*(u - mu_u_)*u_tmp;
+        Qv_ += i*v_tmp*v_tmp/n_;
+        cov_ += i*u_tmp*v_tmp;
+        mu_u_ = mu_u_ + u_tmp;
+        mu_v_ = mu_v_ + v_tmp/n_;
+    }
+
+    template<class ForwardIterator1, class ForwardIterator2>
+    void push(ForwardIterator1 u_first, ForwardIterator1 u_last, ForwardIterator2 v_first)
+    {
+        for (auto it = u_first; it != u_last; ++it, ++v_first)
+        {
+            push(static_cast<Real>(*it), static_cast<Real>(*v_first));
+        }
+    }
+
+    template<class Container, std::enable_if_t<detail::is_range<Container>::value, bool> = true>
+    void push(Container const & u, Container const & v)
+    {
+        using std::size;
+        BOOST_ASSERT_MSG(size(u) == size(v), "The size of each vector must be the same to compute covariance.");
+        push(std::cbegin(u), std::cend(u), std::cbegin(v));
+    }
+
+    void merge(covariance_accumulator const & other)
+    {
+        if (other.n_ == 0)
+        {
+            return;
+        }
+        if (n_ == 0)
+        {
+            *this = other;
+            return;
+        }
+        Real N = n_ + other.n_;
+        Real du = other.mu_u_ - mu_u_;
+        Real dv = other.mu_v_ - mu_v_;
+        Real w = n_*other.n_/N;
+        cov_ += other.cov_ + w*du*dv;
+        Qu_ += other.Qu_ + w*du*du;
+        Qv_ += other.Qv_ + w*dv*dv;
+        mu_u_ += du*other.n_/N;
+        mu_v_ += dv*other.n_/N;
+        n_ = N;
+    }
+
+    std::size_t count() const
+    {
+        return static_cast<std::size_t>(n_);
+    }
+
+    std::tuple<Real, Real, Real> means_and_covariance() const
+    {
+        BOOST_ASSERT_MSG(n_ > 0, "Computing covariance requires at least one sample.");
+        return std::make_tuple(mu_u_, mu_v_, cov_/n_);
+    }
+
+    Real covariance() const
+    {
+        return std::get<2>(means_and_covariance());
+    }
+
+    Real correlation_coefficient() const
+    {
+        using std::sqrt;
+        BOOST_ASSERT_MSG(n_ > 0, "Computing covariance requires at least two samples.");
+        // If both datasets are constant, then they are perfectly correlated.
+        if (Qu_ == 0 && Qv_ == 0)
+        {
+            return Real(1);
+        }
+        // If one dataset is constant and the other isn't, then they have no correlation:
+        if (Qu_ == 0 || Qv_ == 0)
+        {
+            return Real(0);
+        }
+        // Make sure rho in [-1, 1], even in the presence of numerical noise.
+        Real rho = cov_/sqrt(Qu_*Qv_);
+        if (rho > 1) {
+            rho = 1;
+        }
+        if (rho < -1) {
+            rho = -1;
+        }
+        return rho;
+    }
+
+    // Sums of squared deviations from the means, and of the products of the deviations:
+    Real u_comoment() const { return Qu_; }
+    Real v_comoment() const { return Qv_; }
+    Real comoment() const { return cov_; }
+
+private:
+    Real n_ = 0;
+    Real mu_u_ = 0;
+    Real mu_v_ = 0;
+    Real Qu_ = 0;
+    Real Qv_ = 0;
+    Real cov_ = 0;
+};
+
+// Fits y = c0 + c1*x as simple_ordinary_least_squares does, from the means and comoments of (x, y).
+template<class Real>
+class simple_ordinary_least_squares_accumulator
+{
+public:
+    void push(Real x, Real y)
+    {
+        acc_.push(x, y);
+    }
+
+    template<class ForwardIterator1, class ForwardIterator2>
+    void push(ForwardIterator1 x_first, ForwardIterator1 x_last, ForwardIterator2 y_first)
+    {
+        acc_.push(x_first, x_last, y_first);
+    }
+
+    template<class Container, std::enable_if_t<detail::is_range<Container>::value, bool> = true>
+    void push(Container const & x, Container const & y)
+    {
+        using std::size;
+        if (size(x) != size(y))
+        {
+            throw std::domain_error("The same number of samples must be in the independent and dependent variable.");
+        }
+        acc_.push(x, y);
+    }
+
+    void merge(simple_ordinary_least_squares_accumulator const & other)
+    {
+        acc_.merge(other.acc_);
+    }
+
+    std::size_t count() const
+    {
+        return acc_.count();
+    }
+
+    std::pair<Real, Real> coefficients() const
+    {
+        if (acc_.count() <= 1)
+        {
+            throw std::domain_error("At least 2 samples are required to perform a linear regression.");
+        }
+        if (acc_.u_comoment() <= 0)
+        {
+            throw std::domain_error("Independent variable has no variance; this breaks linear regression.");
+        }
+        auto moments = acc_.means_and_covariance();
+        Real mu_x = std::get<0>(moments);
+        Real mu_y = std::get<1>(moments);
+        Real c1 = acc_.comoment()/acc_.u_comoment();
+        Real c0 = mu_y - c1*mu_x;
+        return std::make_pair(c0, c1);
+    }
+
+    // The coefficients and the coefficient of determination, as simple_ordinary_least_squares_with_R_squared returns.
+    // For a straight line fit, R^2 = 1 - SS_res/SS_tot is the squared correlation coefficient, so no second pass is needed.
+    std::tuple<Real, Real, Real> coefficients_with_R_squared() const
+    {
+        auto [c0, c1] = coefficients();
+        Real Rsquared;
+        if (acc_.v_comoment() == 0)
+        {
+            // Then y = constant, so the linear regression is perfect.
+            Rsquared = 1;
+        }
+        else
+        {
+            Real rho = acc_.correlation_coefficient();
+            Rsquared = rho*rho;
+        }
+        return std::make_tuple(c0, c1, Rsquared);
+    }
+
+private:
+    covariance_accumulator<Real> acc_;
+};
+
+}
+#endif
@@ -10,28 +10,27 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <type_traits>
+#include <vector>
 #include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/sorted_sweep.hpp>
 #include <boost/math/special_functions/erf.hpp>
 
 namespace boost { namespace math { namespace statistics {
 
-template<class RandomAccessContainer>
-auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
-                                          typename RandomAccessContainer::value_type mu = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN(),
-                                          typename RandomAccessContainer::value_type sd = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN())
+namespace detail {
+
+// A^2 of data which are known to be sorted, for the normal distribution of mean mu and standard deviation sd.
+template<class Real, class ExecutionPolicy, class SortedContainer>
+Real anderson_darling_normality_statistic_of_sorted(ExecutionPolicy&& exec, SortedContainer const & v, Real mu, Real sd)
 {
-    using Real = typename RandomAccessContainer::value_type;
     using std::log;
     using std::sqrt;
     using boost::math::erfc;
 
-    if (std::isnan(mu)) {
-        mu = boost::math::statistics::mean(v);
-    }
-    if (std::isnan(sd)) {
-        sd = sqrt(boost::math::statistics::sample_variance(v));
-    }
-
     typedef boost::math::policies::policy<
           boost::math::policies::promote_float<false>,
           boost::math::policies::promote_double<false> >
@@ -47,12 +46,13 @@ auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
     // This gives (for s = x-mu/sqrt(2sigma^2))
     // -1/2 + erf(s) + log(2/(1+erf(s)))
 
-
+    // Each integral below needs erfc at both of its endpoints, so evaluate erfc once at every order statistic, in parallel unless exec is seq:
     Real inv_var_scale = 1/(sd*sqrt(Real(2)));
-    Real s0 = (v[0] - mu)*inv_var_scale;
-    Real erfcs0 = erfc(s0, no_promote_policy());
+    std::vector<Real> erfcs = evaluate_on_sorted<Real>(exec, v, [&](auto x) {
+        return erfc((static_cast<Real>(x) - mu)*inv_var_scale, no_promote_policy());
+    });
     // Note that if erfcs0 == 0, then left_tail = inf (numerically), and hence the entire integral is numerically infinite:
-    if (erfcs0 <= 0) {
+    if (erfcs[0] <= 0) {
         return std::numeric_limits<Real>::infinity();
     }
 
@@ -69,7 +69,7 @@ auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
     // This gives (for sf = xf-mu/sqrt(2sigma^2))
     // -1/2 + erf(sf)/2 + 2log(2/(1+erf(sf)))
 
-    Real sf = (v[v.size()-1] - mu)*inv_var_scale;
+    Real sf = (static_cast<Real>(v[v.size()-1]) - mu)*inv_var_scale;
     //Real erfcsf = erfc<Real>(sf, no_promote_policy());
     // This is the actual value of the tail integral. However, the -erfcsf/2 cancels from the integral over [v_{n-2}, v_{n-1}]:
     //Real right_tail = -erfcsf/2 + log(Real(2)) - log(2-erfcsf);
@@ -88,24 +88,56 @@ auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
     // Integrate[((E^(-(z^2/2))/Sqrt[2 \[Pi]])*(k1 - F[z])^2)/(F[z]*(1 - F[z])),
     // {z, z1, z2}, Assumptions -> {z1 \[Element] Reals && z2 \[Element] Reals &&k1 \[Element] Reals}] // FullSimplify
 
-    Real integrals = 0;
-    int64_t N = v.size();
-    for (int64_t i = 0; i < N - 1; ++i) {
-        if (v[i] > v[i+1]) {
-            throw std::domain_error("Input data must be sorted in increasing order v[0] <= v[1] <= . . .  <= v[n-1]");
-        }
-
+    std::size_t N = v.size();
+    Real integrals = chunked_sum<Real>(exec, N - 1, [&](std::size_t i) {
         Real k = (i+1)/Real(N);
-        Real s1 = (v[i+1]-mu)*inv_var_scale;
-        Real erfcs1 = erfc<Real>(s1, no_promote_policy());
-        Real term = k*(k*log(erfcs0*(-2 + erfcs1)/(erfcs1*(-2 + erfcs0))) + 2*log(erfcs1/erfcs0));
+        Real erfcs0 = erfcs[i];
+        Real erfcs1 = erfcs[i+1];
+        return k*(k*log(erfcs0*(-2 + erfcs1)/(erfcs1*(-2 + erfcs0))) + 2*log(erfcs1/erfcs0));
+    });
+    integrals -= log(erfcs[N-1]);
+    return N*(left_tail + right_tail + integrals);
+}
 
-        integrals += term;
-        s0 = s1;
-        erfcs0 = erfcs1;
+}
+
+template<class RandomAccessContainer>
+auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
+                                          typename RandomAccessContainer::value_type mu = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN(),
+                                          typename RandomAccessContainer::value_type sd = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN())
+{
+    using Real = typename RandomAccessContainer::value_type;
+    using std::sqrt;
+
+    detail::check_sorted(v, "Input data must be sorted in increasing order v[0] <= v[1] <= . . .  <= v[n-1]");
+    if (std::isnan(mu)) {
+        mu = boost::math::statistics::mean(v);
+    }
+    if (std::isnan(sd)) {
+        sd = sqrt(boost::math::statistics::sample_variance(v));
+    }
+    return detail::anderson_darling_normality_statistic_of_sorted<Real>(std::execution::seq, v, mu, sd);
+}
+
+// The same statistic for data in any order, which are left untouched.
+// A sorted copy is made by a radix sort for IEEE floats, and the mean and variance, when they are not given, are gathered in the same pass.
+// The sort, the erfc evaluations and the sum are split over threads unless the policy is std::execution::seq.
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto anderson_darling_normality_statistic(ExecutionPolicy&& exec, RandomAccessContainer const & v,
+                                          typename RandomAccessContainer::value_type mu = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN(),
+                                          typename RandomAccessContainer::value_type sd = std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN())
+{
+    using Real = typename RandomAccessContainer::value_type;
+    using std::sqrt;
+
+    auto [sorted, moments] = detail::sorted_copy_with_moments<Real>(exec, v.cbegin(), v.cend());
+    if (std::isnan(mu)) {
+        mu = moments.M1;
+    }
+    if (std::isnan(sd)) {
+        sd = sqrt(moments.M2/(moments.n - 1));
     }
-    integrals -= log(erfcs0);
-    return v.size()*(left_tail + right_tail + integrals);
+    return detail::anderson_darling_normality_statistic_of_sorted<Real>(exec, sorted, mu, sd);
 }
 
 }}}
@@ -0,0 +1,216 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_AUTOCORRELATION_HPP
+#define BOOST_MATH_STATISTICS_AUTOCORRELATION_HPP
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/fft.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+
+namespace boost::math::statistics {
+
+namespace detail {
+
+template<class RandomAccessIterator>
+using autocovariance_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<RandomAccessIterator>::value_type>,
+                                                 double, typename std::iterator_traits<RandomAccessIterator>::value_type>;
+
+// sum_{t=k}^{n-1} c_t c_{t-k}, for each lag k handed out to this thread.
+template<class Real, class ExecutionPolicy>
+std::vector<Real> lagged_products_direct(ExecutionPolicy&& exec, std::vector<Real> const & c, std::size_t max_lag)
+{
+    std::vector<Real> r(max_lag + 1, Real(0));
+    std::size_t n = c.size();
+    // Each lag costs a pass over the data, so one lag is plenty of work for a thread once the series is long:
+    std::size_t min_lags_per_thread = (std::max)(std::size_t(1), std::size_t(65536)/(std::max)(n, std::size_t(1)));
+    parallel_blocks(exec, max_lag + 1, min_lags_per_thread, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k)
+        {
+            Real sum = 0;
+            for (std::size_t t = k; t < n; ++t)
+            {
+                sum += c[t]*c[t-k];
+            }
+            r[k] = sum;
+        }
+    });
+    return r;
+}
+
+// The same sums via the Wiener-Khinchin theorem: zero pad to a length N >= n + max_lag so that
+// the circular correlation computed by the transform has no wraparound in the lags of interest.
+// As the data and the correlation are real, each is packed into a complex sequence of half the length,
+// with the even samples in the real part and the odd samples in the imaginary part;
+// see Press et al., Numerical Recipes, section 12.3.
+template<class Real>
+std::vector<Real> lagged_products_fft(std::vector<Real> const & c, std::size_t max_lag)
+{
+    using std::cos;
+    using std::sin;
+    using std::conj;
+    std::size_t N = 2;
+    while (N < c.size() + max_lag)
+    {
+        N <<= 1;
+    }
+    std::size_t M = N/2;
+    std::vector<std::complex<Real>> z(M);
+    for (std::size_t t = 0; t < c.size(); ++t)
+    {
+        if (t & 1)
+        {
+            z[t/2].imag(c[t]);
+        }
+        else
+        {
+            z[t/2].real(c[t]);
+        }
+    }
+    fft(z, false);
+
+    // Unpack the transforms of the even and odd samples, E_k and O_k, and form the power spectrum
+    // |X_k|^2 and |X_{k+M}|^2, where X_k = E_k + W^k O_k and X_{k+M} = E_k - W^k O_k, W = exp(-2 pi i/N):
+    std::vector<std::complex<Real>> W(M);
+    for (std::size_t k = 0; k < M; ++k)
+    {
+        Real theta = -2*boost::math::constants::pi<Real>()*Real(k)/Real(N);
+        W[k] = std::complex<Real>(cos(theta), sin(theta));
+    }
+    std::vector<Real> P(N);
+    std::complex<Real> const i(0, 1);
+    for (std::size_t k = 0; k < M; ++k)
+    {
+        std::complex<Real> Zk = z[k];
+        std::complex<Real> Zc = conj(z[(M - k) % M]);
+        std::complex<Real> E = (Zk + Zc)/Real(2);
+        std::complex<Real> O = -i*(Zk - Zc)/Real(2);
+        std::complex<Real> T = W[k]*O;
+        P[k] = std::norm(E + T);
+        P[k + M] = std::norm(E - T);
+    }
+
+    // The inverse transform by the same packing: the even and odd outputs are the inverse transforms of
+    // (P_k + P_{k+M})/2 and (P_k - P_{k+M}) W^{-k}/2, which are computed together as real and imaginary parts:
+    for (std::size_t k = 0; k < M; ++k)
+    {
+        Real E = (P[k] + P[k + M])/2;
+        std::complex<Real> O = conj(W[k])*((P[k] - P[k + M])/2);
+        z[k] = E + i*O;
+    }
+    fft(z, true);
+    std::vector<Real> r(max_lag + 1);
+    for (std::size_t k = 0; k <= max_lag; ++k)
+    {
+        r[k] = ((k & 1) ? z[k/2].imag() : z[k/2].real())/M;
+    }
+    return r;
+}
+
+// The direct method costs (max_lag+1)n multiply-adds, while the two half length transforms cost about 5N log2(N) flops
+// with much less regular memory access; the crossover was measured at about 10 log2(N) lags.
+// The choice does not depend on the execution policy, so that every policy gives the same result.
+inline bool autocovariance_prefers_fft(std::size_t n, std::size_t max_lag)
+{
+    std::size_t log2N = 0;
+    while ((std::size_t(1) << log2N) < n + max_lag)
+    {
+        ++log2N;
+    }
+    return max_lag + 1 > 10*log2N;
+}
+
+}
+
+// The sample autocovariances gamma_k = (1/n) sum_{t=0}^{n-1-k} (x_t - mu)(x_{t+k} - mu) at lags k = 0, ..., max_lag.
+// Few lags are computed directly, split over threads by lag unless the policy is std::execution::seq;
+// for many lags the correlation is computed by fast Fourier transform.
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto autocovariance(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    using Real = detail::autocovariance_real_t<RandomAccessIterator>;
+    std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    if (max_lag >= n)
+    {
+        throw std::domain_error("Number of lags must be < number of elements in array.");
+    }
+    Real mu = boost::math::statistics::mean(first, last);
+    std::vector<Real> c(n);
+    for (std::size_t t = 0; t < n; ++t)
+    {
+        c[t] = first[t] - mu;
+    }
+    std::vector<Real> r = detail::autocovariance_prefers_fft(n, max_lag) ? detail::lagged_products_fft(c, max_lag)
+                                                                         : detail::lagged_products_direct(exec, c, max_lag);
+    for (auto & x : r)
+    {
+        x /= n;
+    }
+    return r;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto autocovariance(ExecutionPolicy&& exec, RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocovariance(exec, v.cbegin(), v.cend(), max_lag);
+}
+
+template<class RandomAccessIterator, std::enable_if_t<!detail::is_execution_policy_v<RandomAccessIterator>, bool> = true>
+inline auto autocovariance(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    return autocovariance(std::execution::seq, first, last, max_lag);
+}
+
+template<class RandomAccessContainer>
+inline auto autocovariance(RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocovariance(std::execution::seq, v.cbegin(), v.cend(), max_lag);
+}
+
+// The sample autocorrelations rho_k = gamma_k/gamma_0, k = 0, ..., max_lag.
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto autocorrelation(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    auto rho = autocovariance(exec, first, last, max_lag);
+    auto gamma0 = rho[0];
+    if (gamma0 == 0)
+    {
+        throw std::domain_error("The autocorrelation of a constant series is undefined.");
+    }
+    for (auto & x : rho)
+    {
+        x /= gamma0;
+    }
+    return rho;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto autocorrelation(ExecutionPolicy&& exec, RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocorrelation(exec, v.cbegin(), v.cend(), max_lag);
+}
+
+template<class RandomAccessIterator, std::enable_if_t<!detail::is_execution_policy_v<RandomAccessIterator>, bool> = true>
+inline auto autocorrelation(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    return autocorrelation(std::execution::seq, first, last, max_lag);
+}
+
+template<class RandomAccessContainer>
+inline auto autocorrelation(RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocorrelation(std::execution::seq, v.cbegin(), v.cend(), max_lag);
+}
+
+}
+#endif
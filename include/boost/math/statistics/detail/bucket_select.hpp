@@ -0,0 +1,223 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_BUCKET_SELECT_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_BUCKET_SELECT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+
+namespace boost::math::statistics::detail {
+
+// Below this size it is cheaper to copy everything and call nth_element than to bucket the data.
+inline constexpr std::size_t bucket_select_threshold = 4096;
+
+// Places the elements of rank ranks[0] < ranks[1] < ... of [first, last) in their sorted positions.
+template<class RandomAccessIterator>
+void select_sorted_ranks(RandomAccessIterator first, RandomAccessIterator last, std::vector<std::size_t> const & ranks)
+{
+    auto lo = first;
+    for (std::size_t r : ranks)
+    {
+        auto pos = first + r;
+        std::nth_element(lo, pos, last);
+        lo = pos + 1;
+    }
+}
+
+// Returns the values of rank ranks[0] < ranks[1] < ... (counting from zero) among proj(*it), it in [first, last),
+// without modifying the input.
+// The range of values is cut into equal width buckets, and the buckets holding the requested ranks are found from a histogram.
+// Only the elements of those buckets are copied to scratch space, and nth_element is run on each of them.
+// The three passes over the data (extrema, histogram, gather) are split over threads unless exec is std::execution::seq.
+// The answer is exact however the data are distributed; clustered data only make the selected buckets, and hence the scratch space, larger.
+// Infinities and NaNs have no bucket, so data containing them are copied whole and passed to nth_element, as by median().
+template<class Real, class ExecutionPolicy, class RandomAccessIterator, class Projection>
+std::vector<Real> bucket_select(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last,
+                                Projection proj, std::vector<std::size_t> const & ranks)
+{
+    std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    std::vector<Real> values(ranks.size());
+    auto select_from_copy = [&]() {
+        std::vector<Real> scratch(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            scratch[i] = proj(first[i]);
+        }
+        select_sorted_ranks(scratch.begin(), scratch.end(), ranks);
+        for (std::size_t i = 0; i < ranks.size(); ++i)
+        {
+            values[i] = scratch[ranks[i]];
+        }
+        return values;
+    };
+    if (n <= bucket_select_threshold)
+    {
+        return select_from_copy();
+    }
+
+    std::size_t blocks = 1;
+    if constexpr (!is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        blocks = (std::max)(std::thread::hardware_concurrency(), 1u);
+        blocks = (std::min)(blocks, n/bucket_select_threshold);
+    }
+    auto block_begin = [&](std::size_t b) { return n*b/blocks; };
+
+    // Pass 1: the extrema, and whether any value is infinite or NaN.
+    std::vector<Real> block_min(blocks);
+    std::vector<Real> block_max(blocks);
+    std::vector<char> block_finite(blocks);
+    parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+        {
+            Real mn = proj(first[block_begin(b)]);
+            Real mx = mn;
+            bool finite = true;
+            for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+            {
+                Real x = proj(first[i]);
+                if constexpr (!std::is_integral_v<Real>)
+                {
+                    // x - x is NaN for both infinities and NaN:
+                    finite = finite && (x - x == 0);
+                }
+                if (x < mn)
+                {
+                    mn = x;
+                }
+                if (x > mx)
+                {
+                    mx = x;
+                }
+            }
+            block_min[b] = mn;
+            block_max[b] = mx;
+            block_finite[b] = finite;
+        }
+    });
+    if (std::find(block_finite.begin(), block_finite.end(), char(0)) != block_finite.end())
+    {
+        return select_from_copy();
+    }
+    Real mn = *std::min_element(block_min.begin(), block_min.end());
+    Real mx = *std::max_element(block_max.begin(), block_max.end());
+    if (!(mn < mx))
+    {
+        std::fill(values.begin(), values.end(), mn);
+        return values;
+    }
+
+    // x -> floor(buckets*(x - min)/(max - min)) is non-decreasing, so every element of a bucket is <= every element of the next.
+    // Halving first keeps max - min finite, and integers are mapped in double precision:
+    using Key = std::conditional_t<std::is_integral_v<Real>, double, Real>;
+    std::size_t buckets = std::clamp<std::size_t>(n/256, 1, 16384);
+    Key key_min = static_cast<Key>(mn)/2;
+    Key width = static_cast<Key>(mx)/2 - key_min;
+    auto bucket_of = [&](Real x) {
+        Key t = (static_cast<Key>(x)/2 - key_min)/width;
+        std::size_t j = static_cast<std::size_t>(t*static_cast<Key>(buckets));
+        return (std::min)(j, buckets - 1);
+    };
+
+    // Pass 2: a histogram of each block.
+    std::vector<std::size_t> counts(blocks*buckets, 0);
+    parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+        {
+            std::size_t* h = counts.data() + b*buckets;
+            for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+            {
+                ++h[bucket_of(proj(first[i]))];
+            }
+        }
+    });
+
+    // Locate the buckets holding the requested ranks, and lay out the scratch space for them:
+    std::vector<std::size_t> bucket_start(buckets + 1, 0);
+    for (std::size_t j = 0; j < buckets; ++j)
+    {
+        std::size_t total = 0;
+        for (std::size_t b = 0; b < blocks; ++b)
+        {
+            total += counts[b*buckets + j];
+        }
+        bucket_start[j + 1] = bucket_start[j] + total;
+    }
+    std::vector<std::size_t> target_buckets;
+    for (std::size_t r : ranks)
+    {
+        std::size_t j = static_cast<std::size_t>(std::upper_bound(bucket_start.begin(), bucket_start.end(), r) - bucket_start.begin()) - 1;
+        if (target_buckets.empty() || target_buckets.back() != j)
+        {
+            target_buckets.push_back(j);
+        }
+    }
+    constexpr std::size_t not_a_target = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> slot(buckets, not_a_target);
+    std::vector<std::size_t> scratch_start(target_buckets.size() + 1, 0);
+    for (std::size_t t = 0; t < target_buckets.size(); ++t)
+    {
+        std::size_t j = target_buckets[t];
+        slot[j] = t;
+        scratch_start[t + 1] = scratch_start[t] + bucket_start[j + 1] - bucket_start[j];
+    }
+    // Each block writes its elements of each target bucket into its own stretch of scratch space, so no synchronization is needed:
+    std::vector<std::size_t> write_pos(blocks*target_buckets.size());
+    for (std::size_t t = 0; t < target_buckets.size(); ++t)
+    {
+        std::size_t pos = scratch_start[t];
+        for (std::size_t b = 0; b < blocks; ++b)
+        {
+            write_pos[b*target_buckets.size() + t] = pos;
+            pos += counts[b*buckets + target_buckets[t]];
+        }
+    }
+
+    // Pass 3: gather the elements of the target buckets.
+    std::vector<Real> scratch(scratch_start.back());
+    parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+        {
+            std::size_t* pos = write_pos.data() + b*target_buckets.size();
+            for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+            {
+                Real x = proj(first[i]);
+                std::size_t t = slot[bucket_of(x)];
+                if (t != not_a_target)
+                {
+                    scratch[pos[t]++] = x;
+                }
+            }
+        }
+    });
+
+    // Select within each target bucket:
+    std::size_t i = 0;
+    for (std::size_t t = 0; t < target_buckets.size(); ++t)
+    {
+        std::size_t j = target_buckets[t];
+        std::vector<std::size_t> local_ranks;
+        for (std::size_t k = i; k < ranks.size() && ranks[k] < bucket_start[j + 1]; ++k)
+        {
+            local_ranks.push_back(ranks[k] - bucket_start[j]);
+        }
+        auto bucket_first = scratch.begin() + scratch_start[t];
+        select_sorted_ranks(bucket_first, scratch.begin() + scratch_start[t + 1], local_ranks);
+        for (std::size_t r : local_ranks)
+        {
+            values[i++] = bucket_first[r];
+        }
+    }
+    return values;
+}
+
+}
+#endif
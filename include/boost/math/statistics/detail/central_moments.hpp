@@ -0,0 +1,170 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_CENTRAL_MOMENTS_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_CENTRAL_MOMENTS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+
+namespace boost::math::statistics::detail {
+
+// Running sums of powers of deviations from the mean, M_p = sum (x_i - mean)^p, for p <= Order.
+// push() is the single pass update of equations 1.5/1.6 of:
+// https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
+// and merge() combines the states of two disjoint samples with equations 3.1 and 3.2 of the same paper,
+// which generalize Chan, Golub and LeVeque's pairwise update of the variance.
+// pop() removes a sample which was pushed earlier by solving merge() with a single sample for the state before it.
+template<class Real, int Order>
+struct central_moments
+{
+    static_assert(Order >= 1 && Order <= 4, "Central moments are only tracked up to the fourth.");
+
+    Real n = 0;
+    Real M1 = 0;
+    Real M2 = 0;
+    Real M3 = 0;
+    Real M4 = 0;
+
+    void push(Real x)
+    {
+        n += 1;
+        Real delta21 = x - M1;
+        Real tmp = delta21/n;
+        if constexpr (Order >= 4)
+        {
+            M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
+        }
+        if constexpr (Order >= 3)
+        {
+            M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
+        }
+        if constexpr (Order >= 2)
+        {
+            M2 = M2 + tmp*(n-1)*delta21;
+        }
+        M1 = M1 + tmp;
+    }
+
+    void pop(Real x)
+    {
+        if (n <= 1)
+        {
+            *this = central_moments();
+            return;
+        }
+        Real N = n;
+        Real na = n - 1;
+        Real M1a = M1 - (x - M1)/na;
+        Real delta = x - M1a;
+        Real delta_N = delta/N;
+        Real M2a = M2 - delta*delta_N*na;
+        if constexpr (Order >= 3)
+        {
+            Real M3a = M3 - delta*delta_N*delta_N*na*(na - 1) + 3*delta_N*M2a;
+            if constexpr (Order >= 4)
+            {
+                M4 = M4 - delta*delta_N*delta_N*delta_N*na*(na*na - na + 1) - 6*delta_N*delta_N*M2a + 4*delta_N*M3a;
+            }
+            M3 = M3a;
+        }
+        if constexpr (Order >= 2)
+        {
+            M2 = M2a;
+        }
+        M1 = M1a;
+        n = na;
+    }
+
+    void merge(central_moments const & b)
+    {
+        if (b.n == 0)
+        {
+            return;
+        }
+        if (n == 0)
+        {
+            *this = b;
+            return;
+        }
+        Real na = n;
+        Real nb = b.n;
+        Real N = na + nb;
+        Real delta = b.M1 - M1;
+        Real delta_N = delta/N;
+        if constexpr (Order >= 4)
+        {
+            M4 = M4 + b.M4 + delta*delta_N*delta_N*delta_N*na*nb*(na*na - na*nb + nb*nb)
+               + 6*delta_N*delta_N*(na*na*b.M2 + nb*nb*M2) + 4*delta_N*(na*b.M3 - nb*M3);
+        }
+        if constexpr (Order >= 3)
+        {
+            M3 = M3 + b.M3 + delta*delta_N*delta_N*na*nb*(na - nb) + 3*delta_N*(na*b.M2 - nb*M2);
+        }
+        if constexpr (Order >= 2)
+        {
+            M2 = M2 + b.M2 + delta*delta_N*na*nb;
+        }
+        M1 = M1 + delta_N*nb;
+        n = N;
+    }
+};
+
+// The range is cut into chunks of a fixed size, whose states are merged left to right.
+// Since neither the chunks nor the order of the merges depend on how many threads processed the chunks,
+// the result is the same, bit for bit, under every execution policy.
+inline constexpr std::size_t central_moments_chunk_size = 8192;
+
+template<class Real, int Order, class ExecutionPolicy, class ForwardIterator>
+central_moments<Real, Order> chunked_central_moments(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using category = typename std::iterator_traits<ForwardIterator>::iterator_category;
+    central_moments<Real, Order> total;
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, category>)
+    {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t chunks = (n + central_moments_chunk_size - 1)/central_moments_chunk_size;
+        std::vector<central_moments<Real, Order>> states(chunks);
+        parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c)
+            {
+                auto it = first + c*central_moments_chunk_size;
+                auto chunk_end = (c + 1 == chunks) ? last : it + central_moments_chunk_size;
+                for (; it != chunk_end; ++it)
+                {
+                    states[c].push(static_cast<Real>(*it));
+                }
+            }
+        });
+        for (auto const & s : states)
+        {
+            total.merge(s);
+        }
+    }
+    else
+    {
+        // No way to hand out chunks without walking the range, so process them in order on this thread:
+        central_moments<Real, Order> chunk;
+        std::size_t count = 0;
+        for (auto it = first; it != last; ++it)
+        {
+            chunk.push(static_cast<Real>(*it));
+            if (++count == central_moments_chunk_size)
+            {
+                total.merge(chunk);
+                chunk = central_moments<Real, Order>();
+                count = 0;
+            }
+        }
+        total.merge(chunk);
+    }
+    return total;
+}
+
+}
+#endif
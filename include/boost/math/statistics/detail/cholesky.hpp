@@ -0,0 +1,93 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_CHOLESKY_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_CHOLESKY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace boost::math::statistics::detail {
+
+// Overwrites the lower triangle of the symmetric p x p column major matrix A with its Cholesky factor L, A = LL^T.
+// The factorization is left looking, column by column, so that every inner loop runs down a contiguous column.
+// Returns false if A is not numerically positive definite, in which case A is left partially overwritten.
+template<class Real>
+bool cholesky_decompose(std::vector<Real> & A, std::size_t p)
+{
+    using std::sqrt;
+    for (std::size_t j = 0; j < p; ++j)
+    {
+        Real* Lj = A.data() + j*p;
+        // Column j of A minus the contributions of the columns already factored:
+        for (std::size_t k = 0; k < j; ++k)
+        {
+            Real const * Lk = A.data() + k*p;
+            Real ljk = Lk[j];
+            for (std::size_t i = j; i < p; ++i)
+            {
+                Lj[i] -= Lk[i]*ljk;
+            }
+        }
+        if (!(Lj[j] > 0))
+        {
+            return false;
+        }
+        Real d = sqrt(Lj[j]);
+        for (std::size_t i = j; i < p; ++i)
+        {
+            Lj[i] /= d;
+        }
+    }
+    return true;
+}
+
+// Solves LL^T x = b in place, given the factor from cholesky_decompose.
+template<class Real>
+void cholesky_solve(std::vector<Real> const & L, std::size_t p, std::vector<Real> & b)
+{
+    // Forward substitution, Ly = b, a column at a time:
+    for (std::size_t j = 0; j < p; ++j)
+    {
+        Real const * Lj = L.data() + j*p;
+        b[j] /= Lj[j];
+        for (std::size_t i = j + 1; i < p; ++i)
+        {
+            b[i] -= Lj[i]*b[j];
+        }
+    }
+    // Back substitution, L^T x = y, as dot products down the columns of L:
+    for (std::size_t j = p; j-- > 0;)
+    {
+        Real const * Lj = L.data() + j*p;
+        Real s = b[j];
+        for (std::size_t i = j + 1; i < p; ++i)
+        {
+            s -= Lj[i]*b[i];
+        }
+        b[j] = s/Lj[j];
+    }
+}
+
+// The inverse of LL^T, as a full column major matrix.
+template<class Real>
+std::vector<Real> cholesky_inverse(std::vector<Real> const & L, std::size_t p)
+{
+    std::vector<Real> inverse(p*p, Real(0));
+    std::vector<Real> e(p);
+    for (std::size_t j = 0; j < p; ++j)
+    {
+        std::fill(e.begin(), e.end(), Real(0));
+        e[j] = 1;
+        cholesky_solve(L, p, e);
+        std::copy(e.begin(), e.end(), inverse.begin() + j*p);
+    }
+    return inverse;
+}
+
+}
+#endif
@@ -0,0 +1,81 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_FFT_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_FFT_HPP
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+
+namespace boost::math::statistics::detail {
+
+// In place iterative radix 2 Cooley-Tukey transform; the size of data must be a power of two.
+// Computes sum_j data[j] exp(-+2 pi i jk/N), with the sign given by inverse, and does not normalize.
+// The twiddle factors are evaluated directly, rather than by repeated multiplication, so the error grows only as log N.
+template<class Real>
+void fft(std::vector<std::complex<Real>> & data, bool inverse)
+{
+    using std::cos;
+    using std::sin;
+    std::size_t n = data.size();
+    if (n <= 1)
+    {
+        return;
+    }
+    // Bit reversal permutation:
+    for (std::size_t i = 1, j = 0; i < n; ++i)
+    {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            std::swap(data[i], data[j]);
+        }
+    }
+    std::vector<std::complex<Real>> twiddle(n/2);
+    Real sign = inverse ? 1 : -1;
+    for (std::size_t k = 0; k < n/2; ++k)
+    {
+        Real theta = sign*2*boost::math::constants::pi<Real>()*Real(k)/Real(n);
+        twiddle[k] = std::complex<Real>(cos(theta), sin(theta));
+    }
+    std::vector<std::complex<Real>> w(n/2);
+    for (std::size_t len = 2; len <= n; len <<= 1)
+    {
+        // Gather this stage's twiddle factors so the inner loop reads them contiguously:
+        std::size_t half = len/2;
+        std::size_t stride = n/len;
+        for (std::size_t k = 0; k < half; ++k)
+        {
+            w[k] = twiddle[k*stride];
+        }
+        for (std::size_t i = 0; i < n; i += len)
+        {
+            std::complex<Real>* lo = data.data() + i;
+            std::complex<Real>* hi = lo + half;
+            for (std::size_t k = 0; k < half; ++k)
+            {
+                // Written out, since operator* checks for infinities and NaNs at every call:
+                Real vr = hi[k].real()*w[k].real() - hi[k].imag()*w[k].imag();
+                Real vi = hi[k].real()*w[k].imag() + hi[k].imag()*w[k].real();
+                Real ur = lo[k].real();
+                Real ui = lo[k].imag();
+                lo[k] = std::complex<Real>(ur + vr, ui + vi);
+                hi[k] = std::complex<Real>(ur - vr, ui - vi);
+            }
+        }
+    }
+}
+
+}
+#endif
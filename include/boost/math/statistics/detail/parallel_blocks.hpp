@@ -0,0 +1,57 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_PARALLEL_BLOCKS_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_PARALLEL_BLOCKS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace boost::math::statistics::detail {
+
+template<class ExecutionPolicy>
+inline constexpr bool is_sequenced_policy_v =
+    std::is_same_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::execution::sequenced_policy>;
+
+// Calls f(begin, end) on contiguous blocks covering [0, n).
+// Under std::execution::seq there is exactly one block; otherwise the work is split
+// over up to std::thread::hardware_concurrency() threads, with no block smaller than min_block.
+// We spawn threads ourselves rather than use the parallel algorithms, so no threading backend needs to be linked.
+// Exceptions thrown by f are propagated to the caller.
+template<class ExecutionPolicy, class F>
+void parallel_blocks(ExecutionPolicy&&, std::size_t n, std::size_t min_block, F f)
+{
+    std::size_t threads = 1;
+    if constexpr (!is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+        threads = (std::min)(threads, n/(std::max)(min_block, std::size_t(1)));
+    }
+    if (threads <= 1)
+    {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads - 1);
+    for (std::size_t t = 0; t < threads - 1; ++t)
+    {
+        futures.push_back(std::async(std::launch::async, f, n*t/threads, n*(t+1)/threads));
+    }
+    f(n*(threads-1)/threads, n);
+    for (auto & fut : futures)
+    {
+        fut.get();
+    }
+}
+
+}
+#endif
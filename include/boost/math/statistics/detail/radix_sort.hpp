@@ -0,0 +1,206 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_RADIX_SORT_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+
+namespace boost::math::statistics::detail {
+
+// Maps 32 and 64 bit integers and IEEE floats to unsigned integers of the same width, such that
+// the unsigned order is the numerical order (with -0 placed just before +0, and NaNs outside the infinities).
+template<class T, class = void>
+struct radix_key_traits
+{
+    static constexpr bool value = false;
+};
+
+template<class T>
+struct radix_key_traits<T, std::enable_if_t<std::is_arithmetic_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)
+                                            && (std::is_integral_v<T> || std::numeric_limits<T>::is_iec559)>>
+{
+    static constexpr bool value = true;
+    using key_type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    static constexpr key_type sign_bit = key_type(1) << (8*sizeof(T) - 1);
+
+    static key_type to_key(T x)
+    {
+        key_type u;
+        std::memcpy(&u, &x, sizeof(T));
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // Negative floats are stored as sign and magnitude, so their order must be reversed:
+            return (u & sign_bit) ? key_type(~u) : key_type(u ^ sign_bit);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return u ^ sign_bit;
+        }
+        else
+        {
+            return u;
+        }
+    }
+
+    static T from_key(key_type u)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            u = (u & sign_bit) ? key_type(u ^ sign_bit) : key_type(~u);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            u ^= sign_bit;
+        }
+        T x;
+        std::memcpy(&x, &u, sizeof(T));
+        return x;
+    }
+};
+
+// Least significant digit first radix sort of unsigned keys, one byte per pass.
+// Each pass counts the digits of each block of the array, and then each block scatters its elements to the
+// positions given by the prefix sums over (digit, block), so the passes are stable and need no synchronization.
+// The blocks are processed on separate threads unless exec is std::execution::seq.
+// Passes in which every key has the same digit, such as the high bytes of data with a narrow range, are skipped.
+// This overload splits the array into the given number of blocks, whatever the number of threads.
+template<class ExecutionPolicy, class Unsigned>
+void radix_sort(ExecutionPolicy&& exec, std::vector<Unsigned> & keys, std::size_t blocks)
+{
+    static_assert(std::is_unsigned_v<Unsigned>, "Radix sort is implemented for unsigned keys.");
+    constexpr std::size_t radix = 256;
+    constexpr std::size_t passes = sizeof(Unsigned);
+    std::size_t n = keys.size();
+    if (n < 2)
+    {
+        return;
+    }
+    blocks = (std::max)(std::size_t(1), (std::min)(blocks, n));
+    auto block_begin = [&](std::size_t b) { return n*b/blocks; };
+
+    std::vector<Unsigned> buffer(n);
+    Unsigned* src = keys.data();
+    Unsigned* dst = buffer.data();
+    // counts[(pass*blocks + b)*radix + d] is the number of keys in block b with digit d in this pass.
+    // The total for each digit does not change as the keys are permuted, so one read of the data counts
+    // the digits of every pass; only when there are several blocks, and a previous pass has permuted the keys,
+    // must each block be recounted.
+    std::vector<std::size_t> counts(passes*blocks*radix, 0);
+    auto count_block = [&](std::size_t pass, std::size_t b) {
+        unsigned shift = static_cast<unsigned>(8*pass);
+        std::size_t* c = counts.data() + (pass*blocks + b)*radix;
+        std::fill(c, c + radix, std::size_t(0));
+        for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+        {
+            ++c[(src[i] >> shift) & (radix - 1)];
+        }
+    };
+    parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+        {
+            std::size_t* c = counts.data() + b*radix;
+            for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+            {
+                Unsigned k = src[i];
+                for (std::size_t pass = 0; pass < passes; ++pass)
+                {
+                    ++c[pass*blocks*radix + ((k >> (8*pass)) & (radix - 1))];
+                }
+            }
+        }
+    });
+
+    bool moved = false;
+    for (std::size_t pass = 0; pass < passes; ++pass)
+    {
+        unsigned shift = static_cast<unsigned>(8*pass);
+        std::size_t* pass_counts = counts.data() + pass*blocks*radix;
+        // Skip the passes in which every key has the same digit, as they would not move anything:
+        bool trivial = false;
+        for (std::size_t d = 0; d < radix; ++d)
+        {
+            std::size_t total = 0;
+            for (std::size_t b = 0; b < blocks; ++b)
+            {
+                total += pass_counts[b*radix + d];
+            }
+            if (total == n)
+            {
+                trivial = true;
+            }
+            if (total != 0)
+            {
+                break;
+            }
+        }
+        if (trivial)
+        {
+            continue;
+        }
+        if (blocks > 1 && moved)
+        {
+            parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+                for (std::size_t b = b0; b < b1; ++b)
+                {
+                    count_block(pass, b);
+                }
+            });
+        }
+        // pass_counts[b*radix + d] becomes the position at which block b writes its first key with digit d:
+        std::size_t pos = 0;
+        for (std::size_t d = 0; d < radix; ++d)
+        {
+            for (std::size_t b = 0; b < blocks; ++b)
+            {
+                std::size_t c = pass_counts[b*radix + d];
+                pass_counts[b*radix + d] = pos;
+                pos += c;
+            }
+        }
+        parallel_blocks(exec, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+            for (std::size_t b = b0; b < b1; ++b)
+            {
+                std::size_t* c = pass_counts + b*radix;
+                for (std::size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+                {
+                    Unsigned k = src[i];
+                    dst[c[(k >> shift) & (radix - 1)]++] = k;
+                }
+            }
+        });
+        std::swap(src, dst);
+        moved = true;
+    }
+    if (src != keys.data())
+    {
+        keys.swap(buffer);
+    }
+}
+
+// As above, with one block per hardware thread unless exec is std::execution::seq, and no block smaller than 65536 keys.
+template<class ExecutionPolicy, class Unsigned>
+void radix_sort(ExecutionPolicy&& exec, std::vector<Unsigned> & keys)
+{
+    std::size_t blocks = 1;
+    if constexpr (!is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        blocks = (std::max)(std::thread::hardware_concurrency(), 1u);
+        blocks = (std::min)(blocks, keys.size()/65536);
+    }
+    radix_sort(exec, keys, blocks);
+}
+
+}
+#endif
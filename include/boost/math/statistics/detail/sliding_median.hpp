@@ -0,0 +1,98 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_SLIDING_MEDIAN_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_SLIDING_MEDIAN_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <utility>
+
+namespace boost::math::statistics::detail {
+
+// The median of a window of samples which changes by insertions and deletions, each costing O(log w).
+// The lower and upper halves of the window are kept in ordered sets of (value, position) pairs,
+// which are unique even for tied values, so that a given sample can be deleted and the samples with values
+// in a given range enumerated. The lower half holds the middle element when the window has odd size.
+template<class Real>
+class sliding_median
+{
+public:
+    void insert(Real x, std::size_t position)
+    {
+        key k{x, position};
+        if (upper_.empty() || k < *upper_.begin())
+        {
+            lower_.insert(k);
+        }
+        else
+        {
+            upper_.insert(k);
+        }
+        rebalance();
+    }
+
+    void erase(Real x, std::size_t position)
+    {
+        key k{x, position};
+        if (lower_.erase(k) == 0)
+        {
+            upper_.erase(k);
+        }
+        rebalance();
+    }
+
+    std::size_t size() const
+    {
+        return lower_.size() + upper_.size();
+    }
+
+    // As boost::math::statistics::median: the middle element, or the mean of the two middle elements. Requires size() > 0.
+    Real median() const
+    {
+        if (lower_.size() > upper_.size())
+        {
+            return lower_.rbegin()->first;
+        }
+        return (lower_.rbegin()->first + upper_.begin()->first)/2;
+    }
+
+    // Calls f(value, position) for each sample with lo <= value <= hi.
+    template<class F>
+    void for_each_between(Real lo, Real hi, F f) const
+    {
+        for (auto const * half : {&lower_, &upper_})
+        {
+            for (auto it = half->lower_bound(key{lo, 0}); it != half->end() && it->first <= hi; ++it)
+            {
+                f(it->first, it->second);
+            }
+        }
+    }
+
+private:
+    using key = std::pair<Real, std::size_t>;
+
+    void rebalance()
+    {
+        if (lower_.size() > upper_.size() + 1)
+        {
+            upper_.insert(*lower_.rbegin());
+            lower_.erase(std::prev(lower_.end()));
+        }
+        else if (upper_.size() > lower_.size())
+        {
+            lower_.insert(*upper_.begin());
+            upper_.erase(upper_.begin());
+        }
+    }
+
+    std::set<key> lower_;
+    std::set<key> upper_;
+};
+
+}
+#endif
@@ -0,0 +1,158 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_SORTED_SWEEP_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_SORTED_SWEEP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/statistics/detail/central_moments.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+#include <boost/math/statistics/detail/radix_sort.hpp>
+
+// The machinery shared by the statistics which compare the empirical distribution of a sample with a hypothesized one:
+// a sorted copy of the sample, whose mean and variance are gathered in the same pass which copies it,
+// and sums and maxima of a function of the order statistics over fixed chunks, which are merged in order
+// so that every execution policy gives the same result.
+
+namespace boost::math::statistics::detail {
+
+inline constexpr std::size_t sorted_sweep_chunk_size = 8192;
+
+// Returns a sorted copy of [first, last), and its central moments to second order.
+// 32 and 64 bit integers and IEEE floats are radix sorted in parallel unless exec is std::execution::seq; other types are passed to std::sort.
+template<class Real, class ExecutionPolicy, class RandomAccessIterator>
+auto sorted_copy_with_moments(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using T = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    std::size_t chunks = (n + sorted_sweep_chunk_size - 1)/sorted_sweep_chunk_size;
+    std::vector<central_moments<Real, 2>> states(chunks);
+    std::vector<T> sorted(n);
+    auto copy_chunks = [&](auto& out, auto convert) {
+        parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c)
+            {
+                for (std::size_t i = c*sorted_sweep_chunk_size; i < (std::min)(n, (c + 1)*sorted_sweep_chunk_size); ++i)
+                {
+                    T x = first[i];
+                    states[c].push(static_cast<Real>(x));
+                    out[i] = convert(x);
+                }
+            }
+        });
+    };
+    if constexpr (radix_key_traits<T>::value)
+    {
+        using traits = radix_key_traits<T>;
+        std::vector<typename traits::key_type> keys(n);
+        copy_chunks(keys, [](T x) { return traits::to_key(x); });
+        radix_sort(exec, keys);
+        parallel_blocks(exec, n, 65536, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                sorted[i] = traits::from_key(keys[i]);
+            }
+        });
+    }
+    else
+    {
+        copy_chunks(sorted, [](T x) { return x; });
+        std::sort(sorted.begin(), sorted.end());
+    }
+    central_moments<Real, 2> total;
+    for (auto const & s : states)
+    {
+        total.merge(s);
+    }
+    return std::make_pair(std::move(sorted), total);
+}
+
+// sum_{i=0}^{n-1} term(i), accumulated over fixed chunks of indices.
+template<class Real, class ExecutionPolicy, class Term>
+Real chunked_sum(ExecutionPolicy&& exec, std::size_t n, Term term)
+{
+    std::size_t chunks = (n + sorted_sweep_chunk_size - 1)/sorted_sweep_chunk_size;
+    std::vector<Real> sums(chunks, Real(0));
+    parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c)
+        {
+            Real s = 0;
+            for (std::size_t i = c*sorted_sweep_chunk_size; i < (std::min)(n, (c + 1)*sorted_sweep_chunk_size); ++i)
+            {
+                s += term(i);
+            }
+            sums[c] = s;
+        }
+    });
+    Real total = 0;
+    for (Real s : sums)
+    {
+        total += s;
+    }
+    return total;
+}
+
+// max_{0 <= i < n} term(i), for n >= 1.
+template<class Real, class ExecutionPolicy, class Term>
+Real chunked_max(ExecutionPolicy&& exec, std::size_t n, Term term)
+{
+    std::size_t chunks = (n + sorted_sweep_chunk_size - 1)/sorted_sweep_chunk_size;
+    std::vector<Real> maxima(chunks);
+    parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c)
+        {
+            std::size_t i = c*sorted_sweep_chunk_size;
+            Real m = term(i);
+            for (++i; i < (std::min)(n, (c + 1)*sorted_sweep_chunk_size); ++i)
+            {
+                Real t = term(i);
+                if (t > m)
+                {
+                    m = t;
+                }
+            }
+            maxima[c] = m;
+        }
+    });
+    return *std::max_element(maxima.begin(), maxima.end());
+}
+
+// Evaluates f on every element of sorted, in parallel unless exec is std::execution::seq,
+// so that costly functions such as the cdf are called exactly once for each order statistic.
+template<class Real, class ExecutionPolicy, class Container, class F>
+std::vector<Real> evaluate_on_sorted(ExecutionPolicy&& exec, Container const & sorted, F f)
+{
+    std::size_t n = sorted.size();
+    std::vector<Real> values(n);
+    parallel_blocks(exec, n, 4096, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            values[i] = f(sorted[i]);
+        }
+    });
+    return values;
+}
+
+// Throws unless sorted[0] <= sorted[1] <= ... <= sorted[n-1].
+template<class Container>
+void check_sorted(Container const & sorted, char const * message)
+{
+    for (std::size_t i = 1; i < sorted.size(); ++i)
+    {
+        if (sorted[i-1] > sorted[i])
+        {
+            throw std::domain_error(message);
+        }
+    }
+}
+
+}
+#endif
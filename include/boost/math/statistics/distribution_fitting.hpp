@@ -0,0 +1,459 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DISTRIBUTION_FITTING_HPP
+#define BOOST_MATH_STATISTICS_DISTRIBUTION_FITTING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/weibull.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
+
+// Maximum likelihood estimates of distribution parameters from a sample.
+// Each estimator makes a single pass over the data to collect the sufficient statistics,
+// then refines a closed form (or method of moments) starting point with Newton's method,
+// which typically converges in 2-4 iterations.
+// The batch overloads fit one distribution per group, in parallel over the groups.
+
+namespace boost::math::statistics {
+
+namespace detail {
+
+template<class ForwardIterator>
+using fitting_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<ForwardIterator>::value_type>,
+                                          double, typename std::iterator_traits<ForwardIterator>::value_type>;
+
+// Sufficient statistics for the gamma distribution: the arithmetic mean and the mean of the logs.
+template<class ForwardIterator>
+auto mean_and_mean_log(ForwardIterator first, ForwardIterator last, const char* name)
+{
+    using Real = fitting_real_t<ForwardIterator>;
+    using std::log;
+    Real mu = 0;
+    Real mu_log = 0;
+    Real i = 1;
+    for (auto it = first; it != last; ++it)
+    {
+        Real x = *it;
+        if (!(x > 0))
+        {
+            throw std::domain_error(std::string("All samples must be positive to fit a ") + name + " distribution.");
+        }
+        mu += (x - mu)/i;
+        mu_log += (log(x) - mu_log)/i;
+        i += 1;
+    }
+    return std::make_pair(mu, mu_log);
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator, class Fitter>
+void batch_fit(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group,
+               RandomAccessOutputIterator out_first, Fitter fit)
+{
+    auto groups = static_cast<std::size_t>(std::distance(first_group, last_group));
+    parallel_blocks(exec, groups, 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g)
+        {
+            out_first[g] = fit(first_group[g]);
+        }
+    });
+}
+
+// Newton's method has converged when the relative step is a few epsilon, or when it has
+// stopped shrinking once close to the root, since rounding error in the digamma and
+// power sums can otherwise keep the last few bits oscillating.
+template<class Real>
+bool newton_converged(Real relative_step, Real & last_relative_step)
+{
+    using std::abs;
+    using std::sqrt;
+    Real step = abs(relative_step);
+    bool converged = (step <= 8*std::numeric_limits<Real>::epsilon())
+                  || (step >= last_relative_step && step <= sqrt(std::numeric_limits<Real>::epsilon()));
+    last_relative_step = step;
+    return converged;
+}
+
+} // namespace detail
+
+template<class ForwardIterator>
+auto fit_gamma(ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::fitting_real_t<ForwardIterator>;
+    using std::log;
+    using std::sqrt;
+    using std::abs;
+    if (std::distance(first, last) < 2)
+    {
+        throw std::domain_error("At least 2 samples are required to fit a gamma distribution.");
+    }
+    auto [mu, mu_log] = detail::mean_and_mean_log(first, last, "gamma");
+    // The likelihood equation for the shape k is log(k) - digamma(k) = s:
+    Real s = log(mu) - mu_log;
+    if (!(s > 0))
+    {
+        throw std::domain_error("The samples have no variance; the gamma distribution cannot be fitted.");
+    }
+    // Starting point from T. Minka, "Estimating a Gamma distribution", 2002; good to about 1.5%:
+    Real k = (3 - s + sqrt((s - 3)*(s - 3) + 24*s))/(12*s);
+    Real last_step = std::numeric_limits<Real>::infinity();
+    for (unsigned iter = 0; iter < 100; ++iter)
+    {
+        Real f = log(k) - boost::math::digamma(k) - s;
+        Real df = 1/k - boost::math::trigamma(k);
+        Real next = k - f/df;
+        if (!(next > 0))
+        {
+            next = k/2;
+        }
+        Real delta = next - k;
+        k = next;
+        if (detail::newton_converged(delta/k, last_step))
+        {
+            break;
+        }
+    }
+    return boost::math::gamma_distribution<Real>(k, mu/k);
+}
+
+template<class Container>
+inline auto fit_gamma(Container const & v)
+{
+    return fit_gamma(v.cbegin(), v.cend());
+}
+
+template<class ForwardIterator>
+auto fit_beta(ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::fitting_real_t<ForwardIterator>;
+    using std::log;
+    using std::abs;
+    if (std::distance(first, last) < 2)
+    {
+        throw std::domain_error("At least 2 samples are required to fit a beta distribution.");
+    }
+    // One pass for the mean, variance, and the means of log(x) and log(1-x):
+    Real mu = 0;
+    Real M2 = 0;
+    Real g1 = 0;
+    Real g2 = 0;
+    Real i = 1;
+    for (auto it = first; it != last; ++it)
+    {
+        Real x = *it;
+        if (!(x > 0 && x < 1))
+        {
+            throw std::domain_error("All samples must lie in (0, 1) to fit a beta distribution.");
+        }
+        Real tmp = x - mu;
+        mu += tmp/i;
+        M2 += tmp*(x - mu);
+        g1 += (log(x) - g1)/i;
+        g2 += (boost::math::log1p(-x) - g2)/i;
+        i += 1;
+    }
+    Real var = M2/(i - 2);
+    if (!(var > 0))
+    {
+        throw std::domain_error("The samples have no variance; the beta distribution cannot be fitted.");
+    }
+    // Method of moments starting point:
+    Real c = mu*(1 - mu)/var - 1;
+    if (!(c > 0))
+    {
+        c = 1;
+    }
+    Real a = mu*c;
+    Real b = (1 - mu)*c;
+    // Newton's method on the likelihood equations
+    //   digamma(a) - digamma(a+b) = g1,  digamma(b) - digamma(a+b) = g2.
+    Real last_step = std::numeric_limits<Real>::infinity();
+    for (unsigned iter = 0; iter < 100; ++iter)
+    {
+        Real psi_ab = boost::math::digamma(a + b);
+        Real f1 = boost::math::digamma(a) - psi_ab - g1;
+        Real f2 = boost::math::digamma(b) - psi_ab - g2;
+        Real t_ab = boost::math::trigamma(a + b);
+        Real j11 = boost::math::trigamma(a) - t_ab;
+        Real j22 = boost::math::trigamma(b) - t_ab;
+        Real det = j11*j22 - t_ab*t_ab;
+        Real da = (j22*f1 + t_ab*f2)/det;
+        Real db = (t_ab*f1 + j11*f2)/det;
+        // Keep the parameters positive by shortening the step:
+        while (!(a - da > 0 && b - db > 0))
+        {
+            da /= 2;
+            db /= 2;
+        }
+        a -= da;
+        b -= db;
+        if (detail::newton_converged((std::max)(abs(da/a), abs(db/b)), last_step))
+        {
+            break;
+        }
+    }
+    return boost::math::beta_distribution<Real>(a, b);
+}
+
+template<class Container>
+inline auto fit_beta(Container const & v)
+{
+    return fit_beta(v.cbegin(), v.cend());
+}
+
+template<class ForwardIterator>
+auto fit_weibull(ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::fitting_real_t<ForwardIterator>;
+    using std::log;
+    using std::exp;
+    using std::sqrt;
+    using std::abs;
+    if (std::distance(first, last) < 2)
+    {
+        throw std::domain_error("At least 2 samples are required to fit a Weibull distribution.");
+    }
+    // The shape equation needs sums of powers of the data at each iteration, so keep the logs:
+    std::vector<Real> logs;
+    logs.reserve(std::distance(first, last));
+    Real mu_log = 0;
+    Real M2 = 0;
+    Real max_log = -std::numeric_limits<Real>::infinity();
+    Real i = 1;
+    for (auto it = first; it != last; ++it)
+    {
+        Real x = *it;
+        if (!(x > 0))
+        {
+            throw std::domain_error("All samples must be positive to fit a Weibull distribution.");
+        }
+        Real l = log(x);
+        logs.push_back(l);
+        Real tmp = l - mu_log;
+        mu_log += tmp/i;
+        M2 += tmp*(l - mu_log);
+        max_log = (std::max)(max_log, l);
+        i += 1;
+    }
+    Real n = i - 1;
+    if (!(M2 > 0))
+    {
+        throw std::domain_error("The samples have no variance; the Weibull distribution cannot be fitted.");
+    }
+    // The log of a Weibull variate has standard deviation pi/(k*sqrt(6)):
+    Real k = boost::math::constants::pi<Real>()/sqrt(6*M2/(n - 1));
+    // Sums of x^k, x^k*log(x) and x^k*log(x)^2, with x scaled by its maximum so x^k cannot overflow.
+    Real s0, s1, s2;
+    auto power_sums = [&](Real shape) {
+        s0 = 0;
+        s1 = 0;
+        s2 = 0;
+        for (Real l : logs)
+        {
+            Real d = l - max_log;
+            Real w = exp(shape*d);
+            s0 += w;
+            s1 += w*d;
+            s2 += w*d*d;
+        }
+    };
+    // Solve s1/s0 + max_log - 1/k - mu_log = 0, an increasing function of k:
+    Real mu_d = mu_log - max_log;
+    Real last_step = std::numeric_limits<Real>::infinity();
+    for (unsigned iter = 0; iter < 100; ++iter)
+    {
+        power_sums(k);
+        Real f = s1/s0 - 1/k - mu_d;
+        Real df = (s2*s0 - s1*s1)/(s0*s0) + 1/(k*k);
+        Real next = k - f/df;
+        if (!(next > 0))
+        {
+            next = k/2;
+        }
+        Real delta = next - k;
+        k = next;
+        if (detail::newton_converged(delta/k, last_step))
+        {
+            break;
+        }
+    }
+    power_sums(k);
+    Real scale = exp(max_log + log(s0/n)/k);
+    return boost::math::weibull_distribution<Real>(k, scale);
+}
+
+template<class Container>
+inline auto fit_weibull(Container const & v)
+{
+    return fit_weibull(v.cbegin(), v.cend());
+}
+
+template<class ForwardIterator>
+auto fit_lognormal(ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::fitting_real_t<ForwardIterator>;
+    using std::log;
+    using std::sqrt;
+    if (std::distance(first, last) < 2)
+    {
+        throw std::domain_error("At least 2 samples are required to fit a lognormal distribution.");
+    }
+    // The maximum likelihood estimates are closed form: the mean and (biased) standard deviation of the logs.
+    Real mu = 0;
+    Real M2 = 0;
+    Real i = 1;
+    for (auto it = first; it != last; ++it)
+    {
+        Real x = *it;
+        if (!(x > 0))
+        {
+            throw std::domain_error("All samples must be positive to fit a lognormal distribution.");
+        }
+        Real l = log(x);
+        Real tmp = l - mu;
+        mu += tmp/i;
+        M2 += tmp*(l - mu);
+        i += 1;
+    }
+    if (!(M2 > 0))
+    {
+        throw std::domain_error("The samples have no variance; the lognormal distribution cannot be fitted.");
+    }
+    return boost::math::lognormal_distribution<Real>(mu, sqrt(M2/(i - 1)));
+}
+
+template<class Container>
+inline auto fit_lognormal(Container const & v)
+{
+    return fit_lognormal(v.cbegin(), v.cend());
+}
+
+template<class ForwardIterator>
+auto fit_negative_binomial(ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::fitting_real_t<ForwardIterator>;
+    using std::log;
+    using std::exp;
+    using std::abs;
+    if (std::distance(first, last) < 2)
+    {
+        throw std::domain_error("At least 2 samples are required to fit a negative binomial distribution.");
+    }
+    Real mu = 0;
+    Real M2 = 0;
+    Real i = 1;
+    std::vector<Real> samples;
+    for (auto it = first; it != last; ++it)
+    {
+        Real x = *it;
+        if (!(x >= 0))
+        {
+            throw std::domain_error("All samples must be non-negative to fit a negative binomial distribution.");
+        }
+        Real tmp = x - mu;
+        mu += tmp/i;
+        M2 += tmp*(x - mu);
+        i += 1;
+        samples.push_back(x);
+    }
+    Real n = i - 1;
+    Real var = M2/(n - 1);
+    if (!(var > mu))
+    {
+        throw std::domain_error("The samples are not overdispersed (variance <= mean); the negative binomial distribution cannot be fitted.");
+    }
+    // The likelihood depends on the samples only through how often each count occurs,
+    // and counts are typically few and small, so each Newton step is taken over the distinct counts:
+    std::sort(samples.begin(), samples.end());
+    std::vector<std::pair<Real, Real>> histogram;
+    for (Real x : samples)
+    {
+        if (histogram.empty() || histogram.back().first != x)
+        {
+            histogram.emplace_back(x, Real(0));
+        }
+        histogram.back().second += 1;
+    }
+    // Method of moments starting point, then Newton's method in log(r) on the profile likelihood equation
+    //   sum(digamma(x_i + r)) - n*digamma(r) + n*log(r/(r + mu)) = 0.
+    Real r = mu*mu/(var - mu);
+    Real t = log(r);
+    Real last_step = std::numeric_limits<Real>::infinity();
+    for (unsigned iter = 0; iter < 100; ++iter)
+    {
+        Real f = n*(log(r/(r + mu)) - boost::math::digamma(r));
+        Real df = n*(mu/(r*(r + mu)) - boost::math::trigamma(r));
+        for (auto const & [x, count] : histogram)
+        {
+            f += count*boost::math::digamma(x + r);
+            df += count*boost::math::trigamma(x + r);
+        }
+        Real delta = f/(r*df);
+        t -= delta;
+        r = exp(t);
+        if (detail::newton_converged(delta, last_step))
+        {
+            break;
+        }
+    }
+    return boost::math::negative_binomial_distribution<Real>(r, r/(r + mu));
+}
+
+template<class Container>
+inline auto fit_negative_binomial(Container const & v)
+{
+    return fit_negative_binomial(v.cbegin(), v.cend());
+}
+
+// Batch fitting: *out_first++ = fit_xxx(group) for each group in [first_group, last_group),
+// with the groups shared out between threads unless the policy is std::execution::seq.
+// Both iterators must be random access.
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator>
+inline void fit_gamma(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group, RandomAccessOutputIterator out_first)
+{
+    detail::batch_fit(exec, first_group, last_group, out_first, [](auto const & g) { return fit_gamma(g); });
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator>
+inline void fit_beta(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group, RandomAccessOutputIterator out_first)
+{
+    detail::batch_fit(exec, first_group, last_group, out_first, [](auto const & g) { return fit_beta(g); });
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator>
+inline void fit_weibull(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group, RandomAccessOutputIterator out_first)
+{
+    detail::batch_fit(exec, first_group, last_group, out_first, [](auto const & g) { return fit_weibull(g); });
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator>
+inline void fit_lognormal(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group, RandomAccessOutputIterator out_first)
+{
+    detail::batch_fit(exec, first_group, last_group, out_first, [](auto const & g) { return fit_lognormal(g); });
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator>
+inline void fit_negative_binomial(ExecutionPolicy&& exec, RandomAccessIterator first_group, RandomAccessIterator last_group, RandomAccessOutputIterator out_first)
+{
+    detail::batch_fit(exec, first_group, last_group, out_first, [](auto const & g) { return fit_negative_binomial(g); });
+}
+
+}
+#endif
@@ -0,0 +1,106 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_GOODNESS_OF_FIT_HPP
+#define BOOST_MATH_STATISTICS_GOODNESS_OF_FIT_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/sorted_sweep.hpp>
+
+// Statistics of the distance between the empirical distribution of a sample and a hypothesized distribution,
+// given by its cumulative distribution function: any callable which maps a value of the sample to a probability,
+// such as [&](double x) { return cdf(dist, x); } for a distribution of Boost.Math.
+// The overloads without an execution policy require sorted data, as anderson_darling_normality_statistic does;
+// those with one accept data in any order and work on a sorted copy.
+
+namespace boost::math::statistics {
+
+namespace detail {
+
+template<class RandomAccessContainer>
+using goodness_of_fit_real_t = std::conditional_t<std::is_integral_v<typename RandomAccessContainer::value_type>,
+                                                  double, typename RandomAccessContainer::value_type>;
+
+inline constexpr char const * goodness_of_fit_unsorted_message = "Input data must be sorted in increasing order v[0] <= v[1] <= . . .  <= v[n-1]";
+
+// D = max_i max(F(x_(i)) - i/n, (i+1)/n - F(x_(i))), counting the order statistics x_(i) from zero.
+template<class Real, class ExecutionPolicy, class SortedContainer, class CDF>
+Real kolmogorov_smirnov_statistic_of_sorted(ExecutionPolicy&& exec, SortedContainer const & v, CDF cdf)
+{
+    std::size_t n = v.size();
+    if (n == 0)
+    {
+        throw std::domain_error("At least one sample is required to compute the Kolmogorov-Smirnov statistic.");
+    }
+    std::vector<Real> F = evaluate_on_sorted<Real>(exec, v, [&](auto x) { return static_cast<Real>(cdf(x)); });
+    return chunked_max<Real>(exec, n, [&](std::size_t i) {
+        Real below = F[i] - Real(i)/Real(n);
+        Real above = Real(i + 1)/Real(n) - F[i];
+        return below > above ? below : above;
+    });
+}
+
+// W^2 = 1/(12n) + sum_i ((2i+1)/(2n) - F(x_(i)))^2.
+template<class Real, class ExecutionPolicy, class SortedContainer, class CDF>
+Real cramer_von_mises_statistic_of_sorted(ExecutionPolicy&& exec, SortedContainer const & v, CDF cdf)
+{
+    std::size_t n = v.size();
+    if (n == 0)
+    {
+        throw std::domain_error("At least one sample is required to compute the Cramer-von Mises statistic.");
+    }
+    std::vector<Real> F = evaluate_on_sorted<Real>(exec, v, [&](auto x) { return static_cast<Real>(cdf(x)); });
+    Real sum = chunked_sum<Real>(exec, n, [&](std::size_t i) {
+        Real d = Real(2*i + 1)/Real(2*n) - F[i];
+        return d*d;
+    });
+    return 1/Real(12*n) + sum;
+}
+
+}
+
+// The Kolmogorov-Smirnov statistic sup_x |F_n(x) - F(x)| of sorted data.
+template<class RandomAccessContainer, class CDF>
+auto kolmogorov_smirnov_statistic(RandomAccessContainer const & v, CDF cdf)
+{
+    using Real = detail::goodness_of_fit_real_t<RandomAccessContainer>;
+    detail::check_sorted(v, detail::goodness_of_fit_unsorted_message);
+    return detail::kolmogorov_smirnov_statistic_of_sorted<Real>(std::execution::seq, v, cdf);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class CDF, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto kolmogorov_smirnov_statistic(ExecutionPolicy&& exec, RandomAccessContainer const & v, CDF cdf)
+{
+    using Real = detail::goodness_of_fit_real_t<RandomAccessContainer>;
+    auto sorted = detail::sorted_copy_with_moments<Real>(exec, v.cbegin(), v.cend()).first;
+    return detail::kolmogorov_smirnov_statistic_of_sorted<Real>(exec, sorted, cdf);
+}
+
+// The Cramer-von Mises statistic n int (F_n(x) - F(x))^2 dF(x) of sorted data.
+template<class RandomAccessContainer, class CDF>
+auto cramer_von_mises_statistic(RandomAccessContainer const & v, CDF cdf)
+{
+    using Real = detail::goodness_of_fit_real_t<RandomAccessContainer>;
+    detail::check_sorted(v, detail::goodness_of_fit_unsorted_message);
+    return detail::cramer_von_mises_statistic_of_sorted<Real>(std::execution::seq, v, cdf);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class CDF, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto cramer_von_mises_statistic(ExecutionPolicy&& exec, RandomAccessContainer const & v, CDF cdf)
+{
+    using Real = detail::goodness_of_fit_real_t<RandomAccessContainer>;
+    auto sorted = detail::sorted_copy_with_moments<Real>(exec, v.cbegin(), v.cend()).first;
+    return detail::cramer_von_mises_statistic_of_sorted<Real>(exec, sorted, cdf);
+}
+
+}
+#endif
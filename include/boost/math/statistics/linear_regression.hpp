@@ -10,9 +10,19 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <boost/math/statistics/univariate_statistics.hpp>
 #include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/accumulators.hpp>
+#include <boost/math/statistics/detail/cholesky.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
 
 namespace boost::math::statistics {
 
@@ -91,5 +101,510 @@ auto simple_ordinary_least_squares_with_R_squared(RandomAccessContainer const &
     return std::make_tuple(c0, c1, Rsquared);
 }
 
+// The result of a multiple linear regression y = c_0 + c_1 x_1 + ... + c_p x_p.
+// The standard errors and t-statistics are those of the coefficients, and may be passed to coefficient_t_test in t_test.hpp
+// along with the residual degrees of freedom n - p - 1. When there are no residual degrees of freedom, they are NaN.
+template<class Real>
+struct least_squares_fit
+{
+    // The intercept c_0, followed by the coefficient of each predictor:
+    std::vector<Real> coefficients;
+    std::vector<Real> standard_errors;
+    std::vector<Real> t_statistics;
+    Real residual_sum_of_squares;
+    Real R_squared;
+    Real degrees_of_freedom;
+};
+
+namespace detail {
+
+// Rows of the design matrix in each chunk of the Gram matrix construction.
+// The chunks are fixed, and their partial sums merged in order, so that every execution policy gives the same fit.
+inline constexpr std::size_t least_squares_chunk_size = 8192;
+
+struct unit_weight
+{
+    template<class Index>
+    constexpr int operator()(Index) const
+    {
+        return 1;
+    }
+};
+
+}
+
+// Accumulates the weighted means and centered cross products of p predictors and a response,
+// from which ordinary, weighted and ridge least squares fits with an intercept are solved.
+// The state is O(p^2) whatever the number of observations, so data which do not fit in memory may be streamed through it,
+// and accumulators fed disjoint parts of a dataset may be merged, as in accumulators.hpp.
+// The updates are the multivariate versions of those of covariance_accumulator; see
+// https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
+template<class Real>
+class least_squares_accumulator
+{
+public:
+    explicit least_squares_accumulator(std::size_t predictors)
+        : p_{predictors}, mean_(predictors + 1, Real(0)), comoment_((predictors + 1)*(predictors + 1), Real(0))
+    {
+    }
+
+    // Adds the observation y at the predictors x[0], ..., x[p-1], with weight w.
+    template<class RandomAccessContainer, std::enable_if_t<detail::is_range<RandomAccessContainer>::value, bool> = true>
+    void push(RandomAccessContainer const & x, Real y, Real w = 1)
+    {
+        using std::size;
+        if (static_cast<std::size_t>(size(x)) != p_)
+        {
+            throw std::domain_error("The observation must have one value for each predictor.");
+        }
+        if (!(w >= 0))
+        {
+            throw std::domain_error("Weights must be non-negative.");
+        }
+        if (w == 0)
+        {
+            return;
+        }
+        std::size_t q = p_ + 1;
+        auto d = [&](std::size_t k) { return (k < p_ ? static_cast<Real>(x[k]) : y) - mean_[k]; };
+        ++n_;
+        Real W = W_ + w;
+        Real g = w*W_/W;
+        for (std::size_t k = 0; k < q; ++k)
+        {
+            Real dk = d(k);
+            for (std::size_t j = k; j < q; ++j)
+            {
+                comoment_[k*q + j] += g*d(j)*dk;
+            }
+        }
+        for (std::size_t k = 0; k < q; ++k)
+        {
+            mean_[k] += (w/W)*d(k);
+        }
+        W_ = W;
+    }
+
+    // Adds the rows of a column major design matrix X, with y.size() rows and p columns, and the responses y.
+    template<class RandomAccessContainer, std::enable_if_t<detail::is_range<RandomAccessContainer>::value, bool> = true>
+    void push(RandomAccessContainer const & X, RandomAccessContainer const & y)
+    {
+        std::size_t n = rows_of(X, y);
+        push_rows(X, y, detail::unit_weight(), n, 0, n);
+    }
+
+    // Adds the rows of X and the responses y with weights w.
+    template<class RandomAccessContainer, std::enable_if_t<detail::is_range<RandomAccessContainer>::value, bool> = true>
+    void push(RandomAccessContainer const & X, RandomAccessContainer const & y, RandomAccessContainer const & w)
+    {
+        using std::size;
+        std::size_t n = rows_of(X, y);
+        if (static_cast<std::size_t>(size(w)) != n)
+        {
+            throw std::domain_error("There must be one weight for each observation.");
+        }
+        push_rows(X, y, [&](std::size_t i) { return w[i]; }, n, 0, n);
+    }
+
+    // Adds rows [first_row, last_row) of the column major design matrix X with n rows, as push does;
+    // weight(i) is the weight of row i.
+    template<class DesignMatrix, class Response, class Weight>
+    void push_rows(DesignMatrix const & X, Response const & y, Weight weight, std::size_t n, std::size_t first_row, std::size_t last_row)
+    {
+        using std::sqrt;
+        std::size_t q = p_ + 1;
+        // Each block is centered on its own means by two passes, so that the cross products are accurate,
+        // and is then merged in; the columns of a block are kept small enough to stay in cache for the products.
+        std::size_t block_rows = (std::max)(std::size_t(256), std::size_t(16384)/q);
+        std::vector<Real> centered;
+        std::vector<Real> root_w;
+        least_squares_accumulator block(p_);
+        for (std::size_t r0 = first_row; r0 < last_row; r0 += block_rows)
+        {
+            std::size_t r1 = (std::min)(last_row, r0 + block_rows);
+            std::size_t m = r1 - r0;
+            root_w.resize(m);
+            centered.resize(m*q);
+            block.n_ = 0;
+            block.W_ = 0;
+            for (std::size_t r = 0; r < m; ++r)
+            {
+                Real w = static_cast<Real>(weight(r0 + r));
+                if (!(w >= 0))
+                {
+                    throw std::domain_error("Weights must be non-negative.");
+                }
+                root_w[r] = sqrt(w);
+                block.W_ += w;
+                block.n_ += (w > 0);
+            }
+            if (block.n_ == 0)
+            {
+                continue;
+            }
+            for (std::size_t k = 0; k < q; ++k)
+            {
+                Real* c = centered.data() + k*m;
+                for (std::size_t r = 0; r < m; ++r)
+                {
+                    c[r] = k < p_ ? static_cast<Real>(X[k*n + r0 + r]) : static_cast<Real>(y[r0 + r]);
+                }
+                Real sum = 0;
+                for (std::size_t r = 0; r < m; ++r)
+                {
+                    sum += root_w[r]*root_w[r]*c[r];
+                }
+                Real mu = sum/block.W_;
+                for (std::size_t r = 0; r < m; ++r)
+                {
+                    c[r] = root_w[r]*(c[r] - mu);
+                }
+                block.mean_[k] = mu;
+            }
+            for (std::size_t k = 0; k < q; ++k)
+            {
+                Real const * ck = centered.data() + k*m;
+                for (std::size_t j = k; j < q; ++j)
+                {
+                    Real const * cj = centered.data() + j*m;
+                    // Four independent sums, so the multiply-adds are not serialized on one register:
+                    Real sum[4] = {0, 0, 0, 0};
+                    std::size_t r = 0;
+                    for (; r + 4 <= m; r += 4)
+                    {
+                        sum[0] += cj[r]*ck[r];
+                        sum[1] += cj[r + 1]*ck[r + 1];
+                        sum[2] += cj[r + 2]*ck[r + 2];
+                        sum[3] += cj[r + 3]*ck[r + 3];
+                    }
+                    for (; r < m; ++r)
+                    {
+                        sum[0] += cj[r]*ck[r];
+                    }
+                    block.comoment_[k*q + j] = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+                }
+            }
+            merge(block);
+        }
+    }
+
+    void merge(least_squares_accumulator const & other)
+    {
+        if (other.p_ != p_)
+        {
+            throw std::domain_error("Only accumulators with the same number of predictors may be merged.");
+        }
+        if (other.n_ == 0)
+        {
+            return;
+        }
+        if (n_ == 0)
+        {
+            *this = other;
+            return;
+        }
+        std::size_t q = p_ + 1;
+        Real W = W_ + other.W_;
+        Real f = other.W_/W;
+        Real g = W_*other.W_/W;
+        std::vector<Real> d(q);
+        for (std::size_t k = 0; k < q; ++k)
+        {
+            d[k] = other.mean_[k] - mean_[k];
+        }
+        for (std::size_t k = 0; k < q; ++k)
+        {
+            for (std::size_t j = k; j < q; ++j)
+            {
+                comoment_[k*q + j] += other.comoment_[k*q + j] + g*d[j]*d[k];
+            }
+            mean_[k] += f*d[k];
+        }
+        n_ += other.n_;
+        W_ = W;
+    }
+
+    // The number of observations with positive weight.
+    std::size_t count() const
+    {
+        return n_;
+    }
+
+    std::size_t predictors() const
+    {
+        return p_;
+    }
+
+    // Minimizes sum_i w_i (y_i - c_0 - c_1 x_i1 - ... - c_p x_ip)^2 + ridge*(c_1^2 + ... + c_p^2); the intercept is not penalized.
+    // The centered normal equations are scaled to unit diagonal and solved by Cholesky factorization.
+    // For ridge > 0, the standard errors are those of the sandwich (X^TX + ridge I)^-1 X^TX (X^TX + ridge I)^-1 sigma^2.
+    least_squares_fit<Real> fit(Real ridge = 0) const
+    {
+        using std::sqrt;
+        if (!(ridge >= 0))
+        {
+            throw std::domain_error("The ridge parameter must be non-negative.");
+        }
+        if (n_ <= 1)
+        {
+            throw std::domain_error("At least 2 samples are required to perform a linear regression.");
+        }
+        std::size_t p = p_;
+        std::size_t q = p_ + 1;
+        auto C = [&](std::size_t j, std::size_t k) { return j >= k ? comoment_[k*q + j] : comoment_[j*q + k]; };
+
+        std::vector<Real> scale(p);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Real d = C(j, j) + ridge;
+            if (!(d > 0))
+            {
+                throw std::domain_error("Independent variable has no variance; this breaks linear regression.");
+            }
+            scale[j] = sqrt(d);
+        }
+        std::vector<Real> L(p*p);
+        for (std::size_t k = 0; k < p; ++k)
+        {
+            for (std::size_t j = 0; j < p; ++j)
+            {
+                L[k*p + j] = (C(j, k) + (j == k ? ridge : Real(0)))/(scale[j]*scale[k]);
+            }
+        }
+        if (!detail::cholesky_decompose(L, p))
+        {
+            throw std::domain_error("The independent variables are linearly dependent; the least squares solution is not unique.");
+        }
+        std::vector<Real> beta(p);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            beta[j] = C(p, j)/scale[j];
+        }
+        detail::cholesky_solve(L, p, beta);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            beta[j] /= scale[j];
+        }
+
+        least_squares_fit<Real> result;
+        result.coefficients.resize(q);
+        result.coefficients[0] = mean_[p];
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            result.coefficients[j + 1] = beta[j];
+            result.coefficients[0] -= beta[j]*mean_[j];
+        }
+        Real Syy = C(p, p);
+        Real bSxy = 0;
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            bSxy += beta[j]*C(p, j);
+        }
+        Real rss = Syy - bSxy;
+        if (ridge > 0)
+        {
+            // rss = Syy - 2 b^T X^Ty + b^T X^TX b, and at the ridge solution b^T X^TX b = b^T X^Ty - ridge |b|^2:
+            Real bb = 0;
+            for (std::size_t j = 0; j < p; ++j)
+            {
+                bb += beta[j]*beta[j];
+            }
+            rss -= ridge*bb;
+        }
+        result.residual_sum_of_squares = (std::max)(rss, Real(0));
+        if (Syy == 0)
+        {
+            // Then y = constant, so the linear regression is perfect.
+            result.R_squared = 1;
+        }
+        else
+        {
+            result.R_squared = 1 - result.residual_sum_of_squares/Syy;
+        }
+        result.degrees_of_freedom = static_cast<Real>(n_) - static_cast<Real>(q);
+
+        result.standard_errors.assign(q, std::numeric_limits<Real>::quiet_NaN());
+        result.t_statistics.assign(q, std::numeric_limits<Real>::quiet_NaN());
+        if (result.degrees_of_freedom > 0)
+        {
+            Real sigma_sq = result.residual_sum_of_squares/result.degrees_of_freedom;
+            std::vector<Real> cov = detail::cholesky_inverse(L, p);
+            for (std::size_t k = 0; k < p; ++k)
+            {
+                for (std::size_t j = 0; j < p; ++j)
+                {
+                    cov[k*p + j] /= scale[j]*scale[k];
+                }
+            }
+            if (ridge > 0)
+            {
+                // cov <- cov X^TX cov:
+                std::vector<Real> tmp(p*p, Real(0));
+                for (std::size_t k = 0; k < p; ++k)
+                {
+                    for (std::size_t l = 0; l < p; ++l)
+                    {
+                        Real s = C(l, k);
+                        for (std::size_t j = 0; j < p; ++j)
+                        {
+                            tmp[k*p + j] += cov[l*p + j]*s;
+                        }
+                    }
+                }
+                std::vector<Real> sandwich(p*p, Real(0));
+                for (std::size_t k = 0; k < p; ++k)
+                {
+                    for (std::size_t l = 0; l < p; ++l)
+                    {
+                        Real s = cov[k*p + l];
+                        for (std::size_t j = 0; j < p; ++j)
+                        {
+                            sandwich[k*p + j] += tmp[l*p + j]*s;
+                        }
+                    }
+                }
+                cov.swap(sandwich);
+            }
+            // The intercept is the weighted mean of y less the predicted mean, whose errors are uncorrelated:
+            Real intercept_var = 1/W_;
+            for (std::size_t k = 0; k < p; ++k)
+            {
+                for (std::size_t j = 0; j < p; ++j)
+                {
+                    intercept_var += mean_[j]*cov[k*p + j]*mean_[k];
+                }
+            }
+            result.standard_errors[0] = sqrt(sigma_sq*intercept_var);
+            for (std::size_t j = 0; j < p; ++j)
+            {
+                result.standard_errors[j + 1] = sqrt(sigma_sq*cov[j*p + j]);
+            }
+            for (std::size_t j = 0; j < q; ++j)
+            {
+                result.t_statistics[j] = result.coefficients[j]/result.standard_errors[j];
+            }
+        }
+        return result;
+    }
+
+private:
+    template<class DesignMatrix, class Response>
+    std::size_t rows_of(DesignMatrix const & X, Response const & y) const
+    {
+        using std::size;
+        std::size_t n = static_cast<std::size_t>(size(y));
+        if (static_cast<std::size_t>(size(X)) != n*p_)
+        {
+            throw std::domain_error("The design matrix must have one row of predictors for each observation.");
+        }
+        return n;
+    }
+
+    std::size_t p_;
+    std::size_t n_ = 0;
+    Real W_ = 0;
+    // The weighted means of the predictors and then the response:
+    std::vector<Real> mean_;
+    // The lower triangle of the (p+1) x (p+1) matrix of centered cross products, column major:
+    std::vector<Real> comoment_;
+};
+
+namespace detail {
+
+// The Gram matrix of a column major design matrix, built from fixed chunks of rows which are shared out over threads.
+template<class ExecutionPolicy, class RandomAccessContainer, class Weight>
+auto least_squares_gram(ExecutionPolicy&& exec, RandomAccessContainer const & X, RandomAccessContainer const & y, Weight weight)
+{
+    using Real = typename RandomAccessContainer::value_type;
+    std::size_t n = y.size();
+    if (n <= 1)
+    {
+        throw std::domain_error("At least 2 samples are required to perform a linear regression.");
+    }
+    if (X.size() % n != 0)
+    {
+        throw std::domain_error("The design matrix must have one row of predictors for each observation.");
+    }
+    std::size_t p = X.size()/n;
+    std::size_t chunks = (n + least_squares_chunk_size - 1)/least_squares_chunk_size;
+    std::vector<least_squares_accumulator<Real>> partial(chunks, least_squares_accumulator<Real>(p));
+    parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c)
+        {
+            partial[c].push_rows(X, y, weight, n, c*least_squares_chunk_size, (std::min)(n, (c + 1)*least_squares_chunk_size));
+        }
+    });
+    for (std::size_t c = 1; c < chunks; ++c)
+    {
+        partial[0].merge(partial[c]);
+    }
+    return partial[0];
+}
+
+}
+
+// Fits y = c_0 + c_1 x_1 + ... + c_p x_p by least squares.
+// X is the column major n x p design matrix without a column of ones, so X[j*n + i] is predictor j of observation i, and n = y.size().
+// The Gram matrix is built in parallel unless the policy is std::execution::seq.
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto ordinary_least_squares(ExecutionPolicy&& exec, RandomAccessContainer const & X, RandomAccessContainer const & y)
+{
+    return detail::least_squares_gram(exec, X, y, detail::unit_weight()).fit();
+}
+
+template<class RandomAccessContainer>
+auto ordinary_least_squares(RandomAccessContainer const & X, RandomAccessContainer const & y)
+{
+    return ordinary_least_squares(std::execution::seq, X, y);
+}
+
+// Least squares with observation i weighted by w[i].
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto weighted_least_squares(ExecutionPolicy&& exec, RandomAccessContainer const & X, RandomAccessContainer const & y, RandomAccessContainer const & w)
+{
+    if (w.size() != y.size())
+    {
+        throw std::domain_error("There must be one weight for each observation.");
+    }
+    return detail::least_squares_gram(exec, X, y, [&](std::size_t i) { return w[i]; }).fit();
+}
+
+template<class RandomAccessContainer, std::enable_if_t<!detail::is_execution_policy_v<RandomAccessContainer>, bool> = true>
+auto weighted_least_squares(RandomAccessContainer const & X, RandomAccessContainer const & y, RandomAccessContainer const & w)
+{
+    return weighted_least_squares(std::execution::seq, X, y, w);
+}
+
+// Least squares with the penalty ridge*(c_1^2 + ... + c_p^2).
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto ridge_regression(ExecutionPolicy&& exec, RandomAccessContainer const & X, RandomAccessContainer const & y,
+                      typename RandomAccessContainer::value_type ridge)
+{
+    return detail::least_squares_gram(exec, X, y, detail::unit_weight()).fit(ridge);
+}
+
+template<class RandomAccessContainer, std::enable_if_t<!detail::is_execution_policy_v<RandomAccessContainer>, bool> = true>
+auto ridge_regression(RandomAccessContainer const & X, RandomAccessContainer const & y, typename RandomAccessContainer::value_type ridge)
+{
+    return ridge_regression(std::execution::seq, X, y, ridge);
+}
+
+// Fits each of the problems in [first_problem, last_problem), writing the least_squares_fit of each to out_first.
+// Each problem is a pair or tuple whose first element is the design matrix and whose second is the response.
+// The problems are shared out over threads unless the policy is std::execution::seq, and each is solved on a single thread.
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+void ordinary_least_squares(ExecutionPolicy&& exec, RandomAccessIterator first_problem, RandomAccessIterator last_problem,
+                            RandomAccessOutputIterator out_first)
+{
+    auto count = static_cast<std::size_t>(std::distance(first_problem, last_problem));
+    detail::parallel_blocks(exec, count, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i)
+        {
+            out_first[i] = ordinary_least_squares(std::get<0>(first_problem[i]), std::get<1>(first_problem[i]));
+        }
+    });
+}
+
 }
 #endif
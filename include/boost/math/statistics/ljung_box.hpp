@@ -7,16 +7,22 @@
 #define BOOST_MATH_STATISTICS_LJUNG_BOX_HPP
 
 #include <cmath>
+#include <cstdint>
+#include <execution>
 #include <iterator>
 #include <utility>
 #include <boost/math/distributions/chi_squared.hpp>
-#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/autocorrelation.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
 
 namespace boost::math::statistics {
 
-template<class RandomAccessIterator>
-auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
-    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+namespace detail {
+
+// The Ljung-Box and Box-Pierce statistics differ only in the weight given to each squared autocorrelation.
+template<class ExecutionPolicy, class RandomAccessIterator>
+auto portmanteau_test(ExecutionPolicy&& exec, RandomAccessIterator begin, RandomAccessIterator end, int64_t lags, int64_t fit_dof, bool ljung) {
+    using Real = autocovariance_real_t<RandomAccessIterator>;
     int64_t n = std::distance(begin, end);
     if (lags >= n) {
       throw std::domain_error("Number of lags must be < number of elements in array.");
@@ -31,23 +37,22 @@ auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lag
       throw std::domain_error("Must have at least one lag.");
     }
 
-    auto mu = boost::math::statistics::mean(begin, end);
-
-    std::vector<Real> r(lags + 1, Real(0));
-    for (size_t i = 0; i < r.size(); ++i) {
-      for (auto it = begin + i; it != end; ++it) {
-        Real ak = *(it) - mu;
-        Real akml = *(it-i) - mu;
-        r[i] += ak*akml;
-      }
-    }
+    auto r = boost::math::statistics::autocovariance(exec, begin, end, static_cast<std::size_t>(lags));
 
     Real Q = 0;
 
-    for (size_t k = 1; k < r.size(); ++k) {
-      Q += r[k]*r[k]/(r[0]*r[0]*(n-k));
+    if (ljung) {
+      for (size_t k = 1; k < r.size(); ++k) {
+        Q += r[k]*r[k]/(r[0]*r[0]*(n-k));
+      }
+      Q *= n*(n+2);
+    }
+    else {
+      for (size_t k = 1; k < r.size(); ++k) {
+        Q += r[k]*r[k]/(r[0]*r[0]);
+      }
+      Q *= n;
     }
-    Q *= n*(n+2);
 
     typedef boost::math::policies::policy<
           boost::math::policies::promote_float<false>,
@@ -60,11 +65,54 @@ auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lag
     return std::make_pair(Q, pvalue);
 }
 
+}
+
+template<class RandomAccessIterator>
+auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
+    return detail::portmanteau_test(std::execution::seq, begin, end, lags, fit_dof, true);
+}
+
 
 template<class RandomAccessContainer>
 auto ljung_box(RandomAccessContainer const & v, int64_t lags = -1, int64_t fit_dof = 0) {
     return ljung_box(v.begin(), v.end(), lags, fit_dof);
 }
 
+template<class RandomAccessIterator>
+auto box_pierce(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
+    return detail::portmanteau_test(std::execution::seq, begin, end, lags, fit_dof, false);
+}
+
+template<class RandomAccessContainer>
+auto box_pierce(RandomAccessContainer const & v, int64_t lags = -1, int64_t fit_dof = 0) {
+    return box_pierce(v.begin(), v.end(), lags, fit_dof);
+}
+
+// Tests each of the series in [first_series, last_series), writing the (statistic, p-value) pairs to out_first.
+// The series are shared out over threads unless the policy is std::execution::seq.
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+void ljung_box(ExecutionPolicy&& exec, RandomAccessIterator first_series, RandomAccessIterator last_series,
+               RandomAccessOutputIterator out_first, int64_t lags = -1, int64_t fit_dof = 0) {
+    auto count = static_cast<std::size_t>(std::distance(first_series, last_series));
+    detail::parallel_blocks(exec, count, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+          out_first[i] = ljung_box(first_series[i], lags, fit_dof);
+        }
+    });
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, class RandomAccessOutputIterator,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+void box_pierce(ExecutionPolicy&& exec, RandomAccessIterator first_series, RandomAccessIterator last_series,
+                RandomAccessOutputIterator out_first, int64_t lags = -1, int64_t fit_dof = 0) {
+    auto count = static_cast<std::size_t>(std::distance(first_series, last_series));
+    detail::parallel_blocks(exec, count, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+          out_first[i] = box_pierce(first_series[i], lags, fit_dof);
+        }
+    });
+}
+
 }
 #endif
@@ -0,0 +1,467 @@
+//  (C) Copyright Nick Thompson 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_ROLLING_STATISTICS_HPP
+#define BOOST_MATH_STATISTICS_ROLLING_STATISTICS_HPP
+
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <boost/math/statistics/detail/central_moments.hpp>
+#include <boost/math/statistics/detail/sliding_median.hpp>
+
+// Statistics of each window of `window` consecutive samples, written in order to an output iterator:
+// for n samples, the n - window + 1 results for the windows starting at the first, second, . . . sample.
+// Each agrees with the corresponding statistic of univariate_statistics.hpp or bivariate_statistics.hpp applied to the window,
+// but costs O(1) (moments), amortized O(1) (extrema) or O(log window) (median) per sample, rather than O(window).
+// To carry a computation across blocks of a stream, pass each block preceded by the last window - 1 samples of the previous one.
+
+namespace boost::math::statistics {
+
+namespace detail {
+
+template<class ForwardIterator>
+using rolling_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<ForwardIterator>::value_type>,
+                                          double, typename std::iterator_traits<ForwardIterator>::value_type>;
+
+template<class ForwardIterator>
+void check_rolling_window(ForwardIterator first, ForwardIterator last, std::size_t window)
+{
+    if (window == 0)
+    {
+        throw std::domain_error("The window must contain at least one sample.");
+    }
+    if (static_cast<std::size_t>(std::distance(first, last)) < window)
+    {
+        throw std::domain_error("The window must not be longer than the data.");
+    }
+}
+
+// The state of the window is updated by removing the oldest sample and adding the newest.
+// Each removal subtracts quantities of the size of the moments themselves, so the error of the state grows with the number of updates;
+// rebuilding the state from the samples of the window every `window` steps bounds it by the error of `window` updates,
+// at an amortized cost of one more update per sample.
+// A removal which cancels most of the state, such as that of an outlier, leaves it with the absolute error of the state before;
+// State::cancelled() detects this, and the state is then rebuilt at once.
+template<class State, class ForwardIterator, class Push, class Pop, class F, class OutputIterator>
+OutputIterator rolling_updates(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out,
+                               Push push, Pop pop, F f)
+{
+    State state;
+    auto lead = first;
+    for (std::size_t i = 0; i < window; ++i, ++lead)
+    {
+        push(state, lead);
+    }
+    *out++ = f(state);
+    std::size_t updates = 0;
+    for (auto trail = first; lead != last; ++lead)
+    {
+        auto oldest = trail++;
+        bool rebuild = (++updates == window);
+        if (!rebuild)
+        {
+            pop(state, oldest);
+            push(state, lead);
+            rebuild = state.cancelled();
+        }
+        if (rebuild)
+        {
+            updates = 0;
+            state = State();
+            auto end = lead;
+            ++end;
+            for (auto it = trail; it != end; ++it)
+            {
+                push(state, it);
+            }
+        }
+        *out++ = f(state);
+    }
+    return out;
+}
+
+// The moments of the deviations from a shift, the first sample pushed since the last rebuild, which is close to the window;
+// otherwise removing a sample from data with a large mean would cancel the digits of the mean, rather than of the deviations.
+template<class Real, int Order>
+struct shifted_central_moments
+{
+    Real shift = 0;
+    central_moments<Real, Order> moments;
+    Real peak_M1 = 0;
+    Real peak_M2 = 0;
+
+    void push(Real x)
+    {
+        if (moments.n == 0)
+        {
+            shift = x;
+        }
+        moments.push(x - shift);
+        if constexpr (Order >= 2)
+        {
+            peak_M2 = (std::max)(peak_M2, moments.M2);
+        }
+        else
+        {
+            peak_M1 = (std::max)(peak_M1, std::abs(moments.M1));
+        }
+    }
+
+    void pop(Real x)
+    {
+        moments.pop(x - shift);
+        if constexpr (Order < 2)
+        {
+            // Unlike M2, the mean can grow on removal:
+            peak_M1 = (std::max)(peak_M1, std::abs(moments.M1));
+        }
+    }
+
+    Real mean() const
+    {
+        return shift + moments.M1;
+    }
+
+    // The removals leave M2 with an error of about n eps times its largest value since the rebuild,
+    // so once it has fallen well below that, the state is rebuilt; a constant window then has M2 exactly zero.
+    // Without M2, the same holds for the mean of the deviations, M1, which a departing outlier leaves behind.
+    bool cancelled() const
+    {
+        if constexpr (Order >= 2)
+        {
+            return !(64*moments.M2 >= peak_M2);
+        }
+        else
+        {
+            return !(64*std::abs(moments.M1) >= peak_M1);
+        }
+    }
+};
+
+template<class Real, int Order, class ForwardIterator, class OutputIterator, class F>
+OutputIterator rolling_central_moments(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out, F f)
+{
+    check_rolling_window(first, last, window);
+    using state = shifted_central_moments<Real, Order>;
+    return rolling_updates<state>(first, last, window, out,
+        [](state & s, ForwardIterator it) { s.push(static_cast<Real>(*it)); },
+        [](state & s, ForwardIterator it) { s.pop(static_cast<Real>(*it)); },
+        f);
+}
+
+// The means and sums of products of deviations of two samples, as in means_and_covariance and correlation_coefficient,
+// with the same removal of a sample as central_moments::pop, and the same shift as shifted_central_moments.
+template<class Real>
+struct comoments
+{
+    Real shift_u = 0;
+    Real shift_v = 0;
+    Real n = 0;
+    Real mu_u = 0;
+    Real mu_v = 0;
+    Real Qu = 0;
+    Real Qv = 0;
+    Real C = 0;
+    Real peak_Qu = 0;
+    Real peak_Qv = 0;
+
+    void push(Real u, Real v)
+    {
+        if (n == 0)
+        {
+            shift_u = u;
+            shift_v = v;
+        }
+        u -= shift_u;
+        v -= shift_v;
+        n += 1;
+        Real du = u - mu_u;
+        Real dv = v - mu_v;
+        mu_u += du/n;
+        mu_v += dv/n;
+        Qu += du*(u - mu_u);
+        Qv += dv*(v - mu_v);
+        C += du*(v - mu_v);
+        peak_Qu = (std::max)(peak_Qu, Qu);
+        peak_Qv = (std::max)(peak_Qv, Qv);
+    }
+
+    void pop(Real u, Real v)
+    {
+        if (n <= 1)
+        {
+            *this = comoments();
+            return;
+        }
+        u -= shift_u;
+        v -= shift_v;
+        Real na = n - 1;
+        Real mu_ua = mu_u - (u - mu_u)/na;
+        Real mu_va = mu_v - (v - mu_v)/na;
+        Qu -= (u - mu_ua)*(u - mu_u);
+        Qv -= (v - mu_va)*(v - mu_v);
+        C -= (u - mu_ua)*(v - mu_v);
+        mu_u = mu_ua;
+        mu_v = mu_va;
+        n = na;
+    }
+
+    // As shifted_central_moments::cancelled; C is bounded by sqrt(Qu Qv), so it needs no check of its own:
+    bool cancelled() const
+    {
+        return !(64*Qu >= peak_Qu) || !(64*Qv >= peak_Qv);
+    }
+};
+
+template<class Real, class ForwardIterator1, class ForwardIterator2, class OutputIterator, class F>
+OutputIterator rolling_comoments(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, std::size_t window,
+                                 OutputIterator out, F f)
+{
+    check_rolling_window(first1, last1, window);
+    // Walk both ranges together through an iterator over the first which remembers its offset into the second:
+    using pair_iterator = std::pair<ForwardIterator1, ForwardIterator2>;
+    struct zip
+    {
+        pair_iterator it;
+        zip& operator++() { ++it.first; ++it.second; return *this; }
+        zip operator++(int) { zip z = *this; ++*this; return z; }
+        bool operator!=(zip const & other) const { return it.first != other.it.first; }
+    };
+    zip first{pair_iterator(first1, first2)};
+    zip last{pair_iterator(last1, first2)};
+    return rolling_updates<comoments<Real>>(first, last, window, out,
+        [](comoments<Real> & s, zip z) { s.push(static_cast<Real>(*z.it.first), static_cast<Real>(*z.it.second)); },
+        [](comoments<Real> & s, zip z) { s.pop(static_cast<Real>(*z.it.first), static_cast<Real>(*z.it.second)); },
+        f);
+}
+
+// A monotonic deque: the candidates for the extremum of the window, in order of arrival,
+// each preferred by comp to all those which arrived before it. Each sample is pushed and popped at most once.
+template<class ForwardIterator, class OutputIterator, class Compare>
+OutputIterator rolling_extremum(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out, Compare comp)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    check_rolling_window(first, last, window);
+    std::deque<std::pair<T, std::size_t>> candidates;
+    std::size_t i = 0;
+    for (auto it = first; it != last; ++it, ++i)
+    {
+        T x = *it;
+        while (!candidates.empty() && !comp(candidates.back().first, x))
+        {
+            candidates.pop_back();
+        }
+        candidates.emplace_back(x, i);
+        if (candidates.front().second + window <= i)
+        {
+            candidates.pop_front();
+        }
+        if (i + 1 >= window)
+        {
+            *out++ = candidates.front().first;
+        }
+    }
+    return out;
+}
+
+}
+
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_mean(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator>;
+    return detail::rolling_central_moments<Real, 1>(first, last, window, out,
+        [](detail::shifted_central_moments<Real, 1> const & s) { return s.mean(); });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_mean(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_mean(v.cbegin(), v.cend(), window, out);
+}
+
+// The population variance of each window, as variance().
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_variance(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator>;
+    return detail::rolling_central_moments<Real, 2>(first, last, window, out,
+        [](detail::shifted_central_moments<Real, 2> const & s) { return s.moments.M2/s.moments.n; });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_variance(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_variance(v.cbegin(), v.cend(), window, out);
+}
+
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_sample_variance(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator>;
+    if (window < 2)
+    {
+        throw std::domain_error("At least two samples are required to compute the sample variance.");
+    }
+    return detail::rolling_central_moments<Real, 2>(first, last, window, out,
+        [](detail::shifted_central_moments<Real, 2> const & s) { return s.moments.M2/(s.moments.n - 1); });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_sample_variance(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_sample_variance(v.cbegin(), v.cend(), window, out);
+}
+
+// The skewness of each window, as skewness(); zero for a constant window.
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_skewness(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator>;
+    return detail::rolling_central_moments<Real, 3>(first, last, window, out,
+        [](detail::shifted_central_moments<Real, 3> const & s) {
+            using std::sqrt;
+            Real M2 = s.moments.M2;
+            if (M2 == 0)
+            {
+                return Real(0);
+            }
+            return s.moments.M3/(M2*sqrt(M2/s.moments.n));
+        });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_skewness(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_skewness(v.cbegin(), v.cend(), window, out);
+}
+
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_min(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    return detail::rolling_extremum(first, last, window, out, std::less<T>());
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_min(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_min(v.cbegin(), v.cend(), window, out);
+}
+
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_max(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    return detail::rolling_extremum(first, last, window, out, std::greater<T>());
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_max(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_max(v.cbegin(), v.cend(), window, out);
+}
+
+// The median of each window, as median(): the middle element, or the mean of the two middle elements.
+template<class ForwardIterator, class OutputIterator>
+OutputIterator rolling_median(ForwardIterator first, ForwardIterator last, std::size_t window, OutputIterator out)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    detail::check_rolling_window(first, last, window);
+    detail::sliding_median<T> m;
+    auto trail = first;
+    std::size_t i = 0;
+    for (auto it = first; it != last; ++it, ++i)
+    {
+        m.insert(*it, i);
+        if (i >= window)
+        {
+            m.erase(*trail, i - window);
+            ++trail;
+        }
+        if (i + 1 >= window)
+        {
+            *out++ = m.median();
+        }
+    }
+    return out;
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_median(Container const & v, std::size_t window, OutputIterator out)
+{
+    return rolling_median(v.cbegin(), v.cend(), window, out);
+}
+
+// The population covariance of each pair of windows of u = [first1, last1) and v = [first2, ...), as covariance().
+template<class ForwardIterator1, class ForwardIterator2, class OutputIterator>
+OutputIterator rolling_covariance(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator1>;
+    return detail::rolling_comoments<Real>(first1, last1, first2, window, out,
+        [](detail::comoments<Real> const & s) { return s.C/s.n; });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_covariance(Container const & u, Container const & v, std::size_t window, OutputIterator out)
+{
+    if (u.size() != v.size())
+    {
+        throw std::domain_error("The size of each vector must be the same to compute covariance.");
+    }
+    return rolling_covariance(u.cbegin(), u.cend(), v.cbegin(), window, out);
+}
+
+// The Pearson correlation coefficient of each pair of windows, as correlation_coefficient():
+// 1 if both windows are constant, 0 if one is, and clamped to [-1, 1].
+template<class ForwardIterator1, class ForwardIterator2, class OutputIterator>
+OutputIterator rolling_correlation_coefficient(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_real_t<ForwardIterator1>;
+    return detail::rolling_comoments<Real>(first1, last1, first2, window, out,
+        [](detail::comoments<Real> const & s) {
+            using std::sqrt;
+            bool u_constant = (s.Qu == 0);
+            bool v_constant = (s.Qv == 0);
+            if (u_constant && v_constant)
+            {
+                return Real(1);
+            }
+            if (u_constant || v_constant)
+            {
+                return Real(0);
+            }
+            Real rho = s.C/sqrt(s.Qu*s.Qv);
+            if (rho > 1)
+            {
+                rho = 1;
+            }
+            if (rho < -1)
+            {
+                rho = -1;
+            }
+            return rho;
+        });
+}
+
+template<class Container, class OutputIterator>
+inline OutputIterator rolling_correlation_coefficient(Container const & u, Container const & v, std::size_t window, OutputIterator out)
+{
+    if (u.size() != v.size())
+    {
+        throw std::domain_error("The size of each vector must be the same to compute the correlation coefficient.");
+    }
+    return rolling_correlation_coefficient(u.cbegin(), u.cend(), v.cbegin(), window, out);
+}
+
+}
+#endif
@@ -10,27 +10,71 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <set>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 #include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/sliding_median.hpp>
 #include <boost/math/distributions/normal.hpp>
 
 namespace boost::math::statistics {
 
+namespace detail {
+
+// The statistic and p-value of the runs test, given the number of runs and the numbers of values above and below the threshold.
+template<class Real, class Size>
+std::pair<Real, Real> runs_test_statistic(Size runs, Size nabove, Size nbelow)
+{
+    using std::sqrt;
+    using std::abs;
+    typedef boost::math::policies::policy<
+          boost::math::policies::promote_float<false>,
+          boost::math::policies::promote_double<false> >
+          no_promote_policy;
+
+    // If you make n an int, the subtraction is gonna be bad in the variance:
+    Real n = nabove + nbelow;
+
+    Real expected_runs = Real(1) + Real(2*nabove*nbelow)/Real(n);
+    Real variance = 2*nabove*nbelow*(2*nabove*nbelow-n)/Real(n*n*(n-1));
+
+    // Bizarre, pathological limits:
+    if (variance == 0)
+    {
+        if (runs == expected_runs)
+        {
+            Real statistic = 0;
+            Real pvalue = 1;
+            return std::make_pair(statistic, pvalue);
+        }
+        else
+        {
+            return std::make_pair(std::numeric_limits<Real>::quiet_NaN(), Real(0));
+        }
+    }
+
+    Real sd = sqrt(variance);
+    Real statistic = (runs - expected_runs)/sd;
+
+    auto normal = boost::math::normal_distribution<Real, no_promote_policy>(0,1);
+    Real pvalue = 2*boost::math::cdf(normal, -abs(statistic));
+    return std::make_pair(statistic, pvalue);
+}
+
+}
+
 template<class RandomAccessContainer>
 auto runs_above_and_below_threshold(RandomAccessContainer const & v,
                           typename RandomAccessContainer::value_type threshold)
 {
     using Real = typename RandomAccessContainer::value_type;
-    using std::sqrt;
-    using std::abs;
     if (v.size() <= 1)
     {
         throw std::domain_error("At least 2 samples are required to get number of runs.");
     }
-    typedef boost::math::policies::policy<
-          boost::math::policies::promote_float<false>,
-          boost::math::policies::promote_double<false> >
-          no_promote_policy;
 
     decltype(v.size()) nabove = 0;
     decltype(v.size()) nbelow = 0;
@@ -74,47 +118,192 @@ auto runs_above_and_below_threshold(RandomAccessContainer const & v,
       }
     }
 
-    // If you make n an int, the subtraction is gonna be bad in the variance:
-    Real n = nabove + nbelow;
+    return detail::runs_test_statistic<Real>(runs, nabove, nbelow);
+}
 
-    Real expected_runs = Real(1) + Real(2*nabove*nbelow)/Real(n);
-    Real variance = 2*nabove*nbelow*(2*nabove*nbelow-n)/Real(n*n*(n-1));
+template<class RandomAccessContainer>
+auto runs_above_and_below_median(RandomAccessContainer const & v)
+{
+    using Real = typename RandomAccessContainer::value_type;
+    using std::log;
+    using std::sqrt;
 
-    // Bizarre, pathological limits:
-    if (variance == 0)
+    // We have to memcpy v because the median does a partial sort,
+    // and that would be catastrophic for the runs test.
+    auto w = v;
+    Real median = boost::math::statistics::median(w);
+    return runs_above_and_below_threshold(v, median);
+}
+
+// The runs test above and below the median of the last `window` samples of a stream, updated as each sample arrives.
+// The median is kept by detail::sliding_median, and the runs by the set of
+// positions of the samples which differ from the median, so that a push costs O(log w) operations, plus O(log w) for each
+// sample whose side of the median changes as the median moves; without ties, that is at most two.
+template<class Real>
+class streaming_runs_above_and_below_median
+{
+public:
+    explicit streaming_runs_above_and_below_median(std::size_t window) : window_{window}, values_(window), sides_(window)
     {
-        if (runs == expected_runs)
+        if (window <= 1)
         {
-            Real statistic = 0;
-            Real pvalue = 1;
-            return std::make_pair(statistic, pvalue);
+            throw std::domain_error("At least 2 samples are required to get number of runs.");
         }
-        else
+    }
+
+    // Adds x to the window, evicting the oldest sample once the window is full.
+    void push(Real x)
+    {
+        using std::isnan;
+        if (isnan(x))
+        {
+            throw std::domain_error("The runs test is undefined for NaN samples.");
+        }
+        if (pushed_ >= window_)
+        {
+            evict(pushed_ - window_);
+        }
+        std::size_t i = pushed_;
+        values_[i % window_] = x;
+        window_median_.insert(x, i);
+        Real m = window_median_.median();
+        // Only the samples between the old and the new median change sides:
+        if (i > 0 && m != median_)
+        {
+            Real lo = (std::min)(m, median_);
+            Real hi = (std::max)(m, median_);
+            median_ = m;
+            window_median_.for_each_between(lo, hi, [&](Real y, std::size_t j) {
+                if (j != i)
+                {
+                    set_side(j, side(y));
+                }
+            });
+        }
+        median_ = m;
+        set_side(i, side(x));
+        ++pushed_;
+    }
+
+    // The number of samples in the window.
+    std::size_t size() const
+    {
+        return window_median_.size();
+    }
+
+    Real median() const
+    {
+        return median_;
+    }
+
+    // The test statistic and p-value of runs_above_and_below_median over the samples in the window.
+    std::pair<Real, Real> statistic_and_p_value() const
+    {
+        if (size() <= 1)
+        {
+            throw std::domain_error("At least 2 samples are required to get number of runs.");
+        }
+        if (differing_.empty())
         {
             return std::make_pair(std::numeric_limits<Real>::quiet_NaN(), Real(0));
         }
+        return detail::runs_test_statistic<Real>(changes_ + 1, nabove_, nbelow_);
     }
 
-    Real sd = sqrt(variance);
-    Real statistic = (runs - expected_runs)/sd;
+private:
+    signed char side(Real x) const
+    {
+        return x > median_ ? 1 : (x < median_ ? -1 : 0);
+    }
 
-    auto normal = boost::math::normal_distribution<Real, no_promote_policy>(0,1);
-    Real pvalue = 2*boost::math::cdf(normal, -abs(statistic));
-    return std::make_pair(statistic, pvalue);
-}
+    void evict(std::size_t i)
+    {
+        set_side(i, 0);
+        window_median_.erase(values_[i % window_], i);
+    }
 
+    // Moves sample i to side s, keeping the count of changes of side between consecutive samples which differ from the median.
+    void set_side(std::size_t i, signed char s)
+    {
+        signed char & current = sides_[i % window_];
+        if (current == s)
+        {
+            return;
+        }
+        if (current != 0)
+        {
+            auto it = differing_.find(i);
+            update_neighbours(it, -1);
+            differing_.erase(it);
+            (current > 0 ? nabove_ : nbelow_) -= 1;
+        }
+        current = s;
+        if (s != 0)
+        {
+            auto it = differing_.insert(i).first;
+            update_neighbours(it, 1);
+            (s > 0 ? nabove_ : nbelow_) += 1;
+        }
+    }
+
+    // Adds (sign = 1) or removes (sign = -1) the contribution of the sample at it to the number of changes of side.
+    void update_neighbours(std::set<std::size_t>::iterator it, int sign)
+    {
+        signed char s = sides_[*it % window_];
+        bool has_prev = it != differing_.begin();
+        auto next = std::next(it);
+        bool has_next = next != differing_.end();
+        signed char p = has_prev ? sides_[*std::prev(it) % window_] : 0;
+        signed char q = has_next ? sides_[*next % window_] : 0;
+        std::ptrdiff_t delta = 0;
+        if (has_prev && has_next)
+        {
+            delta -= (p != q);
+        }
+        if (has_prev)
+        {
+            delta += (p != s);
+        }
+        if (has_next)
+        {
+            delta += (s != q);
+        }
+        changes_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(changes_) + sign*delta);
+    }
+
+    std::size_t window_;
+    std::size_t pushed_ = 0;
+    std::vector<Real> values_;
+    std::vector<signed char> sides_;
+    detail::sliding_median<Real> window_median_;
+    std::set<std::size_t> differing_;
+    std::size_t nabove_ = 0;
+    std::size_t nbelow_ = 0;
+    std::size_t changes_ = 0;
+    Real median_ = 0;
+};
+
+// The statistic and p-value of runs_above_and_below_median over each window v[k], ..., v[k + window - 1], k = 0, ..., v.size() - window.
 template<class RandomAccessContainer>
-auto runs_above_and_below_median(RandomAccessContainer const & v)
+auto sliding_runs_above_and_below_median(RandomAccessContainer const & v, std::size_t window)
 {
     using Real = typename RandomAccessContainer::value_type;
-    using std::log;
-    using std::sqrt;
-
-    // We have to memcpy v because the median does a partial sort,
-    // and that would be catastrophic for the runs test.
-    auto w = v;
-    Real median = boost::math::statistics::median(w);
-    return runs_above_and_below_threshold(v, median);
+    if (window > v.size())
+    {
+        throw std::domain_error("The window must not be longer than the data.");
+    }
+    streaming_runs_above_and_below_median<Real> runs(window);
+    std::vector<std::pair<Real, Real>> results;
+    results.reserve(v.size() - window + 1);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        runs.push(v[i]);
+        if (i + 1 >= window)
+        {
+            results.push_back(runs.statistic_and_p_value());
+        }
+    }
+    return results;
 }
 
 }
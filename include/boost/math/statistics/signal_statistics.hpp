@@ -65,6 +65,37 @@ inline auto sample_absolute_gini_coefficient(RandomAccessContainer & v)
     return boost::math::statistics::sample_absolute_gini_coefficient(v.begin(), v.end());
 }
 
+// As the execution policy overloads of gini_coefficient, these do not modify the data,
+// and sort the absolute values with a parallel radix sort when they are 32 or 64 bit integers or IEEE floats.
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using std::abs;
+    using Abs = decltype(abs(*first));
+    using Real = std::conditional_t<std::is_integral_v<Abs>, double, Abs>;
+    BOOST_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+    return detail::sorted_gini<Real>(exec, first, last, [](auto const & x) { using std::abs; return abs(x); });
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return boost::math::statistics::absolute_gini_coefficient(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto sample_absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    size_t n = std::distance(first, last);
+    return n*boost::math::statistics::absolute_gini_coefficient(exec, first, last)/(n-1);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto sample_absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return boost::math::statistics::sample_absolute_gini_coefficient(exec, v.cbegin(), v.cend());
+}
+
 
 // The Hoyer sparsity measure is defined in:
 // https://arxiv.org/pdf/0811.4706.pdf
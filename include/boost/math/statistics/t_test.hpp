@@ -6,32 +6,93 @@
 #ifndef BOOST_MATH_STATISTICS_T_TEST_HPP
 #define BOOST_MATH_STATISTICS_T_TEST_HPP
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <boost/math/distributions/students_t.hpp>
 #include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/parallel_blocks.hpp>
 
 namespace boost::math::statistics {
 
+namespace detail {
+
+// The two sided p-value of the t-statistic t with dof degrees of freedom.
 template<typename Real>
-std::pair<Real, Real> one_sample_t_test(Real sample_mean, Real sample_variance, Real num_samples, Real assumed_mean) {
-    using std::sqrt;
+Real two_sided_t_test_p_value(Real test_statistic, Real dof) {
     typedef boost::math::policies::policy<
           boost::math::policies::promote_float<false>,
           boost::math::policies::promote_double<false> >
           no_promote_policy;
 
-    Real test_statistic = (sample_mean - assumed_mean)/sqrt(sample_variance/num_samples);
-    auto student = boost::math::students_t_distribution<Real, no_promote_policy>(num_samples - 1);
-    Real pvalue;
+    auto student = boost::math::students_t_distribution<Real, no_promote_policy>(dof);
     if (test_statistic > 0) {
-        pvalue = 2*boost::math::cdf<Real>(student, -test_statistic);;
+        return 2*boost::math::cdf<Real>(student, -test_statistic);
     }
-    else {
-        pvalue = 2*boost::math::cdf<Real>(student, test_statistic);
-    }
-    return std::make_pair(test_statistic, pvalue);
+    return 2*boost::math::cdf<Real>(student, test_statistic);
+}
+
+template<typename Real>
+std::pair<Real, Real> two_sample_t_test_impl(Real mean_1, Real variance_1, Real size_1, Real mean_2, Real variance_2, Real size_2) {
+    using std::sqrt;
+    Real dof = size_1 + size_2 - 2;
+    Real pooled_variance = ((size_1 - 1)*variance_1 + (size_2 - 1)*variance_2)/dof;
+    Real test_statistic = (mean_1 - mean_2)/sqrt(pooled_variance*(1/size_1 + 1/size_2));
+    return std::make_pair(test_statistic, two_sided_t_test_p_value(test_statistic, dof));
+}
+
+// The Welch-Satterthwaite approximation to the degrees of freedom.
+template<typename Real>
+std::pair<Real, Real> welch_t_test_impl(Real mean_1, Real variance_1, Real size_1, Real mean_2, Real variance_2, Real size_2) {
+    using std::sqrt;
+    Real se_sq_1 = variance_1/size_1;
+    Real se_sq_2 = variance_2/size_2;
+    Real se_sq = se_sq_1 + se_sq_2;
+    Real dof = se_sq*se_sq/(se_sq_1*se_sq_1/(size_1 - 1) + se_sq_2*se_sq_2/(size_2 - 1));
+    Real test_statistic = (mean_1 - mean_2)/sqrt(se_sq);
+    return std::make_pair(test_statistic, two_sided_t_test_p_value(test_statistic, dof));
+}
+
+template<class ForwardIterator>
+using t_test_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<ForwardIterator>::value_type>,
+                                         double, typename std::iterator_traits<ForwardIterator>::value_type>;
+
+// Rows of a grouped dataset in each chunk of grouped_mean_and_sample_variance, when the groups are few.
+inline constexpr std::size_t grouped_statistics_chunk_size = 8192;
+
+// Runs a test on each (i, j) pair of group indices in [first_comparison, last_comparison), writing the (statistic, p-value) pairs to out_first.
+template<class ExecutionPolicy, class SummaryContainer, class RandomAccessIterator, class RandomAccessOutputIterator, class Test>
+void batched_two_sample_tests(ExecutionPolicy&& exec, SummaryContainer const & groups, RandomAccessIterator first_comparison,
+                              RandomAccessIterator last_comparison, RandomAccessOutputIterator out_first, Test test) {
+    auto count = static_cast<std::size_t>(std::distance(first_comparison, last_comparison));
+    // Each p-value is an incomplete beta function evaluation of a few hundred nanoseconds, so give each thread runs of comparisons:
+    parallel_blocks(exec, count, 256, [&](std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            auto const & [i, j] = first_comparison[k];
+            if (static_cast<std::size_t>(i) >= groups.size() || static_cast<std::size_t>(j) >= groups.size()) {
+                throw std::domain_error("Comparisons must be between groups of the dataset.");
+            }
+            auto const & [mean_1, variance_1, size_1] = groups[i];
+            auto const & [mean_2, variance_2, size_2] = groups[j];
+            out_first[k] = test(mean_1, variance_1, size_1, mean_2, variance_2, size_2);
+        }
+    });
+}
+
+}
+
+template<typename Real>
+std::pair<Real, Real> one_sample_t_test(Real sample_mean, Real sample_variance, Real num_samples, Real assumed_mean) {
+    using std::sqrt;
+    Real test_statistic = (sample_mean - assumed_mean)/sqrt(sample_variance/num_samples);
+    return std::make_pair(test_statistic, detail::two_sided_t_test_p_value(test_statistic, num_samples - 1));
 }
 
 template<class ForwardIterator>
@@ -46,5 +107,165 @@ auto one_sample_t_test(Container const & v, typename Container::value_type assum
     return one_sample_t_test(v.begin(), v.end(), assumed_mean);
 }
 
+// Tests whether the means of two independent samples differ, assuming that their variances are equal.
+template<typename Real>
+std::pair<Real, Real> two_sample_t_test(Real mean_1, Real variance_1, Real size_1, Real mean_2, Real variance_2, Real size_2) {
+    return detail::two_sample_t_test_impl(mean_1, variance_1, size_1, mean_2, variance_2, size_2);
+}
+
+template<class ForwardIterator>
+auto two_sample_t_test(ForwardIterator begin_1, ForwardIterator end_1, ForwardIterator begin_2, ForwardIterator end_2) {
+    using Real = detail::t_test_real_t<ForwardIterator>;
+    auto [mu_1, s_sq_1] = mean_and_sample_variance(begin_1, end_1);
+    auto [mu_2, s_sq_2] = mean_and_sample_variance(begin_2, end_2);
+    return detail::two_sample_t_test_impl<Real>(mu_1, s_sq_1, Real(std::distance(begin_1, end_1)), mu_2, s_sq_2, Real(std::distance(begin_2, end_2)));
+}
+
+template<class Container>
+auto two_sample_t_test(Container const & u, Container const & v) {
+    return two_sample_t_test(u.begin(), u.end(), v.begin(), v.end());
+}
+
+// Tests whether the means of two independent samples differ, without assuming that their variances are equal.
+template<typename Real>
+std::pair<Real, Real> welch_t_test(Real mean_1, Real variance_1, Real size_1, Real mean_2, Real variance_2, Real size_2) {
+    return detail::welch_t_test_impl(mean_1, variance_1, size_1, mean_2, variance_2, size_2);
+}
+
+template<class ForwardIterator>
+auto welch_t_test(ForwardIterator begin_1, ForwardIterator end_1, ForwardIterator begin_2, ForwardIterator end_2) {
+    using Real = detail::t_test_real_t<ForwardIterator>;
+    auto [mu_1, s_sq_1] = mean_and_sample_variance(begin_1, end_1);
+    auto [mu_2, s_sq_2] = mean_and_sample_variance(begin_2, end_2);
+    return detail::welch_t_test_impl<Real>(mu_1, s_sq_1, Real(std::distance(begin_1, end_1)), mu_2, s_sq_2, Real(std::distance(begin_2, end_2)));
+}
+
+template<class Container>
+auto welch_t_test(Container const & u, Container const & v) {
+    return welch_t_test(u.begin(), u.end(), v.begin(), v.end());
+}
+
+// Tests whether the mean of the differences u[i] - v[i] of paired observations is zero.
+// The differences are accumulated in the same single pass as mean_and_sample_variance, without being stored.
+template<class Container>
+auto paired_samples_t_test(Container const & u, Container const & v) {
+    using Real = detail::t_test_real_t<decltype(u.begin())>;
+    if (u.size() != v.size()) {
+        throw std::domain_error("Paired samples must be of the same size.");
+    }
+    if (u.size() <= 1) {
+        throw std::domain_error("At least 2 pairs are required for a paired samples t-test.");
+    }
+    auto it_u = u.begin();
+    auto it_v = v.begin();
+    // Higham, Accuracy and Stability, equation 1.6a and 1.6b:
+    Real M = static_cast<Real>(*it_u++) - static_cast<Real>(*it_v++);
+    Real Q = 0;
+    Real k = 2;
+    for (; it_u != u.end(); ++it_u, ++it_v) {
+        Real tmp = static_cast<Real>(*it_u) - static_cast<Real>(*it_v) - M;
+        Q = Q + ((k-1)*tmp*tmp)/k;
+        M = M + tmp/k;
+        k += 1;
+    }
+    return one_sample_t_test(M, Q/(k-2), Real(u.size()), Real(0));
+}
+
+// The mean, sample variance and size of each group of a grouped dataset, in a single pass over the data:
+// values[i] belongs to group labels[i], which must lie in [0, groups).
+// Returns one (mean, sample variance, size) tuple for each group, as the batched two sample tests below consume them;
+// the mean and variance of an empty group, and the variance of a group of one, are NaN.
+// The dataset is cut into fixed chunks, each summarized by Welford's updates on a thread of its own unless the policy is std::execution::seq,
+// and the summaries of the chunks are merged in order, so that every policy gives the same result.
+template<class ExecutionPolicy, class RandomAccessContainer, class LabelContainer,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto grouped_mean_and_sample_variance(ExecutionPolicy&& exec, RandomAccessContainer const & values, LabelContainer const & labels, std::size_t groups) {
+    using Real = detail::t_test_real_t<decltype(values.begin())>;
+    std::size_t n = values.size();
+    if (labels.size() != n) {
+        throw std::domain_error("Each value must have a group label.");
+    }
+    // Each chunk holds a summary of every group, so the chunks must be large when there are many groups:
+    std::size_t chunk_size = (std::max)(detail::grouped_statistics_chunk_size, 16*groups);
+    std::size_t chunks = (std::max)(std::size_t(1), (n + chunk_size - 1)/chunk_size);
+    std::vector<Real> count(chunks*groups, Real(0));
+    std::vector<Real> mean(chunks*groups, Real(0));
+    std::vector<Real> M2(chunks*groups, Real(0));
+    detail::parallel_blocks(exec, chunks, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t c = b; c < e; ++c) {
+            Real* k = count.data() + c*groups;
+            Real* mu = mean.data() + c*groups;
+            Real* q = M2.data() + c*groups;
+            for (std::size_t i = c*chunk_size; i < (std::min)(n, (c + 1)*chunk_size); ++i) {
+                auto g = labels[i];
+                // A negative label is converted to a huge index, and so is rejected too:
+                if (static_cast<std::size_t>(g) >= groups) {
+                    throw std::domain_error("Group labels must lie in [0, groups).");
+                }
+                Real x = static_cast<Real>(values[i]);
+                k[g] += 1;
+                Real delta = x - mu[g];
+                mu[g] += delta/k[g];
+                q[g] += delta*(x - mu[g]);
+            }
+        }
+    });
+    std::vector<std::tuple<Real, Real, Real>> summaries(groups);
+    for (std::size_t g = 0; g < groups; ++g) {
+        // Chan, Golub and LeVeque's pairwise update:
+        Real k = count[g];
+        Real mu = mean[g];
+        Real q = M2[g];
+        for (std::size_t c = 1; c < chunks; ++c) {
+            Real k_c = count[c*groups + g];
+            if (k_c == 0) {
+                continue;
+            }
+            Real delta = mean[c*groups + g] - mu;
+            Real total = k + k_c;
+            mu += delta*k_c/total;
+            q += M2[c*groups + g] + delta*delta*k*k_c/total;
+            k = total;
+        }
+        Real nan = std::numeric_limits<Real>::quiet_NaN();
+        summaries[g] = std::make_tuple(k > 0 ? mu : nan, k > 1 ? q/(k - 1) : nan, k);
+    }
+    return summaries;
+}
+
+template<class RandomAccessContainer, class LabelContainer>
+auto grouped_mean_and_sample_variance(RandomAccessContainer const & values, LabelContainer const & labels, std::size_t groups) {
+    return grouped_mean_and_sample_variance(std::execution::seq, values, labels, groups);
+}
+
+// Two sample t-tests of many pairs of groups at once.
+// groups holds a (mean, sample variance, size) tuple for each group, such as grouped_mean_and_sample_variance returns,
+// and each comparison is a pair (i, j) of indices into groups; the (statistic, p-value) pair of each comparison is written to out_first.
+// The comparisons are shared out over threads unless the policy is std::execution::seq.
+template<class ExecutionPolicy, class SummaryContainer, class RandomAccessIterator, class RandomAccessOutputIterator,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+void two_sample_t_test(ExecutionPolicy&& exec, SummaryContainer const & groups, RandomAccessIterator first_comparison,
+                       RandomAccessIterator last_comparison, RandomAccessOutputIterator out_first) {
+    using Real = std::tuple_element_t<0, typename SummaryContainer::value_type>;
+    detail::batched_two_sample_tests(exec, groups, first_comparison, last_comparison, out_first, &detail::two_sample_t_test_impl<Real>);
+}
+
+template<class ExecutionPolicy, class SummaryContainer, class RandomAccessIterator, class RandomAccessOutputIterator,
+         std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+void welch_t_test(ExecutionPolicy&& exec, SummaryContainer const & groups, RandomAccessIterator first_comparison,
+                  RandomAccessIterator last_comparison, RandomAccessOutputIterator out_first) {
+    using Real = std::tuple_element_t<0, typename SummaryContainer::value_type>;
+    detail::batched_two_sample_tests(exec, groups, first_comparison, last_comparison, out_first, &detail::welch_t_test_impl<Real>);
+}
+
+// Tests whether a parameter estimated with the given standard error, from a fit with the given residual degrees of freedom,
+// differs from assumed_value; for example a coefficient of a least_squares_fit from linear_regression.hpp.
+// Returns the t-statistic and the two sided p-value.
+template<typename Real>
+std::pair<Real, Real> coefficient_t_test(Real estimate, Real standard_error, Real degrees_of_freedom, Real assumed_value = 0) {
+    Real test_statistic = (estimate - assumed_value)/standard_error;
+    return std::make_pair(test_statistic, detail::two_sided_t_test_p_value(test_statistic, degrees_of_freedom));
+}
+
 }
 #endif
@@ -9,8 +9,16 @@
 #include <algorithm>
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <execution>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 #include <boost/assert.hpp>
+#include <boost/math/statistics/detail/central_moments.hpp>
+#include <boost/math/statistics/detail/bucket_select.hpp>
+#include <boost/math/statistics/detail/radix_sort.hpp>
 
 namespace boost::math::statistics {
 
@@ -335,6 +343,145 @@ inline auto excess_kurtosis(Container const & v)
     return excess_kurtosis(v.cbegin(), v.cend());
 }
 
+// Execution policy overloads of the moments.
+// The range is split into fixed size chunks whose moments are merged pairwise (Chan, Golub and LeVeque; Pébay),
+// so the result does not depend on the number of threads, and is the same under seq as under par.
+namespace detail {
+
+template<class ExecutionPolicy>
+inline constexpr bool is_execution_policy_v = std::is_execution_policy_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>>;
+
+template<class ForwardIterator>
+using moment_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<ForwardIterator>::value_type>,
+                                         double, typename std::iterator_traits<ForwardIterator>::value_type>;
+
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto mean(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute the mean.");
+    return detail::chunked_central_moments<Real, 1>(exec, first, last).M1;
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto mean(ExecutionPolicy&& exec, Container const & v)
+{
+    return mean(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute mean and variance.");
+    auto m = detail::chunked_central_moments<Real, 2>(exec, first, last);
+    return m.M2/m.n;
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto variance(ExecutionPolicy&& exec, Container const & v)
+{
+    return variance(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto sample_variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    auto m = detail::chunked_central_moments<Real, 2>(exec, first, last);
+    BOOST_ASSERT_MSG(m.n > 1, "At least two samples are required to compute the sample variance.");
+    return m.M2/(m.n-1);
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto sample_variance(ExecutionPolicy&& exec, Container const & v)
+{
+    return sample_variance(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto mean_and_sample_variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute mean and variance.");
+    auto m = detail::chunked_central_moments<Real, 2>(exec, first, last);
+    return std::pair<Real, Real>{m.M1, m.M2/(m.n-1)};
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto mean_and_sample_variance(ExecutionPolicy&& exec, Container const & v)
+{
+    return mean_and_sample_variance(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto skewness(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    using std::sqrt;
+    BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute skewness.");
+    auto m = detail::chunked_central_moments<Real, 3>(exec, first, last);
+    Real var = m.M2/m.n;
+    if (var == 0)
+    {
+        // A constant dataset has no skewness, as in the sequential version.
+        return Real(0);
+    }
+    return m.M3/(m.M2*sqrt(var));
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto skewness(ExecutionPolicy&& exec, Container const & v)
+{
+    return skewness(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto first_four_moments(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    using Real = detail::moment_real_t<ForwardIterator>;
+    BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute the first four moments.");
+    auto m = detail::chunked_central_moments<Real, 4>(exec, first, last);
+    return std::make_tuple(m.M1, m.M2/m.n, m.M3/m.n, m.M4/m.n);
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto first_four_moments(ExecutionPolicy&& exec, Container const & v)
+{
+    return first_four_moments(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto kurtosis(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    auto [M1, M2, M3, M4] = first_four_moments(exec, first, last);
+    if (M2 == 0)
+    {
+        return M2;
+    }
+    return M4/(M2*M2);
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto kurtosis(ExecutionPolicy&& exec, Container const & v)
+{
+    return kurtosis(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto excess_kurtosis(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    return kurtosis(exec, first, last) - 3;
+}
+
+template<class ExecutionPolicy, class Container, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto excess_kurtosis(ExecutionPolicy&& exec, Container const & v)
+{
+    return excess_kurtosis(exec, v.cbegin(), v.cend());
+}
+
 
 template<class RandomAccessIterator>
 auto median(RandomAccessIterator first, RandomAccessIterator last)
@@ -448,14 +595,14 @@ auto median_absolute_deviation(RandomAccessIterator first, RandomAccessIterator
     {
         auto middle = first + (num_elems - 1)/2;
         std::nth_element(first, middle, last, comparator);
-        return abs(*middle);
+        return abs(*middle - center);
     }
     else
     {
         auto middle = first + num_elems/2 - 1;
         std::nth_element(first, middle, last, comparator);
         std::nth_element(middle, middle+1, last, comparator);
-        return (abs(*middle) + abs(*(middle+1)))/abs(static_cast<Real>(2));
+        return (abs(*middle - center) + abs(*(middle+1) - center))/abs(static_cast<Real>(2));
     }
 }
 
@@ -512,6 +659,263 @@ inline auto interquartile_range(RandomAccessContainer & v)
     return interquartile_range(v.begin(), v.end());
 }
 
+// Execution policy overloads of the order statistics.
+// Unlike the overloads above, these do not reorder the input; the order statistics are found by bucket selection,
+// which copies only the elements near the requested ranks to scratch space, and takes linear time.
+// Pass std::execution::seq to get a single threaded version which leaves the data intact.
+namespace detail {
+
+template<class RandomAccessIterator>
+using order_statistic_real_t = std::conditional_t<std::is_integral_v<typename std::iterator_traits<RandomAccessIterator>::value_type>,
+                                                  double, typename std::iterator_traits<RandomAccessIterator>::value_type>;
+
+struct identity_projection
+{
+    template<class T>
+    T operator()(T const & x) const { return x; }
+};
+
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto median(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    size_t num_elems = std::distance(first, last);
+    BOOST_ASSERT_MSG(num_elems > 0, "The median of a zero length vector is undefined.");
+    if (num_elems & 1)
+    {
+        return detail::bucket_select<Real>(exec, first, last, detail::identity_projection(), {(num_elems - 1)/2})[0];
+    }
+    auto x = detail::bucket_select<Real>(exec, first, last, detail::identity_projection(), {num_elems/2 - 1, num_elems/2});
+    return (x[0] + x[1])/2;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto median(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return median(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto median_absolute_deviation(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last,
+                               typename std::iterator_traits<RandomAccessIterator>::value_type center=std::numeric_limits<typename std::iterator_traits<RandomAccessIterator>::value_type>::quiet_NaN())
+{
+    using std::abs;
+    using std::isnan;
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    size_t num_elems = std::distance(first, last);
+    BOOST_ASSERT_MSG(num_elems > 0, "The median of a zero-length vector is undefined.");
+    if (isnan(center))
+    {
+        center = boost::math::statistics::median(exec, first, last);
+    }
+    auto deviation = [center](Real const & x) { return Real(abs(x - center)); };
+    if (num_elems & 1)
+    {
+        return detail::bucket_select<Real>(exec, first, last, deviation, {(num_elems - 1)/2})[0];
+    }
+    auto x = detail::bucket_select<Real>(exec, first, last, deviation, {num_elems/2 - 1, num_elems/2});
+    return (x[0] + x[1])/2;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto median_absolute_deviation(ExecutionPolicy&& exec, RandomAccessContainer const & v,
+                                      typename RandomAccessContainer::value_type center=std::numeric_limits<typename RandomAccessContainer::value_type>::quiet_NaN())
+{
+    return median_absolute_deviation(exec, v.cbegin(), v.cend(), center);
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto interquartile_range(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    static_assert(!std::is_integral<Real>::value, "Integer values have not yet been implemented.");
+    size_t m = std::distance(first,last);
+    BOOST_ASSERT_MSG(m >= 3, "At least 3 samples are required to compute the interquartile range.");
+    // Same quartiles as the sequential version:
+    size_t k = m/4;
+    size_t j = m - (4*k);
+    if (j==2 || j==3)
+    {
+        auto x = detail::bucket_select<Real>(exec, first, last, detail::identity_projection(), {k, 3*k + j - 1});
+        return x[1] - x[0];
+    }
+    auto x = detail::bucket_select<Real>(exec, first, last, detail::identity_projection(), {k - 1, k, 3*k - 1 + j, 3*k + j});
+    Real Q1 = (x[0] + x[1])/2;
+    Real Q3 = (x[2] + x[3])/2;
+    return Q3 - Q1;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto interquartile_range(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return interquartile_range(exec, v.cbegin(), v.cend());
+}
+
+// The sample quantiles at each of the given probabilities, found together with a single selection.
+// Interpolates linearly between order statistics: Q(p) = x_(j) + g*(x_(j+1) - x_(j)), where (n-1)p = j + g,
+// which is the default of R and numpy (definition 7 of Hyndman and Fan, "Sample Quantiles in Statistical Packages").
+// Q(1/2) is the median.
+template<class ExecutionPolicy, class RandomAccessIterator, class ProbabilityContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto quantiles(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, ProbabilityContainer const & probabilities)
+{
+    using std::floor;
+    using Value = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using Real = detail::order_statistic_real_t<RandomAccessIterator>;
+    size_t n = std::distance(first, last);
+    BOOST_ASSERT_MSG(n > 0, "At least one sample is required to compute quantiles.");
+    std::vector<size_t> ranks;
+    for (auto const & p : probabilities)
+    {
+        if (!(p >= 0 && p <= 1))
+        {
+            throw std::domain_error("Quantiles are only defined for probabilities in [0, 1].");
+        }
+        Real h = (n - 1)*static_cast<Real>(p);
+        size_t j = static_cast<size_t>(floor(h));
+        ranks.push_back(j);
+        if (j + 1 < n)
+        {
+            ranks.push_back(j + 1);
+        }
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    auto x = detail::bucket_select<Value>(exec, first, last, detail::identity_projection(), ranks);
+    auto order_statistic = [&](size_t r) { return static_cast<Real>(x[std::lower_bound(ranks.begin(), ranks.end(), r) - ranks.begin()]); };
+
+    std::vector<Real> q;
+    q.reserve(std::size(probabilities));
+    for (auto const & p : probabilities)
+    {
+        Real h = (n - 1)*static_cast<Real>(p);
+        size_t j = static_cast<size_t>(floor(h));
+        Real g = h - j;
+        Real lo = order_statistic(j);
+        q.push_back(g == 0 ? lo : lo + g*(order_statistic(j + 1) - lo));
+    }
+    return q;
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class ProbabilityContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto quantiles(ExecutionPolicy&& exec, RandomAccessContainer const & v, ProbabilityContainer const & probabilities)
+{
+    return quantiles(exec, v.cbegin(), v.cend(), probabilities);
+}
+
+template<class RandomAccessIterator, class ProbabilityContainer, std::enable_if_t<!detail::is_execution_policy_v<RandomAccessIterator>, bool> = true>
+inline auto quantiles(RandomAccessIterator first, RandomAccessIterator last, ProbabilityContainer const & probabilities)
+{
+    return quantiles(std::execution::seq, first, last, probabilities);
+}
+
+template<class RandomAccessContainer, class ProbabilityContainer>
+inline auto quantiles(RandomAccessContainer const & v, ProbabilityContainer const & probabilities)
+{
+    return quantiles(std::execution::seq, v.cbegin(), v.cend(), probabilities);
+}
+
+// Execution policy overloads of the Gini coefficient, which do not modify the data.
+// 32 and 64 bit integers and IEEE floats are sorted by a parallel radix sort of a copy of the data;
+// other types are copied and sorted by std::sort.
+namespace detail {
+
+// The Gini coefficient of x_0 <= x_1 <= ... <= x_{n-1}, given by sorted(i) = x_i.
+// The sums are accumulated in fixed size chunks which are added up in order, so the result does not depend on the number of threads.
+template<class Real, class ExecutionPolicy, class SortedAccessor>
+Real gini_of_sorted(ExecutionPolicy&& exec, std::size_t n, SortedAccessor sorted)
+{
+    constexpr std::size_t chunk = 8192;
+    std::size_t chunks = (n + chunk - 1)/chunk;
+    std::vector<Real> num(chunks, Real(0));
+    std::vector<Real> denom(chunks, Real(0));
+    detail::parallel_blocks(exec, chunks, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c)
+        {
+            for (std::size_t i = c*chunk; i < (std::min)(n, (c + 1)*chunk); ++i)
+            {
+                Real x = sorted(i);
+                num[c] += x*Real(i + 1);
+                denom[c] += x;
+            }
+        }
+    });
+    Real N = 0;
+    Real D = 0;
+    for (std::size_t c = 0; c < chunks; ++c)
+    {
+        N += num[c];
+        D += denom[c];
+    }
+    // If the l1 norm is zero, all elements are zero, so every element is the same.
+    if (D == 0)
+    {
+        return Real(0);
+    }
+    Real i = Real(n + 1);
+    return ((2*N)/D - i)/(i-1);
+}
+
+template<class Real, class ExecutionPolicy, class RandomAccessIterator, class Projection>
+Real sorted_gini(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, Projection proj)
+{
+    using T = std::decay_t<decltype(proj(*first))>;
+    std::size_t n = std::distance(first, last);
+    if constexpr (radix_key_traits<T>::value)
+    {
+        using traits = radix_key_traits<T>;
+        std::vector<typename traits::key_type> keys(n);
+        detail::parallel_blocks(exec, n, 65536, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                keys[i] = traits::to_key(proj(first[i]));
+            }
+        });
+        radix_sort(exec, keys);
+        return gini_of_sorted<Real>(exec, n, [&](std::size_t i) { return static_cast<Real>(traits::from_key(keys[i])); });
+    }
+    else
+    {
+        std::vector<T> v(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            v[i] = proj(first[i]);
+        }
+        std::sort(v.begin(), v.end());
+        return gini_of_sorted<Real>(exec, n, [&](std::size_t i) { return static_cast<Real>(v[i]); });
+    }
+}
+
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+auto gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using Real = detail::order_statistic_real_t<RandomAccessIterator>;
+    BOOST_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+    return detail::sorted_gini<Real>(exec, first, last, detail::identity_projection());
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return gini_coefficient(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto sample_gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    size_t n = std::distance(first, last);
+    return n*gini_coefficient(exec, first, last)/(n-1);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, std::enable_if_t<detail::is_execution_policy_v<ExecutionPolicy>, bool> = true>
+inline auto sample_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer const & v)
+{
+    return sample_gini_coefficient(exec, v.cbegin(), v.cend());
+}
+
 
 }
 #endif
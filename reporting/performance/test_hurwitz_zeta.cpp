@@ -0,0 +1,106 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#  pragma warning (disable : 4224)
+#endif
+
+#include <boost/math/special_functions/hurwitz_zeta.hpp>
+#include <boost/math/special_functions/polylog.hpp>
+#include <boost/array.hpp>
+#include "../../test/table_type.hpp"
+#include "table_helper.hpp"
+#include "performance.hpp"
+#include <iostream>
+#include <iterator>
+
+//
+// Times zeta_evaluator against the free functions.  The rows of each data set are grouped by order,
+// so the batched timings pass each run of rows with the same order to the evaluator as one range.
+//
+template <class Func>
+double exec_timed_batches(Func f)
+{
+   std::vector<double> points, results;
+   double t = 0;
+   unsigned repeats = 1;
+   do{
+      stopwatch<boost::chrono::high_resolution_clock> w;
+
+      for(unsigned count = 0; count < repeats; ++count)
+      {
+         std::vector<std::vector<double> >::const_iterator i = data.begin();
+         while(i != data.end())
+         {
+            double s = (*i)[0];
+            points.clear();
+            for(; (i != data.end()) && ((*i)[0] == s); ++i)
+               points.push_back((*i)[1]);
+            results.clear();
+            f(s, points, results);
+            for(unsigned j = 0; j < results.size(); ++j)
+               sum += results[j];
+         }
+      }
+
+      t = boost::chrono::duration_cast<boost::chrono::duration<double>>(w.elapsed()).count();
+      if(t < 0.5)
+         repeats *= 2;
+   } while(t < 0.5);
+   return t / (repeats * data.size());
+}
+
+template <class Array, class Single, class Batch>
+void time_function(const Array& a, const char* name, Single single, Batch batch)
+{
+   data.clear();
+   add_data(a);
+   screen_data(single, [](const std::vector<double>& v){ return v[2];  });
+
+   double time = exec_timed_test(single);
+   std::cout << time << std::endl;
+   report_execution_time(time, std::string("Compiler Comparison on ") + std::string(platform_name()), name, compiler_name() + std::string("[br]") + boost_name());
+
+   time = exec_timed_batches(batch);
+   std::cout << time << std::endl;
+   report_execution_time(time, std::string("Compiler Comparison on ") + std::string(platform_name()), name, compiler_name() + std::string("[br]") + boost_name() + "[br]zeta_evaluator, batched by order");
+}
+
+int main()
+{
+   typedef double T;
+#define SC_(x) static_cast<double>(x)
+#include "hurwitz_zeta_data.ipp"
+#include "polylog_data.ipp"
+#include "zeta_data.ipp"
+
+   boost::math::zeta_evaluator<double> evaluator;
+
+   time_function(hurwitz_zeta_data, "hurwitz_zeta",
+      [](const std::vector<double>& v){  return boost::math::hurwitz_zeta(v[0], v[1]);  },
+      [&](double s, const std::vector<double>& a, std::vector<double>& r){  evaluator.hurwitz_zeta(s, a.begin(), a.end(), std::back_inserter(r));  });
+
+   time_function(polylog_data, "polylog",
+      [](const std::vector<double>& v){  return boost::math::polylog(v[0], v[1]);  },
+      [&](double s, const std::vector<double>& z, std::vector<double>& r){  evaluator.polylog(s, z.begin(), z.end(), std::back_inserter(r));  });
+
+   //
+   // The Riemann zeta function through the evaluator, which for double uses the same
+   // rational approximations as zeta, against zeta itself:
+   //
+   data.clear();
+   add_data(zeta_data);
+   std::string function_short = "zeta";
+
+   double time = exec_timed_test([](const std::vector<double>& v){  return boost::math::zeta(v[0]);  });
+   std::cout << time << std::endl;
+   report_execution_time(time, std::string("Compiler Comparison on ") + std::string(platform_name()), function_short, compiler_name() + std::string("[br]") + boost_name());
+
+   time = exec_timed_test([&](const std::vector<double>& v){  return evaluator.zeta(v[0]);  });
+   std::cout << time << std::endl;
+   report_execution_time(time, std::string("Compiler Comparison on ") + std::string(platform_name()), function_short, compiler_name() + std::string("[br]") + boost_name() + "[br]zeta_evaluator");
+
+   return 0;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright Nick Thompson, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <list>
+#include <random>
+#include <algorithm>
+#include <boost/math/statistics/accumulators.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/linear_regression.hpp>
+
+using boost::math::statistics::moments_accumulator;
+using boost::math::statistics::covariance_accumulator;
+using boost::math::statistics::simple_ordinary_least_squares_accumulator;
+
+template<typename Real>
+std::vector<Real> random_vector(size_t n, unsigned seed)
+{
+    std::mt19937 gen{seed};
+    std::gamma_distribution<Real> dis{Real(2), Real(3)};
+    std::vector<Real> v(n);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    return v;
+}
+
+template<typename Real>
+void test_moments()
+{
+    using namespace boost::math::statistics;
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    auto v = random_vector<Real>(5000, 13);
+    moments_accumulator<Real> acc;
+    for (auto x : v) {
+        acc.push(x);
+    }
+    CHECK_EQUAL(v.size(), acc.count());
+    CHECK_EQUAL(*std::min_element(v.begin(), v.end()), acc.min());
+    CHECK_EQUAL(*std::max_element(v.begin(), v.end()), acc.max());
+
+    // The single sample updates are those of first_four_moments:
+    auto [M1, M2, M3, M4] = first_four_moments(v);
+    auto [A1, A2, A3, A4] = acc.first_four_moments();
+    CHECK_ULP_CLOSE(M1, A1, 0);
+    CHECK_ULP_CLOSE(M2, A2, 0);
+    CHECK_ULP_CLOSE(M3, A3, 0);
+    CHECK_ULP_CLOSE(M4, A4, 0);
+    CHECK_MOLLIFIED_CLOSE(mean(v), acc.mean(), tol);
+    CHECK_MOLLIFIED_CLOSE(variance(v), acc.variance(), tol);
+    CHECK_MOLLIFIED_CLOSE(sample_variance(v), acc.sample_variance(), tol);
+    CHECK_MOLLIFIED_CLOSE(skewness(v), acc.skewness(), tol);
+    CHECK_MOLLIFIED_CLOSE(kurtosis(v), acc.kurtosis(), tol);
+    CHECK_MOLLIFIED_CLOSE(excess_kurtosis(v), acc.excess_kurtosis(), tol);
+
+    // Shards of different sizes, pushed as ranges and merged:
+    moments_accumulator<Real> a;
+    moments_accumulator<Real> b;
+    moments_accumulator<Real> c;
+    a.push(v.begin(), v.begin() + 17);
+    b.push(std::vector<Real>(v.begin() + 17, v.begin() + 3000));
+    std::list<Real> l(v.begin() + 3000, v.end());
+    c.push(l);
+    moments_accumulator<Real> empty;
+    a.merge(empty);
+    b.merge(c);
+    a.merge(b);
+    empty.merge(a);
+    CHECK_EQUAL(v.size(), empty.count());
+    CHECK_EQUAL(acc.min(), a.min());
+    CHECK_EQUAL(acc.max(), a.max());
+    CHECK_MOLLIFIED_CLOSE(acc.mean(), empty.mean(), tol);
+    CHECK_MOLLIFIED_CLOSE(acc.variance(), empty.variance(), tol);
+    CHECK_MOLLIFIED_CLOSE(acc.skewness(), empty.skewness(), tol);
+    CHECK_MOLLIFIED_CLOSE(acc.kurtosis(), empty.kurtosis(), tol);
+
+    // Constant data:
+    moments_accumulator<Real> k;
+    k.push(std::vector<Real>(10, Real(4)));
+    CHECK_EQUAL(Real(4), k.mean());
+    CHECK_EQUAL(Real(0), k.variance());
+    CHECK_EQUAL(Real(0), k.skewness());
+    CHECK_EQUAL(Real(0), k.kurtosis());
+}
+
+template<typename Real>
+void test_covariance()
+{
+    using namespace boost::math::statistics;
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    auto u = random_vector<Real>(3000, 1);
+    auto v = random_vector<Real>(3000, 2);
+    for (size_t i = 0; i < u.size(); ++i) {
+        v[i] += 2*u[i];
+    }
+    covariance_accumulator<Real> acc;
+    acc.push(u, v);
+    auto [mu_u, mu_v, cov] = means_and_covariance(u, v);
+    auto [a_u, a_v, a_cov] = acc.means_and_covariance();
+    // Same update as means_and_covariance:
+    CHECK_ULP_CLOSE(mu_u, a_u, 0);
+    CHECK_ULP_CLOSE(mu_v, a_v, 0);
+    CHECK_ULP_CLOSE(cov, a_cov, 0);
+    CHECK_MOLLIFIED_CLOSE(correlation_coefficient(u, v), acc.correlation_coefficient(), tol);
+
+    covariance_accumulator<Real> a;
+    covariance_accumulator<Real> b;
+    a.push(u.begin(), u.begin() + 1000, v.begin());
+    for (size_t i = 1000; i < u.size(); ++i) {
+        b.push(u[i], v[i]);
+    }
+    a.merge(b);
+    CHECK_EQUAL(u.size(), a.count());
+    CHECK_MOLLIFIED_CLOSE(cov, a.covariance(), tol);
+    CHECK_MOLLIFIED_CLOSE(acc.correlation_coefficient(), a.correlation_coefficient(), tol);
+
+    covariance_accumulator<Real> k;
+    k.push(std::vector<Real>{1, 1, 1}, std::vector<Real>{1, 2, 3});
+    CHECK_EQUAL(Real(0), k.correlation_coefficient());
+}
+
+template<typename Real>
+void test_ols()
+{
+    using namespace boost::math::statistics;
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    auto x = random_vector<Real>(2000, 5);
+    auto y = random_vector<Real>(2000, 6);
+    for (size_t i = 0; i < x.size(); ++i) {
+        y[i] = 3 - x[i]/2 + y[i]/10;
+    }
+    auto [c0, c1, Rsquared] = simple_ordinary_least_squares_with_R_squared(x, y);
+
+    std::vector<simple_ordinary_least_squares_accumulator<Real>> shards(7);
+    for (size_t i = 0; i < x.size(); ++i) {
+        shards[i % shards.size()].push(x[i], y[i]);
+    }
+    for (size_t i = 1; i < shards.size(); ++i) {
+        shards[0].merge(shards[i]);
+    }
+    auto [a0, a1, aRsquared] = shards[0].coefficients_with_R_squared();
+    CHECK_MOLLIFIED_CLOSE(c0, a0, tol);
+    CHECK_MOLLIFIED_CLOSE(c1, a1, tol);
+    CHECK_MOLLIFIED_CLOSE(Rsquared, aRsquared, tol);
+    auto [b0, b1] = shards[0].coefficients();
+    CHECK_EQUAL(a0, b0);
+    CHECK_EQUAL(a1, b1);
+
+    simple_ordinary_least_squares_accumulator<Real> degenerate;
+    degenerate.push(Real(1), Real(2));
+    degenerate.push(Real(1), Real(3));
+    bool thrown = false;
+    try {
+        degenerate.coefficients();
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+int main()
+{
+    test_moments<float>();
+    test_moments<double>();
+    test_moments<long double>();
+    test_covariance<float>();
+    test_covariance<double>();
+    test_ols<double>();
+    test_ols<long double>();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright Nick Thompson, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <execution>
+#include <boost/math/statistics/autocorrelation.hpp>
+
+using boost::math::statistics::autocovariance;
+using boost::math::statistics::autocorrelation;
+
+template<class Real>
+std::vector<Real> naive_autocovariance(std::vector<Real> const & v, size_t max_lag)
+{
+    long double mu = 0;
+    for (auto x : v) {
+        mu += x;
+    }
+    mu /= v.size();
+    std::vector<Real> gamma(max_lag + 1);
+    for (size_t k = 0; k <= max_lag; ++k) {
+        long double sum = 0;
+        for (size_t t = 0; t + k < v.size(); ++t) {
+            sum += (v[t] - mu)*(v[t + k] - mu);
+        }
+        gamma[k] = static_cast<Real>(sum/v.size());
+    }
+    return gamma;
+}
+
+template<class Real>
+void test_agreement()
+{
+    std::mt19937 gen{314};
+    std::normal_distribution<Real> dis(0, 1);
+    // An AR(1) process, so the autocorrelations are far from zero:
+    std::vector<Real> v(3000);
+    Real x = 0;
+    for (auto & y : v) {
+        x = Real(0.8)*x + dis(gen);
+        y = 5 + x;
+    }
+    // Few lags are computed directly, many by FFT:
+    for (size_t max_lag : {size_t(0), size_t(3), size_t(20), size_t(500), size_t(2999)}) {
+        auto expected = naive_autocovariance(v, max_lag);
+        auto seq = autocovariance(v, max_lag);
+        auto par = autocovariance(std::execution::par, v.cbegin(), v.cend(), max_lag);
+        CHECK_EQUAL(expected.size(), seq.size());
+        for (size_t k = 0; k <= max_lag; ++k) {
+            // Absolute error relative to the variance, as the transform does not preserve relative accuracy of small lags:
+            CHECK_MOLLIFIED_CLOSE(Real(0), (expected[k] - seq[k])/expected[0], 256*std::numeric_limits<Real>::epsilon());
+            CHECK_EQUAL(seq[k], par[k]);
+        }
+        auto rho = autocorrelation(v, max_lag);
+        CHECK_EQUAL(Real(1), rho[0]);
+        for (size_t k = 0; k <= max_lag; ++k) {
+            CHECK_MOLLIFIED_CLOSE(expected[k]/expected[0], rho[k], 256*std::numeric_limits<Real>::epsilon());
+        }
+    }
+}
+
+void test_integers()
+{
+    std::vector<int> v{1, 2, 3, 4, 5};
+    auto gamma = autocovariance(v, 2);
+    // Deviations -2, -1, 0, 1, 2:
+    CHECK_ULP_CLOSE(2.0, gamma[0], 1);
+    CHECK_ULP_CLOSE(4.0/5, gamma[1], 1);
+    CHECK_ULP_CLOSE(-1.0/5, gamma[2], 1);
+}
+
+void test_errors()
+{
+    std::vector<double> v{1, 2, 3};
+    bool thrown = false;
+    try {
+        autocovariance(v, 3);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+
+    thrown = false;
+    try {
+        autocorrelation(std::vector<double>{2, 2, 2}, 1);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+int main()
+{
+    test_agreement<float>();
+    test_agreement<double>();
+    test_agreement<long double>();
+    test_integers();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -335,6 +335,7 @@ void instantiate(RealType)
    boost::math::hypergeometric_1F1(v1, v2, v3);
 #ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
    boost::math::hypergeometric_pFq({ v1 }, { v2 }, v3);
+   boost::math::hypergeometric_pFq_evaluator<RealType>({ v1 }, { v2 })(v3);
 #endif
 #endif
 
@@ -375,6 +376,7 @@ void instantiate(RealType)
    boost::math::bernoulli_b2n<RealType>(i, i, &v1);
    boost::math::tangent_t2n<RealType>(i);
    boost::math::tangent_t2n<RealType>(i, i, &v1);
+   boost::math::prefill_bernoulli_b2n<RealType>(i, i);
 
 #endif
 #ifdef TEST_GROUP_9
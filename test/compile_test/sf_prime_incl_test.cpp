@@ -16,6 +16,9 @@
 void compile_and_link_test()
 {
    check_result<boost::uint32_t>(boost::math::prime(u));
+   check_result<boost::uint64_t>(boost::math::prime_count(u));
+   check_result<boost::uint64_t>(boost::math::next_prime(u));
+   check_result<bool>(boost::math::is_prime(u));
    //
    // Add constexpr tests here:
    //
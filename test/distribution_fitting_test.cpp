@@ -0,0 +1,226 @@
+/*
+ * Copyright Nick Thompson, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <execution>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/statistics/distribution_fitting.hpp>
+
+using boost::math::statistics::fit_gamma;
+using boost::math::statistics::fit_beta;
+using boost::math::statistics::fit_weibull;
+using boost::math::statistics::fit_lognormal;
+using boost::math::statistics::fit_negative_binomial;
+
+// The estimates must satisfy the likelihood equations, and for a large sample be close to the true parameters.
+
+template<typename Real>
+void test_gamma()
+{
+    std::mt19937 gen{87123};
+    std::gamma_distribution<Real> dis{Real(2.5), Real(3)};
+    std::vector<Real> v(20000);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    auto dist = fit_gamma(v);
+    Real k = dist.shape();
+    Real theta = dist.scale();
+    long double mu = 0;
+    long double mu_log = 0;
+    for (auto x : v) {
+        mu += x;
+        mu_log += std::log(static_cast<long double>(x));
+    }
+    mu /= v.size();
+    mu_log /= v.size();
+    // Likelihood equations: k*theta = mean, log(k) - digamma(k) = log(mean) - mean(log),
+    // up to the rounding error in the running means:
+    CHECK_MOLLIFIED_CLOSE(Real(mu), k*theta, 128*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(Real(std::log(mu) - mu_log), std::log(k) - boost::math::digamma(k), 128*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(Real(2.5), k, Real(0.05));
+    CHECK_MOLLIFIED_CLOSE(Real(3), theta, Real(0.05));
+
+    // Small shapes, and the shapes large enough that the likelihood equation suffers cancellation:
+    for (Real shape : {Real(0.2), Real(400)}) {
+        std::gamma_distribution<Real> dis2{shape, Real(1)};
+        for (auto & x : v) {
+            x = dis2(gen);
+        }
+        CHECK_MOLLIFIED_CLOSE(shape, fit_gamma(v).shape(), Real(0.05));
+    }
+
+    bool thrown = false;
+    try {
+        std::vector<Real> w{1, 2, -1};
+        fit_gamma(w);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+template<typename Real>
+void test_beta()
+{
+    std::mt19937 gen{12};
+    std::gamma_distribution<Real> ga{Real(0.7), Real(1)};
+    std::gamma_distribution<Real> gb{Real(4), Real(1)};
+    std::vector<Real> v(20000);
+    for (auto & x : v) {
+        Real a = ga(gen);
+        x = a/(a + gb(gen));
+    }
+    auto dist = fit_beta(v);
+    Real a = dist.alpha();
+    Real b = dist.beta();
+    Real g1 = 0;
+    Real g2 = 0;
+    for (auto x : v) {
+        g1 += std::log(x);
+        g2 += std::log1p(-x);
+    }
+    g1 /= v.size();
+    g2 /= v.size();
+    CHECK_MOLLIFIED_CLOSE(g1, boost::math::digamma(a) - boost::math::digamma(a + b), 64*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(g2, boost::math::digamma(b) - boost::math::digamma(a + b), 64*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(Real(0.7), a, Real(0.05));
+    CHECK_MOLLIFIED_CLOSE(Real(4), b, Real(0.2));
+}
+
+template<typename Real>
+void test_weibull()
+{
+    std::mt19937 gen{6543};
+    std::weibull_distribution<Real> dis{Real(1.7), Real(40)};
+    std::vector<Real> v(20000);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    auto dist = fit_weibull(v);
+    Real k = dist.shape();
+    Real lambda = dist.scale();
+    // Likelihood equations: sum(x^k log x)/sum(x^k) - 1/k = mean(log x), and lambda^k = mean(x^k):
+    Real s0 = 0;
+    Real s1 = 0;
+    Real mu_log = 0;
+    for (auto x : v) {
+        Real w = std::pow(x/lambda, k);
+        s0 += w;
+        s1 += w*std::log(x);
+        mu_log += std::log(x);
+    }
+    mu_log /= v.size();
+    CHECK_MOLLIFIED_CLOSE(Real(1), s0/v.size(), 64*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(mu_log, s1/s0 - 1/k, 256*std::numeric_limits<Real>::epsilon());
+    CHECK_MOLLIFIED_CLOSE(Real(1.7), k, Real(0.05));
+    CHECK_MOLLIFIED_CLOSE(Real(40), lambda, Real(1));
+}
+
+template<typename Real>
+void test_lognormal()
+{
+    std::mt19937 gen{998};
+    std::lognormal_distribution<Real> dis{Real(-1), Real(0.4)};
+    std::vector<Real> v(20000);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    auto dist = fit_lognormal(v);
+    CHECK_MOLLIFIED_CLOSE(Real(-1), dist.location(), Real(0.02));
+    CHECK_MOLLIFIED_CLOSE(Real(0.4), dist.scale(), Real(0.02));
+
+    std::vector<Real> w{std::exp(Real(1)), std::exp(Real(3))};
+    dist = fit_lognormal(w);
+    CHECK_ULP_CLOSE(Real(2), dist.location(), 2);
+    CHECK_ULP_CLOSE(Real(1), dist.scale(), 2);
+}
+
+void test_negative_binomial()
+{
+    std::mt19937 gen{31};
+    std::negative_binomial_distribution<int> dis{3, 0.2};
+    std::vector<int> v(20000);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    auto dist = fit_negative_binomial(v);
+    double r = dist.successes();
+    double p = dist.success_fraction();
+    double mu = 0;
+    double score = 0;
+    for (auto x : v) {
+        mu += x;
+        score += boost::math::digamma(x + r) - boost::math::digamma(r);
+    }
+    mu /= v.size();
+    // Likelihood equations: r(1-p)/p = mean, and the profile score in r vanishes:
+    CHECK_MOLLIFIED_CLOSE(mu, r*(1 - p)/p, 1e-13);
+    CHECK_MOLLIFIED_CLOSE(0.0, score/v.size() + std::log(p), 1e-12);
+    CHECK_MOLLIFIED_CLOSE(3.0, r, 0.2);
+    CHECK_MOLLIFIED_CLOSE(0.2, p, 0.02);
+}
+
+template<typename Real>
+void test_batch()
+{
+    std::mt19937 gen{4};
+    std::gamma_distribution<Real> dis{Real(1.5), Real(2)};
+    std::vector<std::vector<Real>> groups(1000);
+    for (auto & g : groups) {
+        g.resize(10 + gen() % 50);
+        for (auto & x : g) {
+            x = dis(gen);
+        }
+    }
+    using gamma_t = decltype(fit_gamma(groups[0]));
+    std::vector<gamma_t> seq(groups.size(), gamma_t(1));
+    std::vector<gamma_t> par(groups.size(), gamma_t(1));
+    fit_gamma(std::execution::seq, groups.begin(), groups.end(), seq.begin());
+    fit_gamma(std::execution::par, groups.begin(), groups.end(), par.begin());
+    for (size_t i = 0; i < groups.size(); ++i) {
+        auto expected = fit_gamma(groups[i]);
+        CHECK_EQUAL(expected.shape(), seq[i].shape());
+        CHECK_EQUAL(expected.shape(), par[i].shape());
+        CHECK_EQUAL(expected.scale(), par[i].scale());
+    }
+
+    using lognormal_t = decltype(fit_lognormal(groups[0]));
+    std::vector<lognormal_t> ln(groups.size());
+    fit_lognormal(std::execution::par, groups.begin(), groups.end(), ln.begin());
+    for (size_t i = 0; i < groups.size(); ++i) {
+        CHECK_EQUAL(fit_lognormal(groups[i]).location(), ln[i].location());
+    }
+
+    // Errors in any group reach the caller:
+    groups[567][3] = -1;
+    bool thrown = false;
+    try {
+        fit_gamma(std::execution::par, groups.begin(), groups.end(), par.begin());
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+int main()
+{
+    test_gamma<float>();
+    test_gamma<double>();
+    test_beta<double>();
+    test_beta<long double>();
+    test_weibull<float>();
+    test_weibull<double>();
+    test_lognormal<double>();
+    test_negative_binomial();
+    test_batch<double>();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,225 @@
+// Copyright Nick Thompson, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE gauss_golub_welsch_test
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_hermite.hpp>
+#include <boost/math/quadrature/gauss_jacobi.hpp>
+#include <boost/math/quadrature/gauss_laguerre.hpp>
+#include <boost/math/special_functions/hermite.hpp>
+#include <boost/math/special_functions/jacobi.hpp>
+#include <boost/math/special_functions/laguerre.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_hermite;
+using boost::math::quadrature::gauss_jacobi;
+using boost::math::quadrature::gauss_laguerre;
+using boost::math::constants::pi;
+using boost::math::constants::root_pi;
+using boost::multiprecision::cpp_bin_float_quad;
+
+template<class Real>
+void test_hermite()
+{
+   std::cout << "Testing Gauss-Hermite on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   using std::sqrt;
+   using std::abs;
+   Real tol = 20 * std::numeric_limits<Real>::epsilon();
+   // Closed form for n = 3:
+   gauss_hermite<Real> rule(3);
+   BOOST_CHECK_EQUAL(rule.order(), 3u);
+   BOOST_CHECK_EQUAL(rule.abscissa()[1], Real(0));
+   BOOST_CHECK_CLOSE_FRACTION(rule.abscissa()[2], sqrt(Real(3) / 2), tol);
+   BOOST_CHECK_CLOSE_FRACTION(rule.weights()[1], 2 * root_pi<Real>() / 3, tol);
+   BOOST_CHECK_CLOSE_FRACTION(rule.weights()[2], root_pi<Real>() / 6, tol);
+
+   for (unsigned n : {1u, 2u, 7u, 20u, 64u})
+   {
+      gauss_hermite<Real> r(n);
+      for (unsigned i = 0; i < n; ++i)
+      {
+         Real x = r.abscissa()[i];
+         BOOST_CHECK_EQUAL(x, -r.abscissa()[n - 1 - i]);
+         BOOST_CHECK_EQUAL(r.weights()[i], r.weights()[n - 1 - i]);
+         // A Newton step on the polynomial of hermite.hpp should not move the node:
+         Real step = boost::math::hermite(n, x) / (2 * n * boost::math::hermite(n - 1, x));
+         BOOST_CHECK_SMALL(step, tol * (1 + abs(x)));
+      }
+      // The even moments are Gamma(k + 1/2), exactly up to degree 2n-1:
+      Real moment = root_pi<Real>();
+      for (unsigned k = 0; 2 * k < 2 * n; ++k)
+      {
+         Real Q = r.integrate([k](Real x) { return pow(x, 2 * k); });
+         BOOST_CHECK_CLOSE_FRACTION(Q, moment, 4 * n * tol);
+         moment *= k + Real(1) / 2;
+      }
+   }
+   // The weights of the outermost nodes of large rules underflow rather than overflow:
+   gauss_hermite<Real> big(600);
+   BOOST_CHECK_CLOSE_FRACTION(big.integrate([](Real) { return Real(1); }), root_pi<Real>(), tol);
+   for (Real w : big.weights())
+   {
+      BOOST_CHECK(w >= 0);
+   }
+}
+
+template<class Real>
+void test_laguerre()
+{
+   std::cout << "Testing Gauss-Laguerre on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   using std::abs;
+   Real tol = 20 * std::numeric_limits<Real>::epsilon();
+   for (unsigned n : {1u, 2u, 5u, 16u, 40u})
+   {
+      gauss_laguerre<Real> r(n);
+      for (unsigned i = 0; i < n; ++i)
+      {
+         Real x = r.abscissa()[i];
+         BOOST_CHECK(x > 0);
+         if (i > 0)
+         {
+            BOOST_CHECK(r.abscissa()[i - 1] < x);
+         }
+         // x L_n'(x) = n L_n(x) - n L_{n-1}(x). The recurrence loses relative accuracy as x approaches zero,
+         // in the rule as in laguerre.hpp, so the smallest nodes are accurate in absolute terms:
+         Real step = x * boost::math::laguerre(n, x) / (n * (boost::math::laguerre(n, x) - boost::math::laguerre(n - 1, x)));
+         BOOST_CHECK_SMALL(step, tol * (1 + x));
+      }
+      // The moments are k!, exactly up to degree 2n-1:
+      Real moment = 1;
+      for (unsigned k = 0; k < (std::min)(2 * n, 20u); ++k)
+      {
+         Real Q = r.integrate([k](Real x) { return pow(x, k); });
+         BOOST_CHECK_CLOSE_FRACTION(Q, moment, 4 * n * tol);
+         moment *= k + 1;
+      }
+   }
+   // The generalized rule, against Gamma(k + alpha + 1):
+   Real alpha = Real(3) / 2;
+   gauss_laguerre<Real> r(12, alpha);
+   for (unsigned k = 0; k < 12; ++k)
+   {
+      Real Q = r.integrate([k](Real x) { return pow(x, k); });
+      BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::tgamma(k + alpha + 1), 50 * tol);
+   }
+   // The associated polynomials of laguerre.hpp have integer order:
+   gauss_laguerre<Real> r2(9, Real(2));
+   for (Real x : r2.abscissa())
+   {
+      Real step = boost::math::laguerre(9, 2, x) / boost::math::laguerre(8, 3, x);
+      BOOST_CHECK_SMALL(step, tol * (1 + x));
+   }
+}
+
+template<class Real>
+void test_jacobi()
+{
+   std::cout << "Testing Gauss-Jacobi on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   using std::cos;
+   using std::abs;
+   Real tol = 20 * std::numeric_limits<Real>::epsilon();
+   // Gauss-Chebyshev:
+   for (unsigned n : {1u, 4u, 13u, 50u})
+   {
+      gauss_jacobi<Real> r(n, -Real(1) / 2, -Real(1) / 2);
+      for (unsigned i = 0; i < n; ++i)
+      {
+         Real x = -cos((2 * i + 1) * pi<Real>() / (2 * n));
+         BOOST_CHECK_SMALL(Real(r.abscissa()[i] - x), tol);
+         // The weights nearest the endpoints are the least accurate:
+         BOOST_CHECK_CLOSE_FRACTION(r.weights()[i], pi<Real>() / n, 2 * tol);
+      }
+   }
+   // Legendre, against the tables:
+   gauss_jacobi<Real> legendre(20, Real(0), Real(0));
+   for (unsigned i = 0; i < 10; ++i)
+   {
+      BOOST_CHECK_SMALL(Real(legendre.abscissa()[10 + i] - gauss<Real, 20>::abscissa()[i]), tol);
+      BOOST_CHECK_CLOSE_FRACTION(legendre.weights()[10 + i], (gauss<Real, 20>::weights()[i]), tol);
+   }
+   // An asymmetric weight, whose nodes are the zeros of jacobi.hpp's polynomial:
+   Real alpha = Real(1) / 3;
+   Real beta = -Real(3) / 4;
+   gauss_jacobi<Real> r(15, alpha, beta);
+   for (Real x : r.abscissa())
+   {
+      Real step = boost::math::jacobi(15, alpha, beta, x) / boost::math::jacobi_prime(15, alpha, beta, x);
+      BOOST_CHECK_SMALL(step, tol);
+   }
+   // int_{-1}^{1} (1-x)^alpha (1+x)^beta (1+x)^k dx = 2^{alpha+beta+k+1} B(alpha+1, beta+k+1):
+   for (unsigned k = 0; k < 30; ++k)
+   {
+      Real Q = r.integrate([k](Real x) { return pow(1 + x, k); });
+      Real expected = pow(Real(2), alpha + beta + k + 1) * boost::math::beta(alpha + 1, beta + k + 1);
+      BOOST_CHECK_CLOSE_FRACTION(Q, expected, 200 * tol);
+   }
+}
+
+void test_cache()
+{
+   std::cout << "Testing the cache of rules\n";
+   gauss_hermite<double>::clear_cache();
+   BOOST_CHECK_EQUAL(gauss_hermite<double>::cache_size(), 0u);
+   gauss_hermite<double> a(33);
+   gauss_hermite<double> b(33);
+   BOOST_CHECK_EQUAL(gauss_hermite<double>::cache_size(), 1u);
+   BOOST_CHECK_EQUAL(a.abscissa().data(), b.abscissa().data());
+   gauss_hermite<double> c(34);
+   BOOST_CHECK_EQUAL(gauss_hermite<double>::cache_size(), 2u);
+   // The parameters are part of the key:
+   gauss_laguerre<double>::clear_cache();
+   gauss_laguerre<double> l0(10);
+   gauss_laguerre<double> l1(10, 0.5);
+   BOOST_CHECK_EQUAL(gauss_laguerre<double>::cache_size(), 2u);
+   BOOST_CHECK(l0.abscissa()[0] != l1.abscissa()[0]);
+   // Rules outlive the cache:
+   gauss_hermite<double>::clear_cache();
+   BOOST_CHECK_EQUAL(a.order(), 33u);
+   BOOST_CHECK_CLOSE_FRACTION(a.integrate([](double) { return 1.0; }), root_pi<double>(), 1e-14);
+   // Threads asking for the same rule at once all receive the same one:
+   std::vector<std::thread> threads;
+   std::vector<const double*> data(8);
+   for (unsigned t = 0; t < data.size(); ++t)
+   {
+      threads.emplace_back([&data, t]() { data[t] = gauss_jacobi<double>(200, 0.25, 0.5).abscissa().data(); });
+   }
+   for (auto& t : threads)
+   {
+      t.join();
+   }
+   for (auto p : data)
+   {
+      BOOST_CHECK_EQUAL(p, data[0]);
+   }
+   BOOST_CHECK_EQUAL(gauss_jacobi<double>(200, 0.25, 0.5).abscissa().data(), data[0]);
+
+   BOOST_CHECK_THROW(gauss_hermite<double>(0), std::domain_error);
+   BOOST_CHECK_THROW(gauss_laguerre<double>(5, -1.0), std::domain_error);
+   BOOST_CHECK_THROW(gauss_jacobi<double>(5, 0.0, -2.0), std::domain_error);
+   BOOST_CHECK_THROW(gauss_jacobi<double>(5, std::numeric_limits<double>::quiet_NaN(), 0.0), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(gauss_golub_welsch_test)
+{
+   test_hermite<double>();
+   test_hermite<long double>();
+   test_hermite<cpp_bin_float_quad>();
+   test_laguerre<double>();
+   test_laguerre<long double>();
+   test_laguerre<cpp_bin_float_quad>();
+   test_jacobi<double>();
+   test_jacobi<long double>();
+   test_jacobi<cpp_bin_float_quad>();
+   test_cache();
+}
@@ -0,0 +1,122 @@
+// Copyright Nick Thompson, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE gauss_legendre_test
+
+#include <cmath>
+#include <limits>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/gauss_legendre.hpp>
+#include <boost/math/special_functions/legendre.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_legendre;
+using boost::math::constants::pi;
+using boost::math::constants::half_pi;
+using boost::multiprecision::cpp_bin_float_quad;
+
+// The tabulated rules of gauss<Real, N> are correctly rounded:
+template<class Real, unsigned N>
+void test_against_tables()
+{
+   std::cout << "Testing order " << N << " against the tables on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 10 * std::numeric_limits<Real>::epsilon();
+   gauss_legendre<Real> rule(N);
+   BOOST_CHECK_EQUAL(rule.order(), N);
+   BOOST_REQUIRE_EQUAL(rule.abscissa().size(), (gauss<Real, N>::abscissa().size()));
+   for (unsigned i = 0; i < rule.abscissa().size(); ++i)
+   {
+      Real x = gauss<Real, N>::abscissa()[i];
+      // The abscissa are found as x = cos(theta), whose error is small in absolute rather than relative terms near zero:
+      BOOST_CHECK_SMALL(Real(rule.abscissa()[i] - x), tol);
+      BOOST_CHECK_CLOSE_FRACTION(rule.weights()[i], (gauss<Real, N>::weights()[i]), tol);
+   }
+}
+
+// Every order up to a few hundred, whose rules pass through both the asymptotic expansion and the recurrence:
+void test_against_legendre_p_zeros()
+{
+   std::cout << "Testing orders up to 300 against legendre_p_zeros\n";
+   for (unsigned n = 1; n <= 300; ++n)
+   {
+      gauss_legendre<double> rule(n);
+      std::vector<long double> zeros = boost::math::legendre_p_zeros<long double>(n);
+      BOOST_REQUIRE_EQUAL(rule.abscissa().size(), zeros.size());
+      for (unsigned i = 0; i < zeros.size(); ++i)
+      {
+         long double z = zeros[i];
+         long double p = boost::math::legendre_p_prime(static_cast<int>(n), z);
+         long double w = 2 / ((1 - z * z) * p * p);
+         BOOST_CHECK_SMALL(static_cast<double>(rule.abscissa()[i] - z), 2 * std::numeric_limits<double>::epsilon());
+         // Near the endpoints the reference weights are limited by the rounding of 1 - z^2:
+         if (1 - z > 0.01)
+         {
+            BOOST_CHECK_CLOSE_FRACTION(rule.weights()[i], static_cast<double>(w), 20 * std::numeric_limits<double>::epsilon());
+         }
+      }
+   }
+}
+
+void test_large_order()
+{
+   std::cout << "Testing large orders\n";
+   using std::sin;
+   using std::cos;
+   using std::sqrt;
+   for (unsigned n : {100000u, 100001u})
+   {
+      gauss_legendre<double> rule(n, 4);
+      gauss_legendre<double> serial(n, 1);
+      BOOST_CHECK(rule.abscissa() == serial.abscissa());
+      BOOST_CHECK(rule.weights() == serial.weights());
+      for (unsigned i = 1; i < rule.abscissa().size(); ++i)
+      {
+         BOOST_CHECK(rule.abscissa()[i - 1] < rule.abscissa()[i]);
+      }
+      BOOST_CHECK_CLOSE_FRACTION(rule.integrate([](double) { return 1.0; }), 2.0, 1e-13);
+      // Far beyond the reach of the small rules:
+      double Q = rule.integrate([](double x) { return cos(20000 * x); });
+      BOOST_CHECK_SMALL(Q - sin(20000.0) / 10000, 1e-13);
+      // The error for sqrt(1-x^2) decays as n^-3:
+      Q = rule.integrate([](double x) { return sqrt(1 - x * x); });
+      BOOST_CHECK_CLOSE_FRACTION(Q, half_pi<double>(), 1e-13);
+   }
+}
+
+template<class Real>
+void test_intervals()
+{
+   std::cout << "Testing integration over intervals on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   using std::exp;
+   Real tol = 10 * std::numeric_limits<Real>::epsilon();
+   gauss_legendre<Real> rule(40);
+   Real L1;
+   Real Q = rule.integrate([](Real x) { return x * x; }, Real(0), Real(3), &L1);
+   BOOST_CHECK_CLOSE_FRACTION(Q, Real(9), tol);
+   BOOST_CHECK_CLOSE_FRACTION(L1, Real(9), tol);
+   Q = rule.integrate([](Real x) { return 1 / (1 + x * x); }, -std::numeric_limits<Real>::infinity(), std::numeric_limits<Real>::infinity());
+   BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>(), Real(1e-5));
+   Q = rule.integrate([](Real x) { return exp(-x); }, Real(0), std::numeric_limits<Real>::infinity());
+   BOOST_CHECK_CLOSE_FRACTION(Q, Real(1), Real(1e-10));
+   BOOST_CHECK_THROW(rule.integrate([](Real x) { return x; }, Real(1), Real(0)), std::domain_error);
+   BOOST_CHECK_THROW(gauss_legendre<Real>(0), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(gauss_legendre_test)
+{
+   test_against_tables<double, 7>();
+   test_against_tables<double, 20>();
+   test_against_tables<double, 30>();
+   test_against_tables<long double, 15>();
+   test_against_tables<cpp_bin_float_quad, 10>();
+   test_against_tables<cpp_bin_float_quad, 30>();
+   test_against_legendre_p_zeros();
+   test_large_order();
+   test_intervals<double>();
+   test_intervals<long double>();
+}
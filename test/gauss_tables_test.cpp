@@ -0,0 +1,157 @@
+// Copyright John Maddock, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE gauss_tables_test
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_kronrod;
+using boost::multiprecision::cpp_bin_float_50;
+
+void test_round_trip()
+{
+   std::cout << "Testing tables saved and read back\n";
+   typedef gauss_kronrod<cpp_bin_float_50, 19> rule;
+   rule::precompute();
+   std::stringstream ss;
+   rule::save_tables(ss);
+   std::string header;
+   std::getline(ss, header);
+   BOOST_CHECK_EQUAL(header.substr(0, 17), "gauss_kronrod 19 ");
+   ss.seekg(0);
+   BOOST_CHECK(rule::load_tables(ss));
+   // Another precision, order or family finds nothing in the stream:
+   ss.clear();
+   ss.seekg(0);
+   BOOST_CHECK(!(gauss_kronrod<double, 19>::load_tables(ss)));
+   ss.clear();
+   ss.seekg(0);
+   BOOST_CHECK(!(gauss_kronrod<cpp_bin_float_50, 21>::load_tables(ss)));
+   ss.clear();
+   ss.seekg(0);
+   BOOST_CHECK((gauss<cpp_bin_float_50, 9>::load_tables(ss)));
+   ss.clear();
+   ss.seekg(0);
+   BOOST_CHECK(!(gauss<cpp_bin_float_50, 19>::load_tables(ss)));
+   // The tables read back exactly:
+   std::stringstream again(ss.str());
+   again.seekg(0);
+   std::getline(again, header);
+   for (unsigned i = 0; i < rule::abscissa().size(); ++i)
+   {
+      cpp_bin_float_50 x, w;
+      again >> x >> w;
+      BOOST_CHECK_EQUAL(x, rule::abscissa()[i]);
+      BOOST_CHECK_EQUAL(w, rule::weights()[i]);
+   }
+   // The tabulated rules may be saved too, though they have no use for tables read back:
+   std::stringstream tabulated;
+   gauss_kronrod<double, 15>::save_tables(tabulated);
+   BOOST_CHECK((gauss_kronrod<double, 15>::load_tables(tabulated)));
+   BOOST_CHECK_CLOSE_FRACTION((gauss_kronrod<double, 15>::integrate([](double) { return 1.0; }, -1.0, 1.0, 0)), 2.0, 1e-15);
+}
+
+// Tables for double, made from those of long double, with the weights doubled so that we can tell whether they are used:
+template <unsigned N>
+std::string doubled_tables()
+{
+   std::stringstream ld;
+   gauss_kronrod<long double, N>::save_tables(ld);
+   std::stringstream result;
+   result.precision(std::numeric_limits<double>::max_digits10);
+   std::string line;
+   while (std::getline(ld, line))
+   {
+      std::istringstream header(line);
+      std::string family;
+      unsigned points;
+      int digits;
+      unsigned rows;
+      header >> family >> points >> digits >> rows;
+      result << family << " " << points << " " << std::numeric_limits<double>::digits << " " << rows << " " << typeid(double).name() << "\n";
+      for (unsigned i = 0; i < rows; ++i)
+      {
+         long double x, w;
+         ld >> x >> w;
+         result << static_cast<double>(x) << " " << static_cast<double>(2 * w) << "\n";
+      }
+      ld.ignore(1024, '\n');
+   }
+   return result.str();
+}
+
+void test_load_before_use()
+{
+   std::cout << "Testing tables read before their first use\n";
+   // The tables read are taken in place of computing them:
+   std::stringstream ss(doubled_tables<23>());
+   BOOST_CHECK((gauss_kronrod<double, 23>::load_tables(ss)));
+   double error;
+   double Q = gauss_kronrod<double, 23>::integrate([](double) { return 1.0; }, -1.0, 1.0, 0, 0.0, &error);
+   BOOST_CHECK_CLOSE_FRACTION(Q, 4.0, 1e-15);
+   BOOST_CHECK_CLOSE_FRACTION((gauss<double, 11>::integrate([](double) { return 1.0; })), 4.0, 1e-15);
+   // But never replace tables already in use:
+   gauss_kronrod<double, 17>::precompute();
+   std::stringstream late(doubled_tables<17>());
+   BOOST_CHECK((gauss_kronrod<double, 17>::load_tables(late)));
+   Q = gauss_kronrod<double, 17>::integrate([](double) { return 1.0; }, -1.0, 1.0, 0, 0.0, &error);
+   BOOST_CHECK_CLOSE_FRACTION(Q, 2.0, 1e-15);
+   // One stream may hold the tables of many rules and types:
+   std::stringstream many;
+   gauss_kronrod<cpp_bin_float_50, 27>::save_tables(many);
+   many << doubled_tables<25>();
+   gauss<long double, 13>::save_tables(many);
+   many.seekg(0);
+   BOOST_CHECK((gauss_kronrod<double, 25>::load_tables(many)));
+   Q = gauss_kronrod<double, 25>::integrate([](double) { return 1.0; }, -1.0, 1.0, 0, 0.0, &error);
+   BOOST_CHECK_CLOSE_FRACTION(Q, 4.0, 1e-15);
+   // A malformed stream is no worse than an empty one:
+   std::stringstream bad(std::string("gauss_kronrod 29 53 15 ") + typeid(double).name() + "\n0.5 0.25\n");
+   BOOST_CHECK(!(gauss_kronrod<double, 29>::load_tables(bad)));
+   BOOST_CHECK_CLOSE_FRACTION((gauss_kronrod<double, 29>::integrate([](double) { return 1.0; }, -1.0, 1.0, 0, 0.0, &error)), 2.0, 1e-15);
+}
+
+void test_threads()
+{
+   std::cout << "Testing tables computed by many threads at once\n";
+   typedef gauss_kronrod<cpp_bin_float_50, 33> rule;
+   std::vector<std::thread> threads;
+   std::vector<const cpp_bin_float_50*> data(8);
+   for (unsigned t = 0; t < data.size(); ++t)
+   {
+      threads.emplace_back([&data, t]() { rule::precompute(); data[t] = rule::weights().data(); });
+   }
+   for (auto& t : threads)
+   {
+      t.join();
+   }
+   for (auto p : data)
+   {
+      BOOST_CHECK_EQUAL(p, data[0]);
+   }
+   BOOST_CHECK_EQUAL(rule::weights().data(), data[0]);
+   cpp_bin_float_50 Q = rule::integrate([](const cpp_bin_float_50& x) { return exp(x); }, cpp_bin_float_50(0), cpp_bin_float_50(1));
+   BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::constants::e<cpp_bin_float_50>() - 1, 1e-45);
+}
+
+BOOST_AUTO_TEST_CASE(gauss_tables_test)
+{
+   test_round_trip();
+   test_load_before_use();
+   test_threads();
+}
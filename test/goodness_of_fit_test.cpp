@@ -0,0 +1,111 @@
+/*
+ * Copyright Nick Thompson, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <execution>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/statistics/goodness_of_fit.hpp>
+#include <boost/math/statistics/anderson_darling.hpp>
+
+using boost::math::statistics::kolmogorov_smirnov_statistic;
+using boost::math::statistics::cramer_von_mises_statistic;
+using boost::math::statistics::anderson_darling_normality_statistic;
+
+template<typename Real>
+void test_uniform()
+{
+    // Against the uniform distribution on [0, 1], the ecdf of {0.1, 0.4, 0.7} is furthest from the cdf just after 0.7,
+    // and W^2 = 1/36 + (1/15)^2 + (1/10)^2 + (2/15)^2 = 3/50:
+    std::vector<Real> v{Real(1)/10, Real(4)/10, Real(7)/10};
+    auto F = [](Real x) { return x; };
+    CHECK_ULP_CLOSE(Real(3)/10, kolmogorov_smirnov_statistic(v, F), 4);
+    CHECK_ULP_CLOSE(Real(3)/Real(50), cramer_von_mises_statistic(v, F), 16);
+    std::vector<Real> w{Real(7)/10, Real(1)/10, Real(4)/10};
+    CHECK_ULP_CLOSE(kolmogorov_smirnov_statistic(v, F), kolmogorov_smirnov_statistic(std::execution::par, w, F), 0);
+    CHECK_ULP_CLOSE(cramer_von_mises_statistic(v, F), cramer_von_mises_statistic(std::execution::par, w, F), 0);
+
+    bool thrown = false;
+    try {
+        kolmogorov_smirnov_statistic(w, F);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+template<typename Real>
+void test_normal()
+{
+    std::mt19937 gen{99};
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(50000);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    boost::math::normal_distribution<Real> N(0, 1);
+    auto F = [&](Real x) { return cdf(N, x); };
+    std::vector<Real> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+
+    Real D = kolmogorov_smirnov_statistic(std::execution::par, v, F);
+    CHECK_ULP_CLOSE(kolmogorov_smirnov_statistic(sorted, F), D, 0);
+    // sqrt(n) D and W^2 have limiting distributions of order one under the null hypothesis:
+    CHECK_EQUAL(true, sqrt(Real(v.size()))*D < 2);
+    Real W = cramer_von_mises_statistic(std::execution::par, v, F);
+    CHECK_MOLLIFIED_CLOSE(cramer_von_mises_statistic(sorted, F), W, 16*std::numeric_limits<Real>::epsilon());
+    CHECK_EQUAL(true, W < 1);
+
+    // A shifted hypothesis is rejected decisively:
+    boost::math::normal_distribution<Real> M(Real(0.5), 1);
+    auto G = [&](Real x) { return cdf(M, x); };
+    CHECK_EQUAL(true, sqrt(Real(v.size()))*kolmogorov_smirnov_statistic(std::execution::par, v, G) > 10);
+    CHECK_EQUAL(true, cramer_von_mises_statistic(std::execution::par, v, G) > 100);
+
+    // Integer data are handled in double precision:
+    std::vector<int> counts{3, 1, 2, 0};
+    CHECK_ULP_CLOSE(0.25, kolmogorov_smirnov_statistic(std::execution::seq, counts, [](int k) { return (k + 1)/4.0; }), 0);
+}
+
+// Long enough that the parallel radix sort splits the sample into several blocks when there are several hardware threads;
+// every execution policy must then give the same statistics:
+template<typename Real>
+void test_policies_agree()
+{
+    std::mt19937 gen{314};
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(1 << 19);
+    for (auto & x : v) {
+        x = dis(gen);
+    }
+    boost::math::normal_distribution<Real> N(0, 1);
+    auto F = [&](Real x) { return cdf(N, x); };
+    CHECK_ULP_CLOSE(kolmogorov_smirnov_statistic(std::execution::seq, v, F), kolmogorov_smirnov_statistic(std::execution::par, v, F), 0);
+    CHECK_ULP_CLOSE(cramer_von_mises_statistic(std::execution::seq, v, F), cramer_von_mises_statistic(std::execution::par, v, F), 0);
+    CHECK_ULP_CLOSE(anderson_darling_normality_statistic(std::execution::seq, v, Real(0), Real(1)),
+                    anderson_darling_normality_statistic(std::execution::par, v, Real(0), Real(1)), 0);
+    CHECK_ULP_CLOSE(anderson_darling_normality_statistic(std::execution::seq, v), anderson_darling_normality_statistic(std::execution::par, v), 0);
+
+    std::vector<Real> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    CHECK_ULP_CLOSE(kolmogorov_smirnov_statistic(sorted, F), kolmogorov_smirnov_statistic(std::execution::par, v, F), 0);
+}
+
+int main()
+{
+    test_uniform<float>();
+    test_uniform<double>();
+    test_uniform<long double>();
+    test_normal<float>();
+    test_normal<double>();
+    test_policies_agree<float>();
+    test_policies_agree<double>();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,108 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+   static const boost::array<boost::array<typename table_type<T>::type, 3>, 100> hurwitz_zeta_data = {{
+      {{ SC_(-3.5), SC_(0.015625), SC_(0.004878277977480429489339621942648779784730) }}, 
+      {{ SC_(-3.5), SC_(0.390625), SC_(-0.0006980211771646139793176017209625274561780) }}, 
+      {{ SC_(-3.5), SC_(0.65625), SC_(-0.005725193961597737139548083248283782577189) }}, 
+      {{ SC_(-3.5), SC_(1.015625), SC_(0.004877801140322226364339621942648779784730) }}, 
+      {{ SC_(-3.5), SC_(1.640625), SC_(-0.2162080497795559730554354665098494634594) }}, 
+      {{ SC_(-3.5), SC_(4.125), SC_(-69.44074751332091762811136964888813825424) }}, 
+      {{ SC_(-3.5), SC_(4.234375), SC_(-79.61646218016934173864168349567785255083) }}, 
+      {{ SC_(-3.5), SC_(5.5), SC_(-302.4483415221808419020035566167707906758) }}, 
+      {{ SC_(-3.5), SC_(5.640625), SC_(-343.1497710367203732450026888311948233014) }}, 
+      {{ SC_(-3.5), SC_(6.1875), SC_(-543.3290602496029786704715991452103675696) }}, 
+      {{ SC_(-3.5), SC_(6.28125), SC_(-585.1965139768918333579156124172924059538) }}, 
+      {{ SC_(-3.5), SC_(6.703125), SC_(-805.5371683690876990204319829938789645379) }}, 
+      {{ SC_(-3.5), SC_(6.890625), SC_(-921.9688154937453351703519199925134302819) }}, 
+      {{ SC_(-3.5), SC_(7.265625), SC_(-1193.759270610918203342364911267774283215) }}, 
+      {{ SC_(-3.5), SC_(7.71875), SC_(-1600.936538795728830069897385315424107384) }}, 
+      {{ SC_(-3.5), SC_(8.203125), SC_(-2147.671514107480543006763667610301371960) }}, 
+      {{ SC_(-3.5), SC_(8.75), SC_(-2928.392727130186739841850956185904285396) }}, 
+      {{ SC_(-3.5), SC_(8.859375), SC_(-3107.980198193343458459565878385750999462) }}, 
+      {{ SC_(-3.5), SC_(9.140625), SC_(-3609.209559030924855387254496878150141057) }}, 
+      {{ SC_(-3.5), SC_(9.859375), SC_(-5177.696389660740085254808403320471702154) }}, 
+      {{ SC_(-0.5), SC_(0.15625), SC_(0.06563196422007631295678836424753669695873) }}, 
+      {{ SC_(-0.5), SC_(0.546875), SC_(0.04543739319140621853173378387779509788847) }}, 
+      {{ SC_(-0.5), SC_(3.140625), SC_(-2.847895563858753341734979683583918511002) }}, 
+      {{ SC_(-0.5), SC_(3.6875), SC_(-3.782239437102437577613492780350019934900) }}, 
+      {{ SC_(-0.5), SC_(3.8125), SC_(-4.007802986465422792414078818692241322612) }}, 
+      {{ SC_(-0.5), SC_(3.875), SC_(-4.122195070128764029878823085448917202586) }}, 
+      {{ SC_(-0.5), SC_(5.0625), SC_(-6.487259558198265792876536902637366137787) }}, 
+      {{ SC_(-0.5), SC_(5.484375), SC_(-7.409325272931833550923551350304553504099) }}, 
+      {{ SC_(-0.5), SC_(5.65625), SC_(-7.796493855815022470422576565131792416179) }}, 
+      {{ SC_(-0.5), SC_(5.75), SC_(-8.010422211221642966464257970748644729710) }}, 
+      {{ SC_(-0.5), SC_(6.0), SC_(-8.590218572419116604755615459843895983179) }}, 
+      {{ SC_(-0.5), SC_(6.84375), SC_(-10.64365133091887782992765157980961865812) }}, 
+      {{ SC_(-0.5), SC_(7.078125), SC_(-11.23953461635479092020808383577312176001) }}, 
+      {{ SC_(-0.5), SC_(8.234375), SC_(-14.33242666269839111636628274307753760294) }}, 
+      {{ SC_(-0.5), SC_(8.375), SC_(-14.72535464606178727438030045545250145817) }}, 
+      {{ SC_(-0.5), SC_(8.9375), SC_(-16.33197849715392874626427680729993830774) }}, 
+      {{ SC_(-0.5), SC_(8.984375), SC_(-16.46834681368064436496696837231606058747) }}, 
+      {{ SC_(-0.5), SC_(9.09375), SC_(-16.78800392291878483222538756377059677089) }}, 
+      {{ SC_(-0.5), SC_(9.203125), SC_(-17.10970058977734965411425897760224680870) }}, 
+      {{ SC_(-0.5), SC_(9.625), SC_(-18.36940417598200631971312257898112013362) }}, 
+      {{ SC_(0.5), SC_(0.578125), SC_(-0.7787113706707869312296626822805456842988) }}, 
+      {{ SC_(0.5), SC_(1.5625), SC_(-2.079148727035864134767672494310849721880) }}, 
+      {{ SC_(0.5), SC_(1.578125), SC_(-2.093903269113645242364729546108019643668) }}, 
+      {{ SC_(0.5), SC_(1.765625), SC_(-2.263809934232956185868728099013502847820) }}, 
+      {{ SC_(0.5), SC_(2.015625), SC_(-2.472920077321686121448831533529883894384) }}, 
+      {{ SC_(0.5), SC_(3.5), SC_(-3.468064318756127318181161372234161082395) }}, 
+      {{ SC_(0.5), SC_(3.640625), SC_(-3.548064946918102030710302574125887532397) }}, 
+      {{ SC_(0.5), SC_(3.828125), SC_(-3.652028479815678772971912906750933303663) }}, 
+      {{ SC_(0.5), SC_(4.046875), SC_(-3.769722332049532190065400647066089042199) }}, 
+      {{ SC_(0.5), SC_(5.34375), SC_(-4.403649537544311487162995105220132989335) }}, 
+      {{ SC_(0.5), SC_(5.359375), SC_(-4.410734025498948197149447673803962000203) }}, 
+      {{ SC_(0.5), SC_(5.65625), SC_(-4.543247657168596594909558989318344682607) }}, 
+      {{ SC_(0.5), SC_(5.8125), SC_(-4.611467144300608322390306405650101889908) }}, 
+      {{ SC_(0.5), SC_(6.140625), SC_(-4.751549856190305286499133550444969454885) }}, 
+      {{ SC_(0.5), SC_(6.671875), SC_(-4.970006598497598770306501684966612267801) }}, 
+      {{ SC_(0.5), SC_(7.546875), SC_(-5.310301401540471558059195912819621187818) }}, 
+      {{ SC_(0.5), SC_(8.140625), SC_(-5.529320689814550298397585404283351777923) }}, 
+      {{ SC_(0.5), SC_(8.65625), SC_(-5.712722749802013823097070344673962363116) }}, 
+      {{ SC_(0.5), SC_(9.265625), SC_(-5.922161262164958698186640315253063776918) }}, 
+      {{ SC_(0.5), SC_(9.6875), SC_(-6.062924967151057456963536215136746374910) }}, 
+      {{ SC_(2.5), SC_(0.65625), SC_(3.353660946613896162788289530193547765639) }}, 
+      {{ SC_(2.5), SC_(1.828125), SC_(0.4039595393378285984903679810399685053148) }}, 
+      {{ SC_(2.5), SC_(3.328125), SC_(0.1375752205880109151415145641370079271938) }}, 
+      {{ SC_(2.5), SC_(3.546875), SC_(0.1233362145300896431611671098182793029256) }}, 
+      {{ SC_(2.5), SC_(3.828125), SC_(0.1083122725286712014098834444290640588167) }}, 
+      {{ SC_(2.5), SC_(4.171875), SC_(0.09368651468225068083294793369438100366514) }}, 
+      {{ SC_(2.5), SC_(4.1875), SC_(0.09310033825992871772735655924039466515987) }}, 
+      {{ SC_(2.5), SC_(4.59375), SC_(0.07975628191760898540056751108122604027091) }}, 
+      {{ SC_(2.5), SC_(5.0), SC_(0.06931053204432188037776429387773793728543) }}, 
+      {{ SC_(2.5), SC_(5.71875), SC_(0.05560337466209201175561083285692457677785) }}, 
+      {{ SC_(2.5), SC_(6.078125), SC_(0.05035254769243300764381369879073255339844) }}, 
+      {{ SC_(2.5), SC_(6.328125), SC_(0.04716713450826888686569224345879511967569) }}, 
+      {{ SC_(2.5), SC_(7.75), SC_(0.03405021995854089463539686470679704032572) }}, 
+      {{ SC_(2.5), SC_(7.78125), SC_(0.03383209719687096795315244492260523406646) }}, 
+      {{ SC_(2.5), SC_(8.3125), SC_(0.03045220459836396285968311013087244309033) }}, 
+      {{ SC_(2.5), SC_(8.53125), SC_(0.02922053053587216409016142584255822765274) }}, 
+      {{ SC_(2.5), SC_(8.890625), SC_(0.02736897664260635563323843590562883792166) }}, 
+      {{ SC_(2.5), SC_(9.015625), SC_(0.02677028713711929800148821167389529690828) }}, 
+      {{ SC_(2.5), SC_(9.046875), SC_(0.02662401526580171018419473032204313628652) }}, 
+      {{ SC_(2.5), SC_(9.703125), SC_(0.02383461488441456914101883654471002366909) }}, 
+      {{ SC_(7.25), SC_(0.25), SC_(23170.67637020106591077922168138828104447) }}, 
+      {{ SC_(7.25), SC_(0.53125), SC_(98.12736140597154274866253769447809016028) }}, 
+      {{ SC_(7.25), SC_(1.203125), SC_(0.2651794312336104817494464394630897108118) }}, 
+      {{ SC_(7.25), SC_(1.328125), SC_(0.1301758166570729211285209491190266399095) }}, 
+      {{ SC_(7.25), SC_(2.390625), SC_(0.001974455320076924217635505068375656782890) }}, 
+      {{ SC_(7.25), SC_(2.734375), SC_(0.0007689798383625304185300625167440226639781) }}, 
+      {{ SC_(7.25), SC_(4.0625), SC_(4.970906688287256052016302022139501279005e-5) }}, 
+      {{ SC_(7.25), SC_(4.25), SC_(3.652397970991045922639051202108201162858e-5) }}, 
+      {{ SC_(7.25), SC_(4.265625), SC_(3.562103904387864266996210594662766074799e-5) }}, 
+      {{ SC_(7.25), SC_(5.859375), SC_(4.166491277093747435974425252870427328367e-6) }}, 
+      {{ SC_(7.25), SC_(6.984375), SC_(1.291220128780583224087024174822114697165e-6) }}, 
+      {{ SC_(7.25), SC_(7.109375), SC_(1.147795386572184030353791666131146185984e-6) }}, 
+      {{ SC_(7.25), SC_(7.625), SC_(7.218532389304109701972649953658293002800e-7) }}, 
+      {{ SC_(7.25), SC_(8.1875), SC_(4.512065262196993153426261696567737507044e-7) }}, 
+      {{ SC_(7.25), SC_(8.75), SC_(2.913757456876276084293710172475810198017e-7) }}, 
+      {{ SC_(7.25), SC_(8.765625), SC_(2.879793572413886835417686975658410918459e-7) }}, 
+      {{ SC_(7.25), SC_(8.9375), SC_(2.534927387217257946079080710751766436875e-7) }}, 
+      {{ SC_(7.25), SC_(9.671875), SC_(1.510612959811637204083245407983188351265e-7) }}, 
+      {{ SC_(7.25), SC_(9.734375), SC_(1.448262515066531196017281258475887098640e-7) }}, 
+      {{ SC_(7.25), SC_(9.96875), SC_(1.239573073437495054138721236189507508590e-7) }}
+   }};
+
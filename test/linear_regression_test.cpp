@@ -8,10 +8,16 @@
 #include "math_unit_test.hpp"
 #include <vector>
 #include <random>
+#include <utility>
+#include <execution>
 #include <boost/math/statistics/linear_regression.hpp>
 
 using boost::math::statistics::simple_ordinary_least_squares;
 using boost::math::statistics::simple_ordinary_least_squares_with_R_squared;
+using boost::math::statistics::ordinary_least_squares;
+using boost::math::statistics::weighted_least_squares;
+using boost::math::statistics::ridge_regression;
+using boost::math::statistics::least_squares_accumulator;
 
 template<typename Real>
 void test_line()
@@ -154,6 +160,187 @@ void test_scaling_relations()
 
 }
 
+// A column major design matrix of p normal predictors, and y = c_0 + c_1 x_1 + ... + noise.
+template<typename Real>
+std::pair<std::vector<Real>, std::vector<Real>> random_problem(size_t n, std::vector<Real> const & c, Real noise, unsigned seed)
+{
+    size_t p = c.size() - 1;
+    std::mt19937_64 gen{seed};
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> X(n*p);
+    std::vector<Real> y(n);
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = c[0] + noise*dis(gen);
+        for (size_t j = 0; j < p; ++j) {
+            X[j*n + i] = (j + 1)*dis(gen) + j;
+            y[i] += c[j + 1]*X[j*n + i];
+        }
+    }
+    return std::make_pair(X, y);
+}
+
+template<typename Real>
+void test_multiple_regression()
+{
+    std::vector<Real> c{2, -3, 0.5, 1, 7};
+    auto [X, y] = random_problem<Real>(500, c, Real(0), 1);
+    auto fit = ordinary_least_squares(X, y);
+    Real tol = 256*std::numeric_limits<Real>::epsilon();
+    CHECK_EQUAL(c.size(), fit.coefficients.size());
+    for (size_t j = 0; j < c.size(); ++j) {
+        CHECK_MOLLIFIED_CLOSE(c[j], fit.coefficients[j], tol);
+    }
+    CHECK_MOLLIFIED_CLOSE(Real(1), fit.R_squared, tol);
+    CHECK_EQUAL(Real(500 - 5), fit.degrees_of_freedom);
+
+    // A single predictor reproduces simple_ordinary_least_squares, and the textbook standard errors:
+    auto [x, y1] = random_problem<Real>(300, std::vector<Real>{1, 2}, Real(1), 2);
+    auto [c0, c1, Rsquared] = simple_ordinary_least_squares_with_R_squared(x, y1);
+    auto simple = ordinary_least_squares(x, y1);
+    CHECK_MOLLIFIED_CLOSE(c0, simple.coefficients[0], tol);
+    CHECK_MOLLIFIED_CLOSE(c1, simple.coefficients[1], tol);
+    CHECK_MOLLIFIED_CLOSE(Rsquared, simple.R_squared, tol);
+    Real mu_x = boost::math::statistics::mean(x);
+    Real Sxx = 0;
+    Real rss = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        Sxx += (x[i] - mu_x)*(x[i] - mu_x);
+        Real e = y1[i] - c0 - c1*x[i];
+        rss += e*e;
+    }
+    Real sigma_sq = rss/(x.size() - 2);
+    CHECK_MOLLIFIED_CLOSE(rss, simple.residual_sum_of_squares, 10*tol);
+    CHECK_MOLLIFIED_CLOSE(sqrt(sigma_sq/Sxx), simple.standard_errors[1], 10*tol);
+    CHECK_MOLLIFIED_CLOSE(sqrt(sigma_sq*(1/Real(x.size()) + mu_x*mu_x/Sxx)), simple.standard_errors[0], 10*tol);
+    CHECK_MOLLIFIED_CLOSE(c1/simple.standard_errors[1], simple.t_statistics[1], 10*tol);
+
+    // Collinear predictors:
+    std::vector<Real> Xc(X.begin(), X.begin() + 500);
+    Xc.insert(Xc.end(), X.begin(), X.begin() + 500);
+    bool thrown = false;
+    try {
+        ordinary_least_squares(Xc, y);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+template<typename Real>
+void test_streaming_and_parallel()
+{
+    std::vector<Real> c{-1, 4, 0.25};
+    size_t n = 20000;
+    auto [X, y] = random_problem<Real>(n, c, Real(0.5), 3);
+    auto fit = ordinary_least_squares(X, y);
+    // The Gram matrix is built from fixed chunks, so the policy cannot change the answer:
+    auto par_fit = ordinary_least_squares(std::execution::par, X, y);
+    for (size_t j = 0; j < c.size(); ++j) {
+        CHECK_ULP_CLOSE(fit.coefficients[j], par_fit.coefficients[j], 0);
+        CHECK_ULP_CLOSE(fit.standard_errors[j], par_fit.standard_errors[j], 0);
+    }
+
+    // Rows pushed one at a time into one accumulator, and blocks pushed into another and merged:
+    Real tol = 4096*std::numeric_limits<Real>::epsilon();
+    least_squares_accumulator<Real> rows(2);
+    least_squares_accumulator<Real> a(2);
+    least_squares_accumulator<Real> b(2);
+    for (size_t i = 0; i < n; ++i) {
+        std::vector<Real> x{X[i], X[n + i]};
+        rows.push(x, y[i]);
+        if (i >= 7000) {
+            b.push(x, y[i]);
+        }
+    }
+    std::vector<Real> head(2*7000);
+    std::copy(X.begin(), X.begin() + 7000, head.begin());
+    std::copy(X.begin() + n, X.begin() + n + 7000, head.begin() + 7000);
+    a.push(head, std::vector<Real>(y.begin(), y.begin() + 7000));
+    a.merge(b);
+    CHECK_EQUAL(n, a.count());
+    auto streamed = rows.fit();
+    auto merged = a.fit();
+    for (size_t j = 0; j < c.size(); ++j) {
+        CHECK_MOLLIFIED_CLOSE(fit.coefficients[j], streamed.coefficients[j], tol);
+        CHECK_MOLLIFIED_CLOSE(fit.coefficients[j], merged.coefficients[j], tol);
+        CHECK_MOLLIFIED_CLOSE(fit.standard_errors[j], merged.standard_errors[j], tol);
+    }
+    CHECK_MOLLIFIED_CLOSE(fit.R_squared, merged.R_squared, tol);
+
+    // Many small problems at once:
+    std::vector<std::pair<std::vector<Real>, std::vector<Real>>> problems;
+    for (unsigned i = 0; i < 50; ++i) {
+        problems.push_back(random_problem<Real>(40, c, Real(0.5), 100 + i));
+    }
+    std::vector<boost::math::statistics::least_squares_fit<Real>> fits(problems.size());
+    ordinary_least_squares(std::execution::par, problems.begin(), problems.end(), fits.begin());
+    for (size_t i = 0; i < problems.size(); ++i) {
+        auto expected = ordinary_least_squares(problems[i].first, problems[i].second);
+        CHECK_ULP_CLOSE(expected.coefficients[1], fits[i].coefficients[1], 0);
+        CHECK_ULP_CLOSE(expected.t_statistics[2], fits[i].t_statistics[2], 0);
+    }
+}
+
+template<typename Real>
+void test_weighted_and_ridge()
+{
+    std::vector<Real> c{3, 1, -2};
+    size_t n = 200;
+    auto [X, y] = random_problem<Real>(n, c, Real(1), 4);
+    Real tol = 1024*std::numeric_limits<Real>::epsilon();
+
+    // Integer weights are the same as repeated observations:
+    std::vector<Real> w(n);
+    std::vector<Real> Xr;
+    std::vector<Real> yr;
+    for (size_t i = 0; i < n; ++i) {
+        w[i] = i % 3;
+    }
+    for (size_t j = 0; j < 2; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t k = 0; k < w[i]; ++k) {
+                Xr.push_back(X[j*n + i]);
+            }
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < w[i]; ++k) {
+            yr.push_back(y[i]);
+        }
+    }
+    auto weighted = weighted_least_squares(X, y, w);
+    auto repeated = ordinary_least_squares(Xr, yr);
+    for (size_t j = 0; j < c.size(); ++j) {
+        CHECK_MOLLIFIED_CLOSE(repeated.coefficients[j], weighted.coefficients[j], tol);
+    }
+    CHECK_MOLLIFIED_CLOSE(repeated.residual_sum_of_squares, weighted.residual_sum_of_squares, tol);
+
+    // The ridge solution satisfies X_c^T(y_c - X_c b) = lambda b, where the subscript denotes centering:
+    Real lambda = 50;
+    auto ridge = ridge_regression(X, y, lambda);
+    auto ols = ordinary_least_squares(X, y);
+    auto zero_ridge = ridge_regression(X, y, Real(0));
+    CHECK_ULP_CLOSE(ols.coefficients[1], zero_ridge.coefficients[1], 0);
+    Real rss = 0;
+    std::vector<Real> gradient(2, Real(0));
+    std::vector<Real> mu(2);
+    for (size_t j = 0; j < 2; ++j) {
+        mu[j] = boost::math::statistics::mean(X.begin() + j*n, X.begin() + (j + 1)*n);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        Real e = y[i] - ridge.coefficients[0] - ridge.coefficients[1]*X[i] - ridge.coefficients[2]*X[n + i];
+        rss += e*e;
+        for (size_t j = 0; j < 2; ++j) {
+            gradient[j] += (X[j*n + i] - mu[j])*e;
+        }
+    }
+    for (size_t j = 0; j < 2; ++j) {
+        CHECK_MOLLIFIED_CLOSE(lambda*ridge.coefficients[j + 1], gradient[j], 10*tol);
+        CHECK_EQUAL(true, abs(ridge.coefficients[j + 1]) < abs(ols.coefficients[j + 1]));
+    }
+    CHECK_MOLLIFIED_CLOSE(rss, ridge.residual_sum_of_squares, tol);
+}
 
 int main()
 {
@@ -172,5 +359,12 @@ int main()
     test_scaling_relations<float>();
     test_scaling_relations<double>();
     test_scaling_relations<long double>();
+
+    test_multiple_regression<double>();
+    test_multiple_regression<long double>();
+    test_streaming_and_parallel<float>();
+    test_streaming_and_parallel<double>();
+    test_weighted_and_ridge<double>();
+    test_weighted_and_ridge<long double>();
     return boost::math::test::report_errors();
 }
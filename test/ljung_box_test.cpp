@@ -9,9 +9,11 @@
 #include <numeric>
 #include <utility>
 #include <random>
+#include <execution>
 #include <boost/math/statistics/ljung_box.hpp>
 
 using boost::math::statistics::ljung_box;
+using boost::math::statistics::box_pierce;
 
 template<class Real>
 void test_trivial()
@@ -46,9 +48,71 @@ void test_agreement_with_mathematica()
   CHECK_ULP_CLOSE(expected_pvalue, computed_pvalue, 3);
 }
 
+void test_box_pierce()
+{
+  std::vector<double> v{0.7739928761039216,-0.4468259278452086,0.98287381303903,-0.3943029116201079,0.6569015496559457};
+  auto [Q, p] = box_pierce(v, 2);
+  auto [Qlb, plb] = ljung_box(v, 2);
+  // Q_BP = n sum rho_k^2 and Q_LB = n(n+2) sum rho_k^2/(n-k), so with n = 5 and two lags
+  // (for two degrees of freedom the chi-squared survival function is exp(-Q/2)):
+  double mu = 0;
+  for (auto x : v) { mu += x; }
+  mu /= v.size();
+  double r0 = 0, r1 = 0, r2 = 0;
+  for (size_t t = 0; t < v.size(); ++t) {
+    r0 += (v[t] - mu)*(v[t] - mu);
+    if (t >= 1) { r1 += (v[t] - mu)*(v[t-1] - mu); }
+    if (t >= 2) { r2 += (v[t] - mu)*(v[t-2] - mu); }
+  }
+  double rho1 = r1/r0;
+  double rho2 = r2/r0;
+  CHECK_ULP_CLOSE(5*(rho1*rho1 + rho2*rho2), Q, 8);
+  CHECK_ULP_CLOSE(35*(rho1*rho1/4 + rho2*rho2/3), Qlb, 8);
+  CHECK_ULP_CLOSE(std::exp(-Q/2), p, 16);
+  CHECK_EQUAL(true, Q < Qlb);
+  CHECK_EQUAL(true, plb < p);
+}
+
+void test_batch()
+{
+  std::mt19937 gen(77);
+  std::normal_distribution<double> dis(0, 1);
+  std::vector<std::vector<double>> series(200);
+  for (auto & s : series) {
+    s.resize(500 + gen() % 500);
+    for (auto & x : s) { x = dis(gen); }
+  }
+  std::vector<std::pair<double, double>> lb(series.size());
+  std::vector<std::pair<double, double>> bp(series.size());
+  ljung_box(std::execution::par, series.begin(), series.end(), lb.begin(), 10, 1);
+  box_pierce(std::execution::seq, series.begin(), series.end(), bp.begin());
+  for (size_t i = 0; i < series.size(); ++i) {
+    auto expected = ljung_box(series[i], 10, 1);
+    CHECK_EQUAL(expected.first, lb[i].first);
+    CHECK_EQUAL(expected.second, lb[i].second);
+    CHECK_EQUAL(box_pierce(series[i]).first, bp[i].first);
+  }
+}
+
+void test_many_lags()
+{
+  // Enough lags that the autocorrelations are computed by FFT:
+  std::mt19937 gen(5);
+  std::normal_distribution<double> dis(0, 1);
+  std::vector<double> v(20000);
+  for (auto & x : v) { x = dis(gen); }
+  auto [Q, p] = ljung_box(v, 400);
+  // White noise: Q is approximately chi-squared with 400 degrees of freedom.
+  CHECK_EQUAL(true, Q > 300 && Q < 500);
+  CHECK_EQUAL(true, p > 0.001);
+}
+
 int main()
 {
     test_trivial<double>();
     test_agreement_with_mathematica();
+    test_box_pierce();
+    test_batch();
+    test_many_lags();
     return boost::math::test::report_errors();
 }
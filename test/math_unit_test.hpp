@@ -120,6 +120,20 @@ bool check_ulp_close(PreciseReal expected1, Real computed, size_t ulps, std::str
 }
 
 
+template<class T>
+bool check_equal(T const & expected, T const & computed, std::string const & filename, std::string const & function, int line)
+{
+    if (!(expected == computed)) {
+        std::ios_base::fmtflags f( std::cerr.flags() );
+        std::cerr << "\033[0;31mError at " << filename << ":" << function << ":" << line << "\n"
+                  << " \033[0m Condition '" << expected << " == " << computed << "' is not satisfied.\n";
+        std::cerr.flags(f);
+        ++detail::global_error_count;
+        return false;
+    }
+    return true;
+}
+
 int report_errors()
 {
     if (detail::global_error_count > 0)
@@ -147,4 +161,6 @@ int report_errors()
 
 #define CHECK_ULP_CLOSE(X, Y, Z) boost::math::test::check_ulp_close((X), (Y), (Z), __FILE__, __func__, __LINE__)
 
+#define CHECK_EQUAL(X, Y) boost::math::test::check_equal((X), (Y), __FILE__, __func__, __LINE__)
+
 #endif
@@ -0,0 +1,103 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+   static const boost::array<boost::array<typename table_type<T>::type, 3>, 95> polylog_data = {{
+      {{ SC_(-2.5), SC_(-1.921875), SC_(0.1147917696373120500549581128349602927981) }}, 
+      {{ SC_(-2.5), SC_(-1.5), SC_(0.1135237675631993888597287841786622710262) }}, 
+      {{ SC_(-2.5), SC_(-1.296875), SC_(0.1075905072177145174599803912375985629542) }}, 
+      {{ SC_(-2.5), SC_(-1.265625), SC_(0.1062192654588553490608233433921285293220) }}, 
+      {{ SC_(-2.5), SC_(-1.21875), SC_(0.1038902617920787388543356061061459679828) }}, 
+      {{ SC_(-2.5), SC_(-1.15625), SC_(0.1002313448784268251396742656321500102970) }}, 
+      {{ SC_(-2.5), SC_(-1.03125), SC_(0.09073074460983794540982572752961897459145) }}, 
+      {{ SC_(-2.5), SC_(-0.75), SC_(0.05561665029156306588006536522978449902740) }}, 
+      {{ SC_(-2.5), SC_(-0.625), SC_(0.03246726110841454907455737913881400784229) }}, 
+      {{ SC_(-2.5), SC_(-0.28125), SC_(-0.04800477021841231111993312689312070627660) }}, 
+      {{ SC_(-2.5), SC_(-0.125), SC_(-0.06066754105291732852813183711654004644296) }}, 
+      {{ SC_(-2.5), SC_(0.0625), SC_(0.08895024086077185810556562436024745938288) }}, 
+      {{ SC_(-2.5), SC_(0.296875), SC_(1.685466322518764802380503759576812724940) }}, 
+      {{ SC_(-2.5), SC_(0.421875), SC_(5.568762998049102066829464938775052638826) }}, 
+      {{ SC_(-2.5), SC_(0.546875), SC_(19.46425079460005262057180057314352501226) }}, 
+      {{ SC_(-2.5), SC_(0.5625), SC_(23.00811898442123560390308511286879527086) }}, 
+      {{ SC_(-2.5), SC_(0.6875), SC_(103.2138281593928119967716990897800592912) }}, 
+      {{ SC_(-2.5), SC_(0.765625), SC_(337.6281888014173282904894329636803281530) }}, 
+      {{ SC_(-2.5), SC_(0.828125), SC_(1140.917841166158353552140885121876964104) }}, 
+      {{ SC_(0.5), SC_(-2.0), SC_(-0.8912887115521233019815195555082808768514) }}, 
+      {{ SC_(0.5), SC_(-1.921875), SC_(-0.8738928879723992369985903522623789651345) }}, 
+      {{ SC_(0.5), SC_(-1.84375), SC_(-0.8558568328213114058685877622083090091948) }}, 
+      {{ SC_(0.5), SC_(-1.734375), SC_(-0.8294479810020422411538354838338044497545) }}, 
+      {{ SC_(0.5), SC_(-1.609375), SC_(-0.7974548457960579187985668361884343254502) }}, 
+      {{ SC_(0.5), SC_(-1.578125), SC_(-0.7891299061911695959200145272455921572944) }}, 
+      {{ SC_(0.5), SC_(-1.515625), SC_(-0.7720608966514196202647243708754244638260) }}, 
+      {{ SC_(0.5), SC_(-1.46875), SC_(-0.7588757328234251114367784221098847224290) }}, 
+      {{ SC_(0.5), SC_(-1.453125), SC_(-0.7544046728218886013897690956964449808712) }}, 
+      {{ SC_(0.5), SC_(-0.953125), SC_(-0.5867884795195820597525104843690438708502) }}, 
+      {{ SC_(0.5), SC_(-0.9375), SC_(-0.5806182717998089093233891946259236606930) }}, 
+      {{ SC_(0.5), SC_(-0.625), SC_(-0.4406590886319162784752005419323630456601) }}, 
+      {{ SC_(0.5), SC_(-0.53125), SC_(-0.3911882185128383050555017638176761576486) }}, 
+      {{ SC_(0.5), SC_(-0.4375), SC_(-0.3373133370794834388754356409461387126272) }}, 
+      {{ SC_(0.5), SC_(-0.34375), SC_(-0.2783005554538727793024471662543793543659) }}, 
+      {{ SC_(0.5), SC_(-0.234375), SC_(-0.2017175343027367496665200514663216386566) }}, 
+      {{ SC_(0.5), SC_(0.109375), SC_(0.1186688032115640013443104694242806196606) }}, 
+      {{ SC_(0.5), SC_(0.265625), SC_(0.3296073993693220469646082332693906340649) }}, 
+      {{ SC_(0.5), SC_(0.609375), SC_(1.157767669808936458916749487187472829860) }}, 
+      {{ SC_(0.5), SC_(0.90625), SC_(4.209211320133202158178409125445512097773) }}, 
+      {{ SC_(2), SC_(-1.96875), SC_(-1.419527553794129800037122252757667632286) }}, 
+      {{ SC_(2), SC_(-1.828125), SC_(-1.340693417716654031832720229284892027394) }}, 
+      {{ SC_(2), SC_(-1.71875), SC_(-1.277777085389877679508884366539832221623) }}, 
+      {{ SC_(2), SC_(-1.40625), SC_(-1.089483391430232462906906038951167684829) }}, 
+      {{ SC_(2), SC_(-1.3125), SC_(-1.030280436955507239274751458632448876507) }}, 
+      {{ SC_(2), SC_(-1.28125), SC_(-1.010242974157221185196249202439802683532) }}, 
+      {{ SC_(2), SC_(-1.203125), SC_(-0.9594577595049084529175052469092805146709) }}, 
+      {{ SC_(2), SC_(-0.65625), SC_(-0.5717591651905364287601008183669058897385) }}, 
+      {{ SC_(2), SC_(-0.1875), SC_(-0.1793743199474604640254624448516471993097) }}, 
+      {{ SC_(2), SC_(-0.046875), SC_(-0.04633683470460891931211551960689383696867) }}, 
+      {{ SC_(2), SC_(-0.03125), SC_(-0.03100919177917202458490653953364632394624) }}, 
+      {{ SC_(2), SC_(0.03125), SC_(0.03149759229023015788540392887771405766100) }}, 
+      {{ SC_(2), SC_(0.109375), SC_(0.1125207272670350946024286516563469114978) }}, 
+      {{ SC_(2), SC_(0.171875), SC_(0.1798857671425139321826716874140129569806) }}, 
+      {{ SC_(2), SC_(0.25), SC_(0.2676526390827326069191838284878115758199) }}, 
+      {{ SC_(2), SC_(0.265625), SC_(0.2857227466814108035614866748568592232163) }}, 
+      {{ SC_(2), SC_(0.484375), SC_(0.5607275755381622436831092939577486819620) }}, 
+      {{ SC_(2), SC_(0.53125), SC_(0.6261778221724860072555993673856019985881) }}, 
+      {{ SC_(2), SC_(0.765625), SC_(1.007709721029953682862161424047548190144) }}, 
+      {{ SC_(2), SC_(0.953125), SC_(1.450576783892041985731282813697226307847) }}, 
+      {{ SC_(3.5), SC_(-1.921875), SC_(-1.688482804584572718626639752908306005849) }}, 
+      {{ SC_(3.5), SC_(-1.796875), SC_(-1.589395089189168113779528889232324205865) }}, 
+      {{ SC_(3.5), SC_(-1.765625), SC_(-1.564440267537455195336041885966016777265) }}, 
+      {{ SC_(3.5), SC_(-1.65625), SC_(-1.476505131979088440930365415146169358880) }}, 
+      {{ SC_(3.5), SC_(-1.515625), SC_(-1.362045412735614912316982544198565522838) }}, 
+      {{ SC_(3.5), SC_(-1.40625), SC_(-1.271885243907102777194675549294572932623) }}, 
+      {{ SC_(3.5), SC_(-1.0625), SC_(-0.9815560109393361870658438345328741160956) }}, 
+      {{ SC_(3.5), SC_(-1.046875), SC_(-0.9680921996744955170620039043678420513437) }}, 
+      {{ SC_(3.5), SC_(-0.921875), SC_(-0.8594886035693653599726929927366872798922) }}, 
+      {{ SC_(3.5), SC_(-0.796875), SC_(-0.7492343206869249389982830599672818069761) }}, 
+      {{ SC_(3.5), SC_(-0.78125), SC_(-0.7353317742415280114545297901732995011097) }}, 
+      {{ SC_(3.5), SC_(-0.5), SC_(-0.4801763979926349820449798491598374740717) }}, 
+      {{ SC_(3.5), SC_(0.125), SC_(0.1264248565862920232817109079864974276892) }}, 
+      {{ SC_(3.5), SC_(0.1875), SC_(0.1907589348722031562580987461527774681376) }}, 
+      {{ SC_(3.5), SC_(0.3125), SC_(0.3218715710021222901370931563404457217838) }}, 
+      {{ SC_(3.5), SC_(0.4375), SC_(0.4565702436359701518364959533497965312072) }}, 
+      {{ SC_(3.5), SC_(0.46875), SC_(0.4908597221243064115825450985707086551962) }}, 
+      {{ SC_(3.5), SC_(0.84375), SC_(0.9264595747379262780850093022863514362927) }}, 
+      {{ SC_(3.5), SC_(0.921875), SC_(1.024599493601730116998260802006653445050) }}, 
+      {{ SC_(6), SC_(-1.796875), SC_(-1.752606714766441436240401974587923506993) }}, 
+      {{ SC_(6), SC_(-1.75), SC_(-1.707889189649902219520751017223613833809) }}, 
+      {{ SC_(6), SC_(-1.6875), SC_(-1.648190293820498140167065438561989931151) }}, 
+      {{ SC_(6), SC_(-1.546875), SC_(-1.513547990015618892331183670204821152026) }}, 
+      {{ SC_(6), SC_(-1.453125), SC_(-1.423536513891902151162571038936928365577) }}, 
+      {{ SC_(6), SC_(-0.796875), SC_(-0.7875650225995467455176820748723311618962) }}, 
+      {{ SC_(6), SC_(-0.640625), SC_(-0.6345377399623886666957113304578520053214) }}, 
+      {{ SC_(6), SC_(-0.59375), SC_(-0.5885023266244422327429869923512137191387) }}, 
+      {{ SC_(6), SC_(-0.359375), SC_(-0.3574169633100709256385974948515920625884) }}, 
+      {{ SC_(6), SC_(-0.34375), SC_(-0.3419562723020725537106151114646547418575) }}, 
+      {{ SC_(6), SC_(-0.15625), SC_(-0.1558736232018049505341144384437560439801) }}, 
+      {{ SC_(6), SC_(-0.046875), SC_(-0.04684080784524884832543755029619959975211) }}, 
+      {{ SC_(6), SC_(0.03125), SC_(0.03126530088606778971193782597495982423430) }}, 
+      {{ SC_(6), SC_(0.21875), SC_(0.2195126330726162564990647323630301418002) }}, 
+      {{ SC_(6), SC_(0.25), SC_(0.2509990179628926887287753487100611128443) }}, 
+      {{ SC_(6), SC_(0.28125), SC_(0.2825181316863754841735116852899275573912) }}, 
+      {{ SC_(6), SC_(0.390625), SC_(0.3930973049267213043859316266625102901211) }}
+   }};
+
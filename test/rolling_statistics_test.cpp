@@ -0,0 +1,187 @@
+/*
+ * Copyright Nick Thompson, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/rolling_statistics.hpp>
+
+using namespace boost::math::statistics;
+
+template<class Real>
+std::vector<Real> random_data(std::size_t n, Real offset, unsigned seed)
+{
+    std::mt19937 gen{seed};
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(n);
+    for (auto & x : v) {
+        // The offset makes the removal of a sample subtract large, nearly equal quantities:
+        x = offset + dis(gen);
+    }
+    return v;
+}
+
+template<class Real>
+void test_moments(std::size_t window)
+{
+    std::vector<Real> v = random_data<Real>(3000, Real(100), 7);
+    std::size_t windows = v.size() - window + 1;
+    std::vector<Real> means(windows), variances(windows), sample_variances(windows), skews(windows);
+    auto end = rolling_mean(v, window, means.begin());
+    CHECK_EQUAL(true, end == means.end());
+    rolling_variance(v, window, variances.begin());
+    if (window > 1) {
+        rolling_sample_variance(v, window, sample_variances.begin());
+    }
+    rolling_skewness(v, window, skews.begin());
+    Real tol = 64*window*std::numeric_limits<Real>::epsilon();
+    for (std::size_t k = 0; k < windows; ++k) {
+        auto first = v.begin() + k;
+        auto last = first + window;
+        CHECK_MOLLIFIED_CLOSE(mean(first, last), means[k], tol);
+        CHECK_MOLLIFIED_CLOSE(variance(first, last), variances[k], 100*tol);
+        if (window > 1) {
+            CHECK_MOLLIFIED_CLOSE(sample_variance(first, last), sample_variances[k], 100*tol);
+        }
+        // The skewness is of order one, so the mollified error is an absolute error.
+        // It is a small difference of large terms, so the reference is computed in higher precision.
+        // The downdates leave an error of about eps (M2_peak/M2)^(3/2), which on a few samples can be large:
+        if (window >= 8) {
+            std::vector<long double> w(first, last);
+            CHECK_MOLLIFIED_CLOSE(static_cast<Real>(skewness(w)), skews[k], 1000*tol);
+        }
+    }
+}
+
+// Removing an outlier cancels almost all of the moments, which must not leave the following windows with its rounding error:
+template<class Real>
+void test_outlier(Real spike)
+{
+    std::vector<Real> v = random_data<Real>(400, Real(0), 5);
+    v[10] = spike;
+    v[250] = -spike;
+    std::size_t window = 100;
+    std::size_t windows = v.size() - window + 1;
+    std::vector<Real> means(windows), variances(windows), skews(windows), covariances(windows), correlations(windows);
+    rolling_mean(v, window, means.begin());
+    rolling_variance(v, window, variances.begin());
+    rolling_skewness(v, window, skews.begin());
+    std::vector<Real> u = random_data<Real>(400, Real(0), 6);
+    rolling_covariance(u, v, window, covariances.begin());
+    rolling_correlation_coefficient(u, v, window, correlations.begin());
+    Real tol = 64*window*std::numeric_limits<Real>::epsilon();
+    for (std::size_t k = 0; k < windows; ++k) {
+        std::vector<Real> w(v.begin() + k, v.begin() + k + window);
+        std::vector<Real> wu(u.begin() + k, u.begin() + k + window);
+        CHECK_MOLLIFIED_CLOSE(mean(w), means[k], tol);
+        CHECK_MOLLIFIED_CLOSE(variance(w), variances[k], tol);
+        std::vector<long double> wl(w.begin(), w.end());
+        CHECK_MOLLIFIED_CLOSE(static_cast<Real>(skewness(wl)), skews[k], 10*tol);
+        CHECK_MOLLIFIED_CLOSE(covariance(wu, w), covariances[k], tol);
+        CHECK_MOLLIFIED_CLOSE(correlation_coefficient(wu, w), correlations[k], tol);
+    }
+}
+
+template<class Real>
+void test_order_statistics(std::size_t window)
+{
+    // Few distinct values give many ties:
+    std::mt19937 gen{static_cast<unsigned>(window)};
+    std::uniform_int_distribution<int> dis(0, 20);
+    std::vector<Real> v(1500);
+    for (auto & x : v) {
+        x = static_cast<Real>(dis(gen));
+    }
+    std::size_t windows = v.size() - window + 1;
+    std::vector<Real> mins(windows), maxs(windows), medians(windows);
+    rolling_min(v, window, mins.begin());
+    rolling_max(v, window, maxs.begin());
+    rolling_median(v, window, medians.begin());
+    for (std::size_t k = 0; k < windows; ++k) {
+        std::vector<Real> w(v.begin() + k, v.begin() + k + window);
+        CHECK_EQUAL(*std::min_element(w.begin(), w.end()), mins[k]);
+        CHECK_EQUAL(*std::max_element(w.begin(), w.end()), maxs[k]);
+        CHECK_EQUAL(median(w), medians[k]);
+    }
+}
+
+template<class Real>
+void test_bivariate(std::size_t window)
+{
+    std::vector<Real> u = random_data<Real>(2000, Real(-50), 11);
+    std::vector<Real> v = random_data<Real>(2000, Real(20), 12);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] += u[i]/2;
+    }
+    // A constant stretch, so that some windows of u are constant:
+    std::fill(u.begin() + 500, u.begin() + 500 + 2*window, Real(3));
+    std::size_t windows = u.size() - window + 1;
+    std::vector<Real> covariances(windows), correlations(windows);
+    rolling_covariance(u, v, window, covariances.begin());
+    rolling_correlation_coefficient(u, v, window, correlations.begin());
+    Real tol = 64*window*std::numeric_limits<Real>::epsilon();
+    for (std::size_t k = 0; k < windows; ++k) {
+        std::vector<Real> wu(u.begin() + k, u.begin() + k + window);
+        std::vector<Real> wv(v.begin() + k, v.begin() + k + window);
+        CHECK_MOLLIFIED_CLOSE(covariance(wu, wv), covariances[k], 100*tol);
+        CHECK_MOLLIFIED_CLOSE(correlation_coefficient(wu, wv), correlations[k], 100*tol);
+    }
+}
+
+void test_forward_iterators_and_integers()
+{
+    // Forward iterators only, integer data in double precision, and a window as long as the data:
+    std::forward_list<int> v{4, 8, 15, 16, 23, 42};
+    std::vector<double> means;
+    rolling_mean(v.begin(), v.end(), 3, std::back_inserter(means));
+    CHECK_EQUAL(std::size_t(4), means.size());
+    CHECK_ULP_CLOSE(9.0, means[0], 2);
+    CHECK_ULP_CLOSE(27.0, means[3], 2);
+    std::vector<int> maxs;
+    rolling_max(v.begin(), v.end(), 6, std::back_inserter(maxs));
+    CHECK_EQUAL(std::size_t(1), maxs.size());
+    CHECK_EQUAL(42, maxs[0]);
+    std::vector<int> medians;
+    rolling_median(v.begin(), v.end(), 1, std::back_inserter(medians));
+    CHECK_EQUAL(std::size_t(6), medians.size());
+    CHECK_EQUAL(23, medians[4]);
+
+    bool thrown = false;
+    try {
+        rolling_mean(v.begin(), v.end(), 7, std::back_inserter(means));
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
+int main()
+{
+    test_moments<double>(1);
+    test_moments<double>(2);
+    test_moments<double>(50);
+    test_moments<double>(1001);
+    test_moments<long double>(64);
+    test_outlier<double>(1e8);
+    test_outlier<double>(1e6);
+    test_outlier<long double>(1e8L);
+    test_order_statistics<double>(1);
+    test_order_statistics<double>(10);
+    test_order_statistics<float>(101);
+    test_order_statistics<int>(64);
+    test_bivariate<double>(2);
+    test_bivariate<double>(37);
+    test_bivariate<double>(400);
+    test_forward_iterators_and_integers();
+    return boost::math::test::report_errors();
+}
@@ -10,6 +10,7 @@
 #include <forward_list>
 #include <algorithm>
 #include <random>
+#include <execution>
 #include <boost/core/lightweight_test.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/math/constants/constants.hpp>
@@ -291,12 +292,57 @@ void test_m2m4_snr_estimator()
     BOOST_TEST(abs(m2m4 - m2m4_2) < tol);
 }
 
+template<class Real>
+void test_execution_policy_absolute_gini_coefficient()
+{
+    using boost::math::statistics::absolute_gini_coefficient;
+    using boost::math::statistics::sample_absolute_gini_coefficient;
+    using std::sqrt;
+    std::mt19937 gen(91);
+    std::normal_distribution<Real> dis(0, 1);
+    // Large enough to be split into blocks, with repeated values and signed zeros:
+    std::vector<Real> v(200003);
+    for (auto & x : v)
+    {
+        x = dis(gen);
+    }
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        v[i] = (i & 1) ? Real(0) : -Real(0);
+        v[i + 1000] = Real(-2.5);
+    }
+    std::shuffle(v.begin(), v.end(), gen);
+    auto const original = v;
+    // The sequential version accumulates its sums in a single pass, and so its error grows as sqrt(n):
+    Real tol = 8*sqrt(Real(v.size()))*std::numeric_limits<Real>::epsilon();
+    Real expected = absolute_gini_coefficient(v);
+    Real computed = absolute_gini_coefficient(std::execution::par, original);
+    BOOST_TEST(abs(expected - computed) < tol*expected);
+    BOOST_TEST(computed == absolute_gini_coefficient(std::execution::seq, original.cbegin(), original.cend()));
+    v = original;
+    expected = sample_absolute_gini_coefficient(v);
+    BOOST_TEST(abs(expected - sample_absolute_gini_coefficient(std::execution::par, original)) < tol*expected);
+
+    std::vector<std::complex<Real>> w(5000);
+    for (auto & z : w)
+    {
+        z = {dis(gen), dis(gen)};
+    }
+    auto w_copy = w;
+    expected = absolute_gini_coefficient(w_copy);
+    BOOST_TEST(abs(expected - absolute_gini_coefficient(std::execution::par, w)) < tol*expected);
+}
+
 int main()
 {
     test_absolute_gini_coefficient<float>();
     test_absolute_gini_coefficient<double>();
     test_absolute_gini_coefficient<long double>();
 
+    test_execution_policy_absolute_gini_coefficient<float>();
+    test_execution_policy_absolute_gini_coefficient<double>();
+    test_execution_policy_absolute_gini_coefficient<long double>();
+
     test_hoyer_sparsity<float>();
     test_hoyer_sparsity<double>();
     test_hoyer_sparsity<long double>();
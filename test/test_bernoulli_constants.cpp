@@ -9,10 +9,15 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/math/concepts/real_concept.hpp>
 #include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
 #include <libs/math/test/table_type.hpp>
 #include <boost/math/tools/test.hpp>
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#ifdef BOOST_MATH_PARALLEL_TANGENT_NUMBERS
+#include <thread>
+#endif
 
 #define SC_(x) static_cast<typename table_type<T>::type>(BOOST_JOIN(x, L))
 
@@ -221,6 +226,64 @@ void test_real_concept_extra()
    }
 }
 
+//
+// Three types with the same 168-bit arithmetic but separate caches, none of which is used elsewhere in
+// this file, so that each prefill below starts from an empty cache:
+//
+typedef boost::multiprecision::cpp_bin_float_50 serial_type;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<168, boost::multiprecision::digit_base_2>, boost::multiprecision::et_off> two_thread_type;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<168, boost::multiprecision::digit_base_2, void, long long>, boost::multiprecision::et_off> seven_thread_type;
+
+template <class T>
+void test_prefill(unsigned threads, const std::vector<serial_type>& tangents, const std::vector<serial_type>& bernoullis)
+{
+   //
+   // Prefilling shares the tangent number recurrence between threads, by exactly the same
+   // operations as the serial recurrence, so the results must be identical:
+   //
+   const unsigned n = static_cast<unsigned>(tangents.size());
+   boost::math::prefill_bernoulli_b2n<T>(n, threads);
+   unsigned mismatches = 0;
+   for(unsigned i = 0; i < n; ++i)
+   {
+      if((serial_type(boost::math::tangent_t2n<T>(i)) != tangents[i]) || (serial_type(boost::math::bernoulli_b2n<T>(i)) != bernoullis[i]))
+         ++mismatches;
+   }
+   BOOST_CHECK_EQUAL(mismatches, 0u);
+#ifdef BOOST_MATH_PARALLEL_TANGENT_NUMBERS
+   //
+   // Readers of values already in the cache never lock:
+   //
+   std::vector<std::thread> readers;
+   std::vector<unsigned> reader_mismatches(4);
+   for(unsigned t = 0; t < reader_mismatches.size(); ++t)
+   {
+      readers.emplace_back([&tangents, &reader_mismatches, n, t]()
+      {
+         for(unsigned i = 0; i < n; ++i)
+            if(serial_type(boost::math::tangent_t2n<T>(i)) != tangents[i])
+               ++reader_mismatches[t];
+      });
+   }
+   for(auto& r : readers)
+      r.join();
+   for(unsigned t = 0; t < reader_mismatches.size(); ++t)
+   {
+      BOOST_CHECK_EQUAL(reader_mismatches[t], 0u);
+   }
+#endif
+}
+
+void test_prefill()
+{
+   static const unsigned n = 3000;
+   boost::math::prefill_bernoulli_b2n<serial_type>(n, 1);
+   std::vector<serial_type> tangents(n), bernoullis(n);
+   boost::math::tangent_t2n<serial_type>(0, n, tangents.begin());
+   boost::math::bernoulli_b2n<serial_type>(0, n, bernoullis.begin());
+   test_prefill<two_thread_type>(2, tangents, bernoullis);
+   test_prefill<seven_thread_type>(7, tangents, bernoullis);
+}
 
 BOOST_AUTO_TEST_CASE( test_main )
 {
@@ -230,6 +293,7 @@ BOOST_AUTO_TEST_CASE( test_main )
    test<long double>("long double");
    test<boost::math::concepts::real_concept>("real_concept");
    test_real_concept_extra();
+   test_prefill();
 #endif
 }
 
@@ -0,0 +1,145 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#  pragma warning(disable : 4127) // conditional expression is constant.
+#endif
+
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/policies/policy.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // Boost.Test
+#include <boost/test/tools/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <typeinfo>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests the functions which evaluate whole sequences of orders of the Bessel functions at once,
+// against the functions which evaluate one order at a time.
+//
+
+template <class T>
+void check_sequence(const std::vector<T>& seq, T v0, T x, T (*single)(T, T), T tolerance, T envelope)
+{
+   using std::abs;
+   for (unsigned k = 0; k < seq.size(); ++k)
+   {
+      T expected = single(T(v0 + k), x);
+      // J and Y oscillate for orders below x, where their errors are relative to the size of the envelope rather than the value:
+      T scale = (std::max)(abs(expected), envelope);
+      if (expected == 0)
+      {
+         BOOST_CHECK_EQUAL(seq[k], T(0));
+      }
+      else if (abs(seq[k] - expected) > tolerance * scale)
+      {
+         BOOST_ERROR("Sequence value of order " << v0 + k << " at x = " << x << " was " << seq[k] << " but expected " << expected);
+      }
+   }
+}
+
+template <class T> T j(T v, T x) { return boost::math::cyl_bessel_j(v, x); }
+template <class T> T y(T v, T x) { return boost::math::cyl_neumann(v, x); }
+template <class T> T i(T v, T x) { return boost::math::cyl_bessel_i(v, x); }
+template <class T> T k(T v, T x) { return boost::math::cyl_bessel_k(v, x); }
+
+template <class T>
+void test_sequences(T, const char* name)
+{
+   std::cout << "Testing Bessel function sequences with type " << name << std::endl;
+   using std::sqrt;
+   typedef boost::math::policies::policy<boost::math::policies::overflow_error<boost::math::policies::ignore_error> > ignore_overflow;
+   T tolerance = 50 * std::numeric_limits<T>::epsilon();
+   static const T orders[] = { 0, T(0.5), T(2.25), 17 };
+   static const T points[] = { T(1e-3), T(0.5), 1, T(3.75), 10, T(55.5), 200 };
+   for (unsigned m = 0; m < sizeof(orders) / sizeof(orders[0]); ++m)
+   {
+      for (unsigned p = 0; p < sizeof(points) / sizeof(points[0]); ++p)
+      {
+         T v0 = orders[m];
+         T x = points[p];
+         T envelope = sqrt(2 / (boost::math::constants::pi<T>() * x)) / 4;
+         std::vector<T> seq;
+         boost::math::cyl_bessel_j_sequence(v0, 60u, x, std::back_inserter(seq));
+         BOOST_CHECK_EQUAL(seq.size(), 60u);
+         check_sequence(seq, v0, x, &j<T>, tolerance, envelope);
+         // I, Y and K are only tested while they remain finite:
+         if ((boost::math::isfinite)(boost::math::cyl_bessel_i(v0, x, ignore_overflow())))
+         {
+            seq.clear();
+            boost::math::cyl_bessel_i_sequence(v0, 40u, x, std::back_inserter(seq));
+            check_sequence(seq, v0, x, &i<T>, tolerance, T(0));
+         }
+         if ((boost::math::isfinite)(boost::math::cyl_bessel_k(T(v0 + 24), x, ignore_overflow())))
+         {
+            seq.clear();
+            boost::math::cyl_neumann_sequence(v0, 25u, x, std::back_inserter(seq));
+            check_sequence(seq, v0, x, &y<T>, tolerance, envelope);
+            seq.clear();
+            boost::math::cyl_bessel_k_sequence(v0, 25u, x, std::back_inserter(seq));
+            check_sequence(seq, v0, x, &k<T>, tolerance, T(0));
+         }
+      }
+   }
+   // Integer orders reflect for negative x:
+   std::vector<T> seq;
+   boost::math::cyl_bessel_j_sequence(3, 10u, T(-4.5), std::back_inserter(seq));
+   check_sequence(seq, T(3), T(-4.5), &j<T>, tolerance, T(0));
+   seq.clear();
+   boost::math::cyl_bessel_i_sequence(0, 10u, T(-2.5), std::back_inserter(seq));
+   check_sequence(seq, T(0), T(-2.5), &i<T>, tolerance, T(0));
+   // At x = 0, and for negative orders, each order is evaluated separately:
+   seq.clear();
+   boost::math::cyl_bessel_j_sequence(0, 4u, T(0), std::back_inserter(seq));
+   BOOST_CHECK_EQUAL(seq[0], T(1));
+   BOOST_CHECK_EQUAL(seq[3], T(0));
+   seq.clear();
+   boost::math::cyl_bessel_k_sequence(T(-2.5), 6u, T(1.5), std::back_inserter(seq));
+   check_sequence(seq, T(-2.5), T(1.5), &k<T>, tolerance, T(0));
+   // Writes to any output iterator, and returns the end of the sequence:
+   T values[5];
+   T* end = boost::math::cyl_bessel_j_sequence(0, 5u, T(2), values);
+   BOOST_CHECK_EQUAL(end - values, 5);
+   BOOST_CHECK_CLOSE_FRACTION(values[4], boost::math::cyl_bessel_j(4, T(2)), tolerance);
+   BOOST_CHECK_EQUAL(boost::math::cyl_bessel_i_sequence(T(0.5), 0u, T(2), values), values);
+}
+
+void test_errors()
+{
+   std::vector<double> seq;
+   BOOST_CHECK_THROW(boost::math::cyl_bessel_j_sequence(0.5, 3u, -1.0, std::back_inserter(seq)), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::cyl_neumann_sequence(0, 3u, -1.0, std::back_inserter(seq)), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::cyl_bessel_k_sequence(0, 3u, -1.0, std::back_inserter(seq)), std::domain_error);
+   // Y and K overflow as the order grows:
+   BOOST_CHECK_THROW(boost::math::cyl_neumann_sequence(0, 200u, 0.5, std::back_inserter(seq)), std::overflow_error);
+   BOOST_CHECK_THROW(boost::math::cyl_bessel_k_sequence(0, 200u, 0.5, std::back_inserter(seq)), std::overflow_error);
+   using namespace boost::math::policies;
+   typedef policy<overflow_error<ignore_error> > ignore_overflow;
+   seq.clear();
+   boost::math::cyl_neumann_sequence(0, 200u, 0.5, std::back_inserter(seq), ignore_overflow());
+   BOOST_CHECK_EQUAL(seq.back(), -std::numeric_limits<double>::infinity());
+   seq.clear();
+   boost::math::cyl_bessel_k_sequence(0, 200u, 0.5, std::back_inserter(seq), ignore_overflow());
+   BOOST_CHECK_EQUAL(seq.back(), std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_sequences(0.1F, "float");
+   test_sequences(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_sequences(0.1L, "long double");
+#endif
+   test_errors();
+}
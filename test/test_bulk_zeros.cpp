@@ -0,0 +1,101 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/bulk_zeros.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // Boost.Test
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests the tables of zeros of the Bessel and Airy functions computed by several threads,
+// against the functions which find one zero at a time.
+//
+
+template <class T>
+void test_bessel(T, const char* name)
+{
+   std::cout << "Testing tables of Bessel function zeros with type " << name << std::endl;
+   std::vector<T> orders;
+   for (unsigned i = 0; i < 12; ++i)
+   {
+      orders.push_back(T(i) * T(3.25));
+   }
+   orders.push_back(T(-2.5));
+   for (unsigned threads = 1; threads <= 4; threads += 3)
+   {
+      std::vector<T> j = boost::math::cyl_bessel_j_zeros(orders, 1, 150u, threads);
+      std::vector<T> y = boost::math::cyl_neumann_zeros(orders, 1, 150u, threads);
+      BOOST_CHECK_EQUAL(j.size(), orders.size() * 150);
+      BOOST_CHECK_EQUAL(y.size(), orders.size() * 150);
+      for (unsigned i = 0; i < orders.size(); ++i)
+      {
+         for (unsigned k = 0; k < 150; k += 7)
+         {
+            BOOST_CHECK_EQUAL(j[i * 150 + k], boost::math::cyl_bessel_j_zero(orders[i], 1 + static_cast<int>(k)));
+            BOOST_CHECK_EQUAL(y[i * 150 + k], boost::math::cyl_neumann_zero(orders[i], 1 + static_cast<int>(k)));
+         }
+      }
+   }
+   // The rows start at any rank, and may be empty:
+   std::vector<T> j = boost::math::cyl_bessel_j_zeros(std::vector<T>(1, T(1)), 0, 3u, 2u);
+   BOOST_CHECK_EQUAL(j[0], T(0));
+   BOOST_CHECK_EQUAL(j[2], boost::math::cyl_bessel_j_zero(T(1), 2));
+   BOOST_CHECK(boost::math::cyl_bessel_j_zeros(orders, 1, 0u, 4u).empty());
+   BOOST_CHECK(boost::math::cyl_neumann_zeros(std::vector<T>(), 1, 10u, 4u).empty());
+}
+
+template <class T>
+void test_airy(T, const char* name)
+{
+   std::cout << "Testing tables of Airy function zeros with type " << name << std::endl;
+   for (unsigned threads = 1; threads <= 4; threads += 3)
+   {
+      std::vector<T> ai = boost::math::airy_ai_zeros<T>(1, 1000u, threads);
+      std::vector<T> bi = boost::math::airy_bi_zeros<T>(20, 1000u, threads);
+      BOOST_CHECK_EQUAL(ai.size(), 1000u);
+      for (unsigned k = 0; k < 1000; k += 13)
+      {
+         BOOST_CHECK_EQUAL(ai[k], boost::math::airy_ai_zero<T>(1 + static_cast<int>(k)));
+         BOOST_CHECK_EQUAL(bi[k], boost::math::airy_bi_zero<T>(20 + static_cast<int>(k)));
+      }
+   }
+}
+
+void test_errors()
+{
+   // An error in any thread is raised by the caller:
+   std::vector<double> orders(20, 2.5);
+   orders[17] = std::numeric_limits<double>::infinity();
+   BOOST_CHECK_THROW(boost::math::cyl_bessel_j_zeros(orders, 1, 100u, 4u), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::cyl_neumann_zeros(orders, 1, 100u, 1u), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::airy_ai_zeros<double>(-5, 100u, 4u), std::domain_error);
+   // Or handled as the policy says:
+   using namespace boost::math::policies;
+   std::vector<double> j = boost::math::cyl_bessel_j_zeros(orders, 1, 100u, 4u, policy<domain_error<ignore_error> >());
+   BOOST_CHECK((boost::math::isnan)(j[17 * 100 + 50]));
+   BOOST_CHECK_EQUAL(j[16 * 100 + 50], boost::math::cyl_bessel_j_zero(2.5, 51));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_bessel(0.1F, "float");
+   test_bessel(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_bessel(0.1L, "long double");
+#endif
+   test_airy(0.1F, "float");
+   test_airy(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_airy(0.1L, "long double");
+#endif
+   test_errors();
+}
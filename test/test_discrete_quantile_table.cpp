@@ -0,0 +1,136 @@
+// test_discrete_quantile_table.cpp
+
+// Copyright John Maddock 2026.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Quantiles from the table must be identical to those from the distribution
+// itself, for every discrete_quantile policy, both inside the tabulated
+// region and in the tails where the table defers to the distribution:
+//
+#include <boost/math/distributions/binomial.hpp>
+#include <boost/math/distributions/hypergeometric.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/poisson.hpp>
+#include <boost/math/distributions/discrete_quantile_table.hpp>
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // for test_main
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+template <class Dist>
+void check_table(const Dist& d)
+{
+   typedef typename Dist::value_type value_type;
+   boost::math::discrete_quantile_table<Dist> t(d);
+   BOOST_CHECK(t.first() <= t.last());
+   std::mt19937 gen(17);
+   std::uniform_real_distribution<double> ud(0, 1);
+   std::vector<value_type> probabilities;
+   for(unsigned i = 0; i < 2000; ++i)
+      probabilities.push_back(static_cast<value_type>(ud(gen)));
+   for(int e = -30; e < 0; ++e)
+      probabilities.push_back(static_cast<value_type>(std::ldexp(1.0, e)));
+   for(unsigned i = 0; i < probabilities.size(); ++i)
+   {
+      value_type p = probabilities[i];
+      BOOST_CHECK_EQUAL(quantile(d, p), quantile(t, p));
+      BOOST_CHECK_EQUAL(quantile(complement(d, p)), quantile(complement(t, p)));
+   }
+   //
+   // When the probability is exactly the cdf at some point k, the result must
+   // be a point with exactly that cdf.  This is k itself, unless the cdf has
+   // the same value at several consecutive points (once it has converged to 1
+   // in the precision of value_type), which the distribution's own quantile
+   // doesn't always find.  Only double is tested, as in float the computed cdf
+   // is not monotonic this close to 1:
+   //
+   if(boost::is_same<typename Dist::policy_type::discrete_quantile_type, boost::math::policies::discrete_quantile<boost::math::policies::real> >::value
+      || !boost::is_same<value_type, double>::value)
+      return;
+   for(value_type k = t.first(); k <= t.last(); k += 7)
+   {
+      value_type p = cdf(d, k);
+      if(p < 1)
+         BOOST_CHECK_EQUAL(cdf(d, quantile(t, p)), p);
+      p = cdf(complement(d, k));
+      if(p > 0)
+         BOOST_CHECK_EQUAL(cdf(complement(d, quantile(complement(t, p)))), p);
+   }
+}
+
+template <class Dist>
+void check_sampler(const Dist& d)
+{
+   typedef typename Dist::value_type value_type;
+   boost::math::discrete_quantile_table<Dist> t(d);
+   std::mt19937_64 gen(42);
+   std::vector<value_type> v(20000);
+   boost::math::sample(t, gen, v.begin(), v.end());
+   value_type total = 0;
+   for(unsigned i = 0; i < v.size(); ++i)
+   {
+      BOOST_CHECK_EQUAL(v[i], floor(v[i]));
+      total += v[i];
+   }
+   value_type m = total / v.size();
+   BOOST_CHECK(fabs(m - mean(d)) < 5 * standard_deviation(d) / sqrt(value_type(v.size())));
+}
+
+template <class Policy, class RealType>
+void test_policy(RealType)
+{
+   using namespace boost::math;
+   check_table(poisson_distribution<RealType, Policy>(RealType(0.3)));
+   check_table(poisson_distribution<RealType, Policy>(RealType(12.5)));
+   check_table(poisson_distribution<RealType, Policy>(RealType(2000)));
+   check_table(binomial_distribution<RealType, Policy>(40, RealType(0.25)));
+   check_table(binomial_distribution<RealType, Policy>(3000, RealType(0.9)));
+   check_table(negative_binomial_distribution<RealType, Policy>(5, RealType(0.4)));
+   check_table(negative_binomial_distribution<RealType, Policy>(RealType(0.5), RealType(0.01)));
+}
+
+//
+// A support which starts above zero: with r + n > N the hypergeometric
+// distribution starts at r + n - N.  Its quantile has no real rounding, and
+// rounds to nearest by its own rule rather than by the cdf at half integers,
+// so only the remaining policies are tested:
+//
+template <class Policy, class RealType>
+void test_shifted_support(RealType)
+{
+   using namespace boost::math;
+   check_table(hypergeometric_distribution<RealType, Policy>(50, 80, 100));
+   check_table(hypergeometric_distribution<RealType, Policy>(600, 700, 1000));
+}
+
+template <class RealType>
+void test_spots(RealType)
+{
+   using namespace boost::math::policies;
+   test_policy<policy<> >(RealType());
+   test_policy<policy<discrete_quantile<integer_round_inwards> > >(RealType());
+   test_policy<policy<discrete_quantile<integer_round_down> > >(RealType());
+   test_policy<policy<discrete_quantile<integer_round_up> > >(RealType());
+   test_policy<policy<discrete_quantile<integer_round_nearest> > >(RealType());
+   test_policy<policy<discrete_quantile<real> > >(RealType());
+   test_shifted_support<policy<> >(RealType());
+   test_shifted_support<policy<discrete_quantile<integer_round_inwards> > >(RealType());
+   test_shifted_support<policy<discrete_quantile<integer_round_down> > >(RealType());
+   test_shifted_support<policy<discrete_quantile<integer_round_up> > >(RealType());
+
+   check_sampler(boost::math::poisson_distribution<RealType>(RealType(7.5)));
+   check_sampler(boost::math::binomial_distribution<RealType>(500, RealType(0.3)));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_spots(0.0F);
+   test_spots(0.0);
+}
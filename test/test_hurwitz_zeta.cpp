@@ -0,0 +1,201 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#  pragma warning(disable : 4127) // conditional expression is constant.
+#endif
+
+#include <boost/math/special_functions/hurwitz_zeta.hpp>
+#include <boost/math/special_functions/polylog.hpp>
+#include <boost/math/tools/test_value.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // Boost.Test
+#include <boost/test/tools/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests the Hurwitz zeta function, the polylogarithm and zeta_evaluator.
+// The spot values were calculated with mpmath at 80 or more decimal digits, the
+// remaining tests check identities and that the evaluator agrees with the free functions.
+//
+
+template <class T>
+void test_spots(T, const char* name, T tolerance)
+{
+   std::cout << "Testing Hurwitz zeta and polylogarithm spot values with type " << name << std::endl;
+   using boost::math::hurwitz_zeta;
+   using boost::math::polylog;
+   // Euler-Maclaurin, for s >= 0 or large a:
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(3), T(0.125)), BOOST_MATH_TEST_VALUE(T, 512.87666905906784129783446502825867878705906), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(1.5), T(0.001)), BOOST_MATH_TEST_VALUE(T, 31625.3869669119132933020610133013400138995265), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(0.25), T(7.5)), BOOST_MATH_TEST_VALUE(T, -5.73893610381345418612924069303886931609670714), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(2.5), T(2.25)), BOOST_MATH_TEST_VALUE(T, 0.275018552457739700434998797611767435550022217), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(25.5), T(40)), BOOST_MATH_TEST_VALUE(T, 3.06900175083825241443628183224719827396071206e-41), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(60), T(150)), BOOST_MATH_TEST_VALUE(T, 8.36481185059573734736761437314846493762791693e-131), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-20.5), T(15)), BOOST_MATH_TEST_VALUE(T, -397449292820485988668313.292183995525732163319), tolerance);
+   // Hurwitz's formula, for s < 0 and small a:
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-0.5), T(0.125)), BOOST_MATH_TEST_VALUE(T, 0.0494465305877473116981890565929314401446947217), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-2.5), T(0.3)), BOOST_MATH_TEST_VALUE(T, -0.00949638093151451979007889222875124427863309479), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-3), T(0.75)), BOOST_MATH_TEST_VALUE(T, -0.000455729166666666666666666666666666666666666667), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-7.25), T(2.25)), BOOST_MATH_TEST_VALUE(T, -5.04032855949847149111272228538468617232178866), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(T(-12), T(0.3)), BOOST_MATH_TEST_VALUE(T, 0.0383002905634000008687133058176907735618106555), tolerance);
+   // Each series of the polylogarithm:
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(2), T(0.5)), BOOST_MATH_TEST_VALUE(T, 0.582240526465012505902656320159680108744198475), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(2), T(-0.001)), BOOST_MATH_TEST_VALUE(T, -0.000999750111048651104160006188494044365085263072), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(30), T(-1)), BOOST_MATH_TEST_VALUE(T, -0.999999999068682281453978627279547843092150773), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(3), T(0.9)), BOOST_MATH_TEST_VALUE(T, 1.04965895018643990171190384708594043401283096), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(1.5), T(0.999999)), BOOST_MATH_TEST_VALUE(T, 2.60883190045253402378409154042308190365371134), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(0.5), T(0.6)), BOOST_MATH_TEST_VALUE(T, 1.12226352499071783280720621096741128446868341), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(-0.5), T(0.4)), BOOST_MATH_TEST_VALUE(T, 0.828800872787537065663850146494815647310461141), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(10), T(0.99)), BOOST_MATH_TEST_VALUE(T, 0.990974594625413377584648201080849960901065854), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(2.5), T(-0.75)), BOOST_MATH_TEST_VALUE(T, -0.670638731327299958303970776107687206059951354), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(-5.5), T(-0.25)), BOOST_MATH_TEST_VALUE(T, 0.0638425012005574145815011231731796775211592178), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(-2), T(-1.5)), BOOST_MATH_TEST_VALUE(T, 0.048), tolerance);
+   // Inversion, for integer orders and z < -2:
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(-3), T(-10)), BOOST_MATH_TEST_VALUE(T, -0.0416638207772693122054504473738132641213031897), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(5), T(-100)), BOOST_MATH_TEST_VALUE(T, -52.7680423688720764169300174077819272492652631), tolerance);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(T(4), T(-1e6)), BOOST_MATH_TEST_VALUE(T, -1676.82364842520739315263037404603926386538005), tolerance);
+}
+
+template <class T>
+void test_identities(T, const char* name, T tolerance)
+{
+   std::cout << "Testing Hurwitz zeta and polylogarithm identities with type " << name << std::endl;
+   using boost::math::hurwitz_zeta;
+   using boost::math::polylog;
+   using boost::math::zeta;
+   using std::pow;
+   using std::log;
+   static const T orders[] = { T(-6.5), -3, T(-0.75), 0, T(0.5), 2, T(3.25), 12 };
+   static const T points[] = { T(0.0625), T(0.3), T(0.75), T(1.5), T(4.125), 24 };
+   for (unsigned i = 0; i < sizeof(orders) / sizeof(orders[0]); ++i)
+   {
+      T s = orders[i];
+      BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(s, T(1)), zeta(s), tolerance);
+      if (s != 0)
+      {
+         BOOST_CHECK_CLOSE_FRACTION(hurwitz_zeta(s, T(0.5)), (pow(T(2), s) - 1) * zeta(s), tolerance);
+      }
+      for (unsigned j = 0; j < sizeof(points) / sizeof(points[0]); ++j)
+      {
+         T a = points[j];
+         // zeta(s, a) = zeta(s, a + 1) + a^-s, which has a cancellation error of its own:
+         T lhs = hurwitz_zeta(s, a);
+         T rhs = hurwitz_zeta(s, T(a + 1)) + pow(a, -s);
+         T scale = (std::max)(std::fabs(lhs), std::fabs(pow(a, -s)));
+         BOOST_CHECK_SMALL(T((lhs - rhs) / scale), tolerance);
+      }
+   }
+   static const T z_values[] = { T(-1.75), T(-0.625), T(-0.25), T(0.0625), T(0.375), T(0.6875), T(0.96875) };
+   for (unsigned i = 0; i < sizeof(orders) / sizeof(orders[0]); ++i)
+   {
+      T s = orders[i];
+      if (s > 1)
+      {
+         BOOST_CHECK_CLOSE_FRACTION(polylog(s, T(1)), zeta(s), tolerance);
+      }
+      if (s != 1)
+      {
+         BOOST_CHECK_CLOSE_FRACTION(polylog(s, T(-1)), -(1 - pow(T(2), 1 - s)) * zeta(s), tolerance);
+      }
+      for (unsigned j = 0; j < sizeof(z_values) / sizeof(z_values[0]); ++j)
+      {
+         T z = z_values[j];
+         if (std::fabs(z) >= 1)
+            continue;
+         // The duplication formula, whose left hand side cancels when z^2 2^-s is small compared to z:
+         T lhs = polylog(s, z) + polylog(s, T(-z));
+         T rhs = pow(T(2), 1 - s) * polylog(s, T(z * z));
+         T scale = (std::max)(std::fabs(polylog(s, z)), std::fabs(polylog(s, T(-z))));
+         BOOST_CHECK_SMALL(T((lhs - rhs) / scale), T(tolerance * 4));
+      }
+   }
+   for (unsigned j = 0; j < sizeof(z_values) / sizeof(z_values[0]); ++j)
+   {
+      T z = z_values[j];
+      BOOST_CHECK_CLOSE_FRACTION(polylog(1, z), T(-log(1 - z)), tolerance);
+      BOOST_CHECK_CLOSE_FRACTION(polylog(0, z), T(z / (1 - z)), tolerance);
+      BOOST_CHECK_CLOSE_FRACTION(polylog(-1, z), T(z / ((1 - z) * (1 - z))), tolerance);
+   }
+}
+
+template <class T>
+void test_evaluator(T, const char* name)
+{
+   std::cout << "Testing zeta_evaluator with type " << name << std::endl;
+   boost::math::zeta_evaluator<T> evaluator;
+   static const T points[] = { T(-4.5), T(-0.25), T(0.0625), T(0.5), T(0.875), T(1.5), T(2.75), T(9.5) };
+   const unsigned count = sizeof(points) / sizeof(points[0]);
+   std::vector<T> values;
+   evaluator.zeta(points, points + count, std::back_inserter(values));
+   BOOST_CHECK_EQUAL(values.size(), count);
+   for (unsigned i = 0; i < count; ++i)
+   {
+      // Types of known precision are evaluated exactly as zeta does it, the others through the tabulated series:
+      BOOST_CHECK_CLOSE_FRACTION(values[i], boost::math::zeta(points[i]), T(std::numeric_limits<T>::epsilon() * 8));
+   }
+   // The ranges overloads give exactly what the single calls, and the free functions, give:
+   values.clear();
+   evaluator.hurwitz_zeta(T(-2.5), points + 2, points + count, std::back_inserter(values));
+   for (unsigned i = 2; i < count; ++i)
+   {
+      BOOST_CHECK_EQUAL(values[i - 2], evaluator.hurwitz_zeta(T(-2.5), points[i]));
+      BOOST_CHECK_EQUAL(values[i - 2], boost::math::hurwitz_zeta(T(-2.5), points[i]));
+   }
+   // Writes to any output iterator, and returns the end of the range:
+   T results[4];
+   T* end = evaluator.polylog(T(2.5), points + 1, points + 5, results);
+   BOOST_CHECK_EQUAL(end - results, 4);
+   for (unsigned i = 1; i < 5; ++i)
+   {
+      BOOST_CHECK_EQUAL(results[i - 1], evaluator.polylog(T(2.5), points[i]));
+      BOOST_CHECK_EQUAL(results[i - 1], boost::math::polylog(T(2.5), points[i]));
+   }
+}
+
+void test_errors()
+{
+   using boost::math::hurwitz_zeta;
+   using boost::math::polylog;
+   BOOST_CHECK_THROW(hurwitz_zeta(1.0, 0.5), std::domain_error);
+   BOOST_CHECK_THROW(hurwitz_zeta(2.0, 0.0), std::domain_error);
+   BOOST_CHECK_THROW(hurwitz_zeta(2.0, -1.5), std::domain_error);
+   BOOST_CHECK_THROW(hurwitz_zeta(std::numeric_limits<double>::quiet_NaN(), 0.5), std::domain_error);
+   BOOST_CHECK_THROW(polylog(2.0, 1.5), std::domain_error);
+   BOOST_CHECK_THROW(polylog(0.5, 1.0), std::overflow_error);
+   BOOST_CHECK_THROW(polylog(2.5, -3.0), std::domain_error);
+   BOOST_CHECK_CLOSE_FRACTION(polylog(2, 1), boost::math::constants::pi_sqr<double>() / 6, 1e-15);
+   BOOST_CHECK_EQUAL(polylog(2.5, 0.0), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_spots(0.1, "double", 20 * std::numeric_limits<double>::epsilon());
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_spots(0.1L, "long double", 200 * std::numeric_limits<long double>::epsilon());
+#endif
+   // The spot values are only given to 45 digits:
+   typedef boost::multiprecision::cpp_bin_float_50 mp_type;
+   test_spots(mp_type(0.1), "cpp_bin_float_50", mp_type(1e-44));
+
+   test_identities(0.1, "double", 20 * std::numeric_limits<double>::epsilon());
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_identities(0.1L, "long double", 500 * std::numeric_limits<long double>::epsilon());
+#endif
+
+   test_evaluator(0.1, "double");
+   test_evaluator(mp_type(0.1), "cpp_bin_float_50");
+   test_errors();
+}
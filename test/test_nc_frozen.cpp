@@ -0,0 +1,105 @@
+// test_nc_frozen.cpp
+
+// Copyright John Maddock 2026.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// The frozen non-central distributions cache their Poisson weights,
+// but must otherwise give bit-for-bit identical results to the
+// regular distributions:
+//
+#include <boost/math/concepts/real_concept.hpp> // for real_concept
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/non_central_f.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // for test_main
+
+#include <iostream>
+
+template <class Dist, class Frozen, class RealType>
+void check_frozen(const Dist& d, const Frozen& f, RealType lower, RealType upper)
+{
+   for(unsigned i = 0; i <= 20; ++i)
+   {
+      RealType x = lower + (upper - lower) * i / 20;
+      BOOST_CHECK_EQUAL(pdf(d, x), pdf(f, x));
+      BOOST_CHECK_EQUAL(cdf(d, x), cdf(f, x));
+      BOOST_CHECK_EQUAL(cdf(complement(d, x)), cdf(complement(f, x)));
+   }
+   static const RealType probabilities[] = { RealType(0.001), RealType(0.25), RealType(0.5), RealType(0.9) };
+   for(unsigned i = 0; i < sizeof(probabilities) / sizeof(probabilities[0]); ++i)
+   {
+      BOOST_CHECK_EQUAL(quantile(d, probabilities[i]), quantile(f, probabilities[i]));
+      BOOST_CHECK_EQUAL(quantile(complement(d, probabilities[i])), quantile(complement(f, probabilities[i])));
+   }
+}
+
+template <class Dist, class Frozen>
+void check_frozen_moments(const Dist& d, const Frozen& f)
+{
+   BOOST_CHECK_EQUAL(mean(d), mean(f));
+   BOOST_CHECK_EQUAL(variance(d), variance(f));
+   BOOST_CHECK_EQUAL(standard_deviation(d), standard_deviation(f));
+}
+
+template <class RealType>
+void test_spots(RealType)
+{
+   using namespace boost::math;
+   static const RealType lambdas[] = { RealType(0.5), RealType(20), RealType(300) };
+   for(unsigned i = 0; i < sizeof(lambdas) / sizeof(lambdas[0]); ++i)
+   {
+      RealType l = lambdas[i];
+      check_frozen(
+         non_central_chi_squared_distribution<RealType>(RealType(7.5), l),
+         frozen_non_central_chi_squared_distribution<RealType>(RealType(7.5), l),
+         RealType(0.25), RealType(3 * l + 40));
+      check_frozen(
+         non_central_beta_distribution<RealType>(RealType(2.5), RealType(3.5), l),
+         frozen_non_central_beta_distribution<RealType>(RealType(2.5), RealType(3.5), l),
+         RealType(0.001), RealType(0.999));
+      check_frozen(
+         non_central_f_distribution<RealType>(RealType(2.5), RealType(13.5), l),
+         frozen_non_central_f_distribution<RealType>(RealType(2.5), RealType(13.5), l),
+         RealType(0.01), RealType(20));
+      RealType delta = sqrt(l);
+      check_frozen(
+         non_central_t_distribution<RealType>(RealType(5.5), delta),
+         frozen_non_central_t_distribution<RealType>(RealType(5.5), delta),
+         RealType(-10), RealType(40));
+      check_frozen(
+         non_central_t_distribution<RealType>(RealType(5.5), RealType(-delta)),
+         frozen_non_central_t_distribution<RealType>(RealType(5.5), RealType(-delta)),
+         RealType(-40), RealType(10));
+   }
+   check_frozen_moments(
+      non_central_chi_squared_distribution<RealType>(RealType(7.5), RealType(2)),
+      frozen_non_central_chi_squared_distribution<RealType>(RealType(7.5), RealType(2)));
+   check_frozen_moments(
+      non_central_beta_distribution<RealType>(RealType(2.5), RealType(3.5), RealType(2)),
+      frozen_non_central_beta_distribution<RealType>(RealType(2.5), RealType(3.5), RealType(2)));
+   check_frozen_moments(
+      non_central_f_distribution<RealType>(RealType(2.5), RealType(13.5), RealType(2)),
+      frozen_non_central_f_distribution<RealType>(RealType(2.5), RealType(13.5), RealType(2)));
+   check_frozen_moments(
+      non_central_t_distribution<RealType>(RealType(5.5), RealType(2)),
+      frozen_non_central_t_distribution<RealType>(RealType(5.5), RealType(2)));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_spots(0.0F); // Test float.
+   test_spots(0.0); // Test double.
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_spots(0.0L); // Test long double.
+#if !BOOST_WORKAROUND(__BORLANDC__, BOOST_TESTED_AT(0x582))
+   test_spots(boost::math::concepts::real_concept(0.)); // Test real concept.
+#endif
+#endif
+} // BOOST_AUTO_TEST_CASE( test_main )
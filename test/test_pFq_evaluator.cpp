@@ -0,0 +1,106 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/hypergeometric_pFq.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // Boost.Test
+#include <boost/math/concepts/real_concept.hpp>
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests hypergeometric_pFq_evaluator against hypergeometric_pFq: both sum the same series, so the
+// results must agree to within the error estimates, and values computed in a batch must be identical to
+// those computed one at a time.
+//
+
+template <class T>
+void test_range(const std::vector<T>& a, const std::vector<T>& b, T z0, T z1, unsigned n)
+{
+   BOOST_MATH_STD_USING
+   boost::math::hypergeometric_pFq_evaluator<T> eval(a, b);
+   std::vector<T> z, results, errors;
+   for (unsigned i = 0; i < n; ++i)
+      z.push_back(z0 + (z1 - z0) * i / (n - 1));
+   eval(z.begin(), z.end(), std::back_inserter(results), std::back_inserter(errors));
+   BOOST_REQUIRE_EQUAL(results.size(), z.size());
+   BOOST_REQUIRE_EQUAL(errors.size(), z.size());
+   std::vector<T> unchecked;
+   eval(z.begin(), z.end(), std::back_inserter(unchecked));
+   BOOST_CHECK_EQUAL_COLLECTIONS(results.begin(), results.end(), unchecked.begin(), unchecked.end());
+
+   for (unsigned i = 0; i < n; ++i)
+   {
+      T error;
+      T r = eval(z[i], &error);
+      BOOST_CHECK_EQUAL(r, results[i]);
+      BOOST_CHECK_EQUAL(error, errors[i]);
+      T expected_error;
+      T expected = boost::math::hypergeometric_pFq(a, b, z[i], &expected_error);
+      T tolerance = 4 * (expected_error + errors[i] + fabs(expected) * boost::math::tools::epsilon<T>());
+      if (fabs(r - expected) > tolerance)
+      {
+         BOOST_ERROR("Result at z = " << z[i] << " was " << r << " but hypergeometric_pFq gave " << expected << " +- " << expected_error);
+      }
+      BOOST_CHECK(errors[i] >= 0);
+   }
+}
+
+template <class T>
+void test_spots(T, const char* name)
+{
+   std::cout << "Testing hypergeometric_pFq_evaluator with type " << name << std::endl;
+   typedef std::vector<T> seq;
+   // 1F1, 2F1, 0F1 and 2F2:
+   test_range(seq{ 1.5 }, seq{ 2.25 }, T(-10), T(20), 300);
+   test_range(seq{ 0.5, 1.25 }, seq{ 2.5 }, T(-0.95), T(0.95), 301);
+   test_range(seq{}, seq{ 1.5 }, T(-50), T(50), 301);
+   test_range(seq{ 1.5, 2.5 }, seq{ 3.5, 1.25 }, T(-20), T(20), 301);
+   // A polynomial:
+   test_range(seq{ -7 }, seq{ 2.5 }, T(-10), T(10), 201);
+   // b's which cross the origin, these are passed on to the checked series:
+   test_range(seq{ 2.5 }, seq{ -4.5 }, T(-15), T(30), 300);
+   test_range(seq{ 1.5, 2.5 }, seq{ -3.5, 1.25 }, T(-0.5), T(0.5), 201);
+   // 2F1 on the edge of convergence is left to the checked series:
+   boost::math::hypergeometric_pFq_evaluator<T> edge(seq{ 0.5, 1.25 }, seq{ 2.5 });
+   BOOST_CHECK_EQUAL(edge(T(-1)), boost::math::hypergeometric_pFq(seq{ 0.5, 1.25 }, seq{ 2.5 }, T(-1)));
+
+#ifndef BOOST_NO_EXCEPTIONS
+   boost::math::hypergeometric_pFq_evaluator<T> pole(seq{ 1 }, seq{ -3 });
+   BOOST_CHECK_THROW(pole(T(0.5)), std::domain_error);
+   boost::math::hypergeometric_pFq_evaluator<T> zero_pole(seq{ 1 }, seq{ 0 });
+   BOOST_CHECK_THROW(zero_pole(T(0.5)), std::domain_error);
+   boost::math::hypergeometric_pFq_evaluator<T> negative_zero_pole(seq{}, seq{ 2.5, -T(0) });
+   BOOST_CHECK_THROW(negative_zero_pole(T(0.5)), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::hypergeometric_pFq(seq{}, seq{ 2.5, -T(0) }, T(0.5)), std::domain_error);
+   boost::math::hypergeometric_pFq_evaluator<T> divergent(seq{ 1, 2 }, seq{ 3 });
+   BOOST_CHECK_THROW(divergent(T(1.5)), std::domain_error);
+   boost::math::hypergeometric_pFq_evaluator<T> p_too_large(seq{ 1, 2, 3 }, seq{ 3 });
+   BOOST_CHECK_THROW(p_too_large(T(0.5)), std::domain_error);
+   // The pole is never reached when one of the a's terminates the series first:
+   boost::math::hypergeometric_pFq_evaluator<T> terminated(seq{ -2 }, seq{ -3 });
+   BOOST_CHECK_EQUAL(terminated(T(0.5)), boost::math::hypergeometric_pFq(seq{ -2 }, seq{ -3 }, T(0.5)));
+#endif
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_spots(0.0F, "float");
+   test_spots(0.0, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_spots(0.0L, "long double");
+#ifndef BOOST_MATH_NO_REAL_CONCEPT_TESTS
+   test_spots(boost::math::concepts::real_concept(0.1), "real_concept");
+#endif
+#endif
+}
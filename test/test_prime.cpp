@@ -0,0 +1,135 @@
+//  Copyright John Maddock 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/prime.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // Boost.Test
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests prime beyond its static table, and prime_count, is_prime, next_prime and
+// prime_range, against each other and against known values.
+//
+
+void test_sieved_prime()
+{
+   std::cout << "Testing prime beyond the static table" << std::endl;
+   std::vector<boost::uint64_t> primes;
+   boost::math::prime_range(0, 200000, std::back_inserter(primes));
+   BOOST_CHECK_EQUAL(primes.size(), 17984u);
+   for(unsigned i = 0; i < primes.size(); ++i)
+   {
+      BOOST_CHECK_EQUAL(boost::math::prime(i), primes[i]);
+   }
+   // https://oeis.org/A006988
+   BOOST_CHECK_EQUAL(boost::math::prime(99999), 1299709u);
+   BOOST_CHECK_EQUAL(boost::math::prime(999999), 15485863u);
+   BOOST_CHECK_EQUAL(boost::math::prime(9999999), 179424673u);
+   BOOST_CHECK_EQUAL(boost::math::prime(99999999), 2038074743u);
+   BOOST_CHECK_EQUAL(boost::math::prime(boost::math::max_sieved_prime), 4294967291u);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(boost::math::prime(boost::math::max_sieved_prime + 1), std::domain_error);
+#endif
+}
+
+void test_prime_count()
+{
+   std::cout << "Testing prime_count" << std::endl;
+   // https://oeis.org/A006880
+   static const boost::uint64_t counts[] = { 0, 4, 25, 168, 1229, 9592, 78498, 664579, 5761455, 50847534 };
+   boost::uint64_t x = 1;
+   for(unsigned i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i, x *= 10)
+   {
+      BOOST_CHECK_EQUAL(boost::math::prime_count(x), counts[i]);
+   }
+   BOOST_CHECK_EQUAL(boost::math::prime_count(0), 0u);
+   BOOST_CHECK_EQUAL(boost::math::prime_count(2), 1u);
+   BOOST_CHECK_EQUAL(boost::math::prime_count(4294967295u), 203280221u);
+   for(unsigned n = 9000; n < 400000; n += 997)
+   {
+      boost::uint64_t p = boost::math::prime(n);
+      BOOST_CHECK_EQUAL(boost::math::prime_count(p), n + 1);
+      BOOST_CHECK_EQUAL(boost::math::prime_count(p - 1), n);
+   }
+}
+
+void test_is_prime()
+{
+   std::cout << "Testing is_prime and next_prime" << std::endl;
+   std::vector<boost::uint64_t> primes;
+   boost::math::prime_range(0, 300000, std::back_inserter(primes));
+   std::vector<boost::uint64_t>::const_iterator next = primes.begin();
+   for(boost::uint64_t n = 0; n < primes.back(); ++n)
+   {
+      bool expected = (n == *next);
+      if(expected)
+         ++next;
+      BOOST_CHECK_EQUAL(boost::math::is_prime(n), expected);
+      BOOST_CHECK_EQUAL(boost::math::next_prime(n), *next);
+   }
+   // Strong pseudoprimes to several bases, https://oeis.org/A014233:
+   BOOST_CHECK(!boost::math::is_prime(2047u));
+   BOOST_CHECK(!boost::math::is_prime(3215031751u));
+   BOOST_CHECK(!boost::math::is_prime(2152302898747ull));
+   BOOST_CHECK(!boost::math::is_prime(3825123056546413051ull));
+   BOOST_CHECK(!boost::math::is_prime(318665857834031151ull));
+   BOOST_CHECK(!boost::math::is_prime(4294967297ull));
+   BOOST_CHECK(boost::math::is_prime(4294967291ull));
+   BOOST_CHECK(boost::math::is_prime(18446744073709551557ull));
+   BOOST_CHECK(!boost::math::is_prime(18446744073709551559ull));
+   BOOST_CHECK_EQUAL(boost::math::next_prime(4294967291ull), 4294967311ull);
+   BOOST_CHECK_EQUAL(boost::math::next_prime(18446744073709551533ull), 18446744073709551557ull);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(boost::math::next_prime(18446744073709551557ull), std::domain_error);
+#endif
+}
+
+void test_prime_range(boost::uint64_t a, boost::uint64_t b)
+{
+   std::vector<boost::uint64_t> primes;
+   boost::math::prime_range(a, b, std::back_inserter(primes));
+   std::vector<boost::uint64_t> expected;
+   for(boost::uint64_t n = a; n < b; ++n)
+   {
+      if(boost::math::is_prime(n))
+         expected.push_back(n);
+   }
+   BOOST_CHECK_EQUAL_COLLECTIONS(primes.begin(), primes.end(), expected.begin(), expected.end());
+}
+
+void test_prime_ranges()
+{
+   std::cout << "Testing prime_range" << std::endl;
+   // Ranges within the checkpoints, between 104729^2 and 2^48 where the sieve needs more primes than
+   // are in the table, and beyond 2^48 where the sieve is completed by Miller-Rabin:
+   test_prime_range(0, 3);
+   test_prime_range(3, 3);
+   test_prime_range(262100, 262200);
+   test_prime_range(4294000000ull, 4295000000ull);
+   test_prime_range(10968163441ull - 100000, 10968163441ull + 2000000);
+   test_prime_range(281474976710656ull - 1000000, 281474976710656ull + 1000000);
+   test_prime_range(1000000000000000000ull, 1000000000001000000ull);
+   test_prime_range(18446744073709000000ull, 18446744073709100000ull);
+#ifndef BOOST_NO_EXCEPTIONS
+   std::vector<boost::uint64_t> primes;
+   BOOST_CHECK_THROW(boost::math::prime_range(0, 18446744073709551615ull, std::back_inserter(primes)), std::domain_error);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_sieved_prime();
+   test_prime_count();
+   test_is_prime();
+   test_prime_ranges();
+}
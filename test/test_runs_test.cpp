@@ -11,6 +11,8 @@
 #include <boost/math/statistics/runs_test.hpp>
 
 using boost::math::statistics::runs_above_and_below_median;
+using boost::math::statistics::sliding_runs_above_and_below_median;
+using boost::math::statistics::streaming_runs_above_and_below_median;
 
 void test_agreement_with_r_randtests()
 {
@@ -68,8 +70,64 @@ void test_constant_vector()
     }
 }
 
+template<class Real>
+void test_sliding_window(std::size_t window, int levels)
+{
+    // Few levels give many ties with the median, which then moves without changing value:
+    std::mt19937 gen{static_cast<unsigned>(window + levels)};
+    std::uniform_int_distribution<int> dis(0, levels - 1);
+    std::vector<Real> v(600);
+    for (auto & x : v) {
+        x = static_cast<Real>(dis(gen));
+    }
+    auto results = sliding_runs_above_and_below_median(v, window);
+    CHECK_EQUAL(v.size() - window + 1, results.size());
+    for (std::size_t k = 0; k < results.size(); ++k) {
+        std::vector<Real> w(v.begin() + k, v.begin() + k + window);
+        auto [expected_statistic, expected_pvalue] = runs_above_and_below_median(w);
+        if (std::isnan(expected_statistic)) {
+            CHECK_EQUAL(true, std::isnan(results[k].first));
+        }
+        else {
+            CHECK_ULP_CLOSE(expected_statistic, results[k].first, 0);
+        }
+        CHECK_ULP_CLOSE(expected_pvalue, results[k].second, 0);
+    }
+}
+
+void test_streaming()
+{
+    // Before the window fills, the test is over the samples seen so far:
+    streaming_runs_above_and_below_median<double> runs(100);
+    std::vector<double> v{5, 2, 0, 4, 7, 9, 10, 6, 1, 8, 3};
+    for (auto x : v) {
+        runs.push(x);
+    }
+    CHECK_EQUAL(v.size(), runs.size());
+    CHECK_ULP_CLOSE(5.0, runs.median(), 0);
+    auto [t, p] = runs.statistic_and_p_value();
+    CHECK_ULP_CLOSE(-0.670820393249936919, t, 3);
+    CHECK_ULP_CLOSE(0.502334954360502017, p, 3);
+
+    bool thrown = false;
+    try {
+        runs.push(std::numeric_limits<double>::quiet_NaN());
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
 int main()
 {
+    test_sliding_window<double>(2, 3);
+    test_sliding_window<double>(17, 1000000);
+    test_sliding_window<double>(17, 4);
+    test_sliding_window<double>(64, 3);
+    test_sliding_window<float>(33, 1000);
+    test_sliding_window<float>(600, 5);
+    test_streaming();
     test_constant_vector();
     test_agreement_with_r_randtests();
     test_doc_example();
@@ -0,0 +1,195 @@
+// test_sampling.cpp
+
+// Copyright John Maddock 2026.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// The samplers are checked statistically: continuous distributions with
+// the Kolmogorov-Smirnov statistic against the cdf, and discrete ones by
+// comparing observed frequencies with the pdf.  The generator is seeded
+// with a fixed value so the tests are reproducible; the bounds used are
+// wide enough that a correct sampler fails with negligible probability.
+//
+#include <boost/math/distributions.hpp>
+#include <boost/math/distributions/sampling.hpp>
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp> // for test_main
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+static const unsigned sample_count = 20000;
+
+template <class Dist>
+void check_continuous(const Dist& d, const char* name)
+{
+   typedef typename Dist::value_type value_type;
+   std::mt19937_64 gen(42);
+   std::vector<value_type> v(sample_count);
+   boost::math::sample(d, gen, v.begin(), v.end());
+   std::sort(v.begin(), v.end());
+   value_type ks = 0;
+   for(unsigned i = 0; i < v.size(); ++i)
+   {
+      value_type c = cdf(d, v[i]);
+      ks = (std::max)(ks, (std::max)(c - value_type(i) / v.size(), value_type(i + 1) / v.size() - c));
+   }
+   // 2.3 / sqrt(n) is the 0.01% critical value of the KS statistic:
+   if(ks * sqrt(value_type(sample_count)) >= 2.3f)
+      std::cout << "KS statistic for " << name << " was " << ks << std::endl;
+   BOOST_CHECK(ks * sqrt(value_type(sample_count)) < 2.3f);
+   //
+   // A single variate must come from the same distribution:
+   //
+   value_type x = boost::math::sample(d, gen);
+   BOOST_CHECK((x >= range(d).first) && (x <= range(d).second));
+}
+
+template <class Dist>
+void check_discrete(const Dist& d, const char* name)
+{
+   typedef typename Dist::value_type value_type;
+   std::mt19937_64 gen(42);
+   std::vector<value_type> v(sample_count);
+   boost::math::sample(d, gen, v.begin(), v.end());
+   std::sort(v.begin(), v.end());
+   for(unsigned i = 0; i < v.size(); ++i)
+   {
+      // Every variate must be an integer in range:
+      BOOST_CHECK_EQUAL(v[i], floor(v[i]));
+      BOOST_CHECK((v[i] >= range(d).first) && (v[i] <= range(d).second));
+   }
+   //
+   // Compare the frequency of each value with its probability,
+   // allowing 5 standard deviations of the binomial count:
+   //
+   for(unsigned i = 0; i < v.size();)
+   {
+      unsigned j = i;
+      while((j < v.size()) && (v[j] == v[i]))
+         ++j;
+      value_type p = pdf(d, v[i]);
+      value_type observed = value_type(j - i) / sample_count;
+      value_type tolerance = 5 * sqrt(p * (1 - p) / sample_count) + value_type(2) / sample_count;
+      if(fabs(observed - p) >= tolerance)
+         std::cout << "Frequency of " << v[i] << " for " << name << " was " << observed << " expected " << p << std::endl;
+      BOOST_CHECK(fabs(observed - p) < tolerance);
+      i = j;
+   }
+   //
+   // And the sample mean with the true one:
+   //
+   value_type total = 0;
+   for(unsigned i = 0; i < v.size(); ++i)
+      total += v[i];
+   value_type m = total / sample_count;
+   BOOST_CHECK(fabs(m - mean(d)) < 5 * standard_deviation(d) / sqrt(value_type(sample_count)));
+}
+
+template <class RealType>
+void check_binomial_btpe(RealType n, RealType p)
+{
+   BOOST_MATH_STD_USING
+   boost::math::binomial_distribution<RealType> d(n, p);
+   //
+   // The final acceptance test of BTPE must be log(f(y) / f(m)), to
+   // within the rounding error of its terms, which are of order n:
+   //
+   RealType m = floor(n * p + p);
+   RealType sd = standard_deviation(d);
+   for(RealType y = floor(m - 6 * sd); y <= m + 6 * sd; y += 1)
+   {
+      RealType expected = log(pdf(d, y) / pdf(d, m));
+      RealType found = boost::math::detail::binomial_log_pdf_ratio(n, p, m, y);
+      BOOST_CHECK_SMALL(found - expected, 2 * n * boost::math::tools::epsilon<RealType>());
+   }
+   //
+   // And a chi squared test of the variates, pooling the tails so that
+   // every cell has an expected count of at least 5:
+   //
+   const unsigned count = 200000;
+   std::mt19937_64 gen(42);
+   std::vector<RealType> v(count);
+   boost::math::sample(d, gen, v.begin(), v.end());
+   RealType lower = quantile(d, RealType(5) / count);
+   RealType upper = quantile(complement(d, RealType(5) / count));
+   std::vector<unsigned> observed(static_cast<std::size_t>(upper - lower) + 1);
+   for(unsigned i = 0; i < count; ++i)
+      ++observed[static_cast<std::size_t>((std::min)((std::max)(v[i], lower), upper) - lower)];
+   RealType chi2 = 0;
+   for(std::size_t i = 0; i < observed.size(); ++i)
+   {
+      RealType x = lower + i;
+      RealType expected = count * (x == lower ? cdf(d, x) : x == upper ? cdf(complement(d, x - 1)) : pdf(d, x));
+      chi2 += (observed[i] - expected) * (observed[i] - expected) / expected;
+   }
+   // The 0.01% critical value, from the normal approximation to chi squared:
+   RealType df = RealType(observed.size() - 1);
+   RealType critical = df + 4 * sqrt(2 * df);
+   if(chi2 >= critical)
+      std::cout << "Chi squared statistic for binomial(" << n << ", " << p << ") was " << chi2 << " with " << df << " degrees of freedom" << std::endl;
+   BOOST_CHECK(chi2 < critical);
+}
+
+template <class RealType>
+void test_spots(RealType)
+{
+   using namespace boost::math;
+   check_continuous(normal_distribution<RealType>(2, 3), "normal");
+   check_continuous(lognormal_distribution<RealType>(1, RealType(0.5)), "lognormal");
+   check_continuous(skew_normal_distribution<RealType>(1, 2, -4), "skew_normal");
+   check_continuous(exponential_distribution<RealType>(RealType(0.25)), "exponential");
+   check_continuous(gamma_distribution<RealType>(RealType(0.3), 2), "gamma");
+   check_continuous(gamma_distribution<RealType>(RealType(7.5), 2), "gamma");
+   check_continuous(chi_squared_distribution<RealType>(5), "chi_squared");
+   check_continuous(inverse_gamma_distribution<RealType>(3, 2), "inverse_gamma");
+   check_continuous(inverse_chi_squared_distribution<RealType>(6, RealType(0.5)), "inverse_chi_squared");
+   check_continuous(beta_distribution<RealType>(RealType(0.5), 3), "beta");
+   check_continuous(beta_distribution<RealType>(RealType(0.05), RealType(0.2)), "beta");
+   check_continuous(students_t_distribution<RealType>(RealType(3.5)), "students_t");
+   check_continuous(fisher_f_distribution<RealType>(4, 9), "fisher_f");
+   check_continuous(inverse_gaussian_distribution<RealType>(2, RealType(0.5)), "inverse_gaussian");
+   check_continuous(inverse_gaussian_distribution<RealType>(1, 50), "inverse_gaussian");
+   check_continuous(non_central_chi_squared_distribution<RealType>(4, 12), "non_central_chi_squared");
+   check_continuous(non_central_beta_distribution<RealType>(2, 3, 5), "non_central_beta");
+   check_continuous(non_central_f_distribution<RealType>(4, 9, 6), "non_central_f");
+   check_continuous(non_central_t_distribution<RealType>(7, 2), "non_central_t");
+   check_continuous(frozen_non_central_chi_squared_distribution<RealType>(4, 12), "frozen_non_central_chi_squared");
+   check_continuous(weibull_distribution<RealType>(2, 3), "weibull");
+   check_continuous(cauchy_distribution<RealType>(1, 2), "cauchy");
+   check_continuous(triangular_distribution<RealType>(-1, 0, 2), "triangular");
+
+   std::vector<RealType> probs, rates;
+   probs.push_back(RealType(0.25));
+   probs.push_back(RealType(0.75));
+   rates.push_back(RealType(0.5));
+   rates.push_back(5);
+   check_continuous(hyperexponential_distribution<RealType>(probs, rates), "hyperexponential");
+
+   check_discrete(bernoulli_distribution<RealType>(RealType(0.3)), "bernoulli");
+   check_discrete(binomial_distribution<RealType>(20, RealType(0.4)), "binomial");
+   check_discrete(binomial_distribution<RealType>(500, RealType(0.3)), "binomial");
+   check_discrete(binomial_distribution<RealType>(1000, RealType(0.9)), "binomial");
+   check_binomial_btpe(RealType(2000), RealType(0.4));
+   check_binomial_btpe(RealType(1200), RealType(0.05));
+   check_discrete(poisson_distribution<RealType>(RealType(3.5)), "poisson");
+   check_discrete(poisson_distribution<RealType>(250), "poisson");
+   check_discrete(negative_binomial_distribution<RealType>(5, RealType(0.3)), "negative_binomial");
+   check_discrete(geometric_distribution<RealType>(RealType(0.2)), "geometric");
+   check_discrete(hypergeometric_distribution<RealType>(50, 80, 200), "hypergeometric");
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_spots(0.0F);
+   test_spots(0.0);
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_spots(0.0L);
+#endif
+}
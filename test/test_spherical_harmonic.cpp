@@ -108,6 +108,12 @@ BOOST_AUTO_TEST_CASE( test_main )
    test_spots(0.0L, "long double");
    test_spots(boost::math::concepts::real_concept(0.1), "real_concept");
 #endif
+   test_all_spherical_harmonics(0.0F, "float");
+   test_all_spherical_harmonics(0.0, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_all_spherical_harmonics(0.0L, "long double");
+   test_all_spherical_harmonics(boost::math::concepts::real_concept(0.1), "real_concept");
+#endif
 
    expected_results();
 
@@ -9,8 +9,11 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/math/special_functions/math_fwd.hpp>
+#include <boost/math/special_functions/spherical_harmonic.hpp>
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/array.hpp>
+#include <iterator>
+#include <vector>
 #include "functor.hpp"
 
 #include "handle_test_result.hpp"
@@ -211,3 +214,59 @@ void test_spots(T, const char* t)
    BOOST_CHECK_CLOSE_FRACTION(::boost::math::spherical_harmonic_r(53, 42, static_cast<T>(-8.75), static_cast<T>(-2.25)), static_cast<T>(-0.0008147976618889536159592309471859037113647L), tolerance);
    BOOST_CHECK_CLOSE_FRACTION(::boost::math::spherical_harmonic_i(53, 42, static_cast<T>(-8.75), static_cast<T>(-2.25)), static_cast<T>(0.0002099802242493057018193798824353982612756L), tolerance);
 }
+
+template <class T>
+void test_all_spherical_harmonics(T, const char* t)
+{
+   std::cout << "Testing all spherical harmonics up to a given degree for type " << t << std::endl;
+   BOOST_MATH_STD_USING
+   //
+   // Against the harmonics one at a time, whose values are no larger than about sqrt(n):
+   //
+   T tolerance = boost::math::tools::epsilon<T>() * 200;
+   static const T directions[][2] = { { T(0.5), T(0) }, { T(0.75), T(-0.25) }, { T(-0.75), T(2.25) }, { T(4), T(2.25) }, { T(-8.75), T(-2.25) }, { T(0), T(1) }, { T(1e-3), T(0.5) } };
+   boost::math::spherical_harmonic_evaluator<T> evaluator(40);
+   BOOST_CHECK_EQUAL(evaluator.max_degree(), 40u);
+   BOOST_CHECK_EQUAL(evaluator.size(), 41u * 42u / 2);
+   BOOST_CHECK_EQUAL(evaluator.index(3, 2), 8u);
+   std::vector<std::complex<T> > y(evaluator.size());
+   for(unsigned i = 0; i < sizeof(directions) / sizeof(directions[0]); ++i)
+   {
+      BOOST_CHECK(evaluator(directions[i][0], directions[i][1], y.begin()) == y.end());
+      for(unsigned n = 0; n <= 40; ++n)
+      {
+         for(unsigned m = 0; m <= n; ++m)
+         {
+            std::complex<T> expected = boost::math::spherical_harmonic(n, static_cast<int>(m), directions[i][0], directions[i][1]);
+            BOOST_CHECK_SMALL(abs(y[evaluator.index(n, m)] - expected), tolerance);
+         }
+      }
+   }
+   std::vector<std::complex<T> > z;
+   boost::math::spherical_harmonics(3, static_cast<T>(0.5), static_cast<T>(0), std::back_inserter(z));
+   BOOST_CHECK_EQUAL(z.size(), 10u);
+   BOOST_CHECK_CLOSE_FRACTION(z[8].real(), static_cast<T>(0.2061460599687871330692286791802688341213L), tolerance);
+   //
+   // For large expansions, the addition theorem sum_m |Y_n^m|^2 = (2n+1)/(4 pi) checks every degree,
+   // including the orders which underflow near the poles. The error of the recurrences grows slowly with the degree:
+   //
+   if(std::numeric_limits<T>::is_specialized)
+   {
+      boost::math::spherical_harmonic_evaluator<T> large(1000);
+      y.resize(large.size());
+      static const T thetas[] = { T(0.01), T(1), T(3.125) };
+      for(unsigned i = 0; i < sizeof(thetas) / sizeof(thetas[0]); ++i)
+      {
+         large(thetas[i], static_cast<T>(0.25), y.begin());
+         for(unsigned n = 0; n <= 1000; n += 37)
+         {
+            T sum = norm(y[large.index(n, 0)]);
+            for(unsigned m = 1; m <= n; ++m)
+            {
+               sum += 2 * norm(y[large.index(n, m)]);
+            }
+            BOOST_CHECK_CLOSE_FRACTION(sum, (2 * n + 1) / (4 * boost::math::constants::pi<T>()), tolerance * 50);
+         }
+      }
+   }
+}
@@ -8,6 +8,7 @@
 #include "math_unit_test.hpp"
 #include <vector>
 #include <random>
+#include <execution>
 #include <boost/math/statistics/univariate_statistics.hpp>
 #include <boost/math/statistics/t_test.hpp>
 
@@ -86,10 +87,130 @@ void test_agreement_with_mathematica()
 }
 
 
+template<typename Real>
+void test_coefficient_t_test()
+{
+    // A mean is a fit of a constant, with standard error s/sqrt(n) on n - 1 degrees of freedom:
+    std::mt19937 gen{876};
+    std::normal_distribution<Real> dis{1,3};
+    std::vector<Real> v(300);
+    for (auto & x : v) {
+      x = dis(gen);
+    }
+    auto [mu, s_sq] = boost::math::statistics::mean_and_sample_variance(v);
+    Real n = v.size();
+    auto [t, p] = boost::math::statistics::one_sample_t_test(v, Real(0.5));
+    auto [t_, p_] = boost::math::statistics::coefficient_t_test(mu, sqrt(s_sq/n), n - 1, Real(0.5));
+    CHECK_ULP_CLOSE(t, t_, 2);
+    CHECK_ULP_CLOSE(p, p_, 8);
+}
+
+template<typename Real>
+void test_two_sample_t_tests()
+{
+    using std::sqrt;
+    using std::atan;
+    using namespace boost::math::statistics;
+    // On 2 degrees of freedom, the two sided p-value of t is 1 - |t|/sqrt(t^2 + 2):
+    std::vector<Real> u{1, 3};
+    std::vector<Real> v{2, 6};
+    auto [t, p] = two_sample_t_test(u, v);
+    CHECK_ULP_CLOSE(-2/sqrt(Real(5)), t, 4);
+    CHECK_ULP_CLOSE(1 - 2/sqrt(Real(14)), p, 16);
+    // The unequal variances do not change the statistic here, but the degrees of freedom are 25/17:
+    auto [t_w, p_w] = welch_t_test(u.begin(), u.end(), v.begin(), v.end());
+    CHECK_ULP_CLOSE(t, t_w, 4);
+    auto student = boost::math::students_t_distribution<Real>(Real(25)/Real(17));
+    CHECK_ULP_CLOSE(2*boost::math::cdf(student, t), p_w, 32);
+
+    // The differences are 1, 2, 3, so t = 2 sqrt(3) on 2 degrees of freedom:
+    std::vector<Real> a{1, 2, 4};
+    std::vector<Real> b{0, 0, 1};
+    auto [t_p, p_p] = paired_samples_t_test(a, b);
+    CHECK_ULP_CLOSE(2*sqrt(Real(3)), t_p, 4);
+    CHECK_ULP_CLOSE(1 - 2*sqrt(Real(3))/sqrt(Real(14)), p_p, 16);
+
+    // When one sample has no variance, the Welch test has one degree of freedom, and p = 1 - 2 atan(|t|)/pi:
+    auto [t_1, p_1] = welch_t_test(Real(3), Real(2), Real(2), Real(1), Real(0), Real(100));
+    CHECK_ULP_CLOSE(Real(2), t_1, 2);
+    CHECK_ULP_CLOSE(1 - 2*atan(Real(2))/boost::math::constants::pi<Real>(), p_1, 16);
+    auto [t_2, p_2] = two_sample_t_test(Real(3), Real(2), Real(2), Real(1), Real(2), Real(2));
+    CHECK_ULP_CLOSE(sqrt(Real(2)), t_2, 2);
+    CHECK_ULP_CLOSE(1 - 1/sqrt(Real(2)), p_2, 16);
+}
+
+template<typename Real>
+void test_batched_t_tests()
+{
+    using namespace boost::math::statistics;
+    std::mt19937 gen{31};
+    std::normal_distribution<Real> dis{0, 1};
+    std::size_t groups = 40;
+    std::uniform_int_distribution<int> group_dis(0, int(groups) - 2);
+    std::vector<Real> values(50000);
+    std::vector<int> labels(values.size());
+    std::vector<std::vector<Real>> by_group(groups);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        // The last group is empty:
+        labels[i] = group_dis(gen);
+        values[i] = (labels[i] % 5) + (1 + labels[i] % 3)*dis(gen);
+        by_group[labels[i]].push_back(values[i]);
+    }
+    auto summaries = grouped_mean_and_sample_variance(values, labels, groups);
+    auto par_summaries = grouped_mean_and_sample_variance(std::execution::par, values, labels, groups);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (std::size_t g = 0; g + 1 < groups; ++g) {
+        auto [mu, s_sq] = mean_and_sample_variance(by_group[g]);
+        CHECK_MOLLIFIED_CLOSE(mu, std::get<0>(summaries[g]), tol);
+        CHECK_MOLLIFIED_CLOSE(s_sq, std::get<1>(summaries[g]), tol);
+        CHECK_EQUAL(Real(by_group[g].size()), std::get<2>(summaries[g]));
+        CHECK_EQUAL(std::get<1>(summaries[g]), std::get<1>(par_summaries[g]));
+    }
+    CHECK_EQUAL(Real(0), std::get<2>(summaries.back()));
+    CHECK_EQUAL(true, (boost::math::isnan)(std::get<0>(summaries.back())));
+
+    std::vector<std::pair<int, int>> comparisons;
+    for (int i = 0; i + 1 < int(groups); ++i) {
+        for (int j = i + 1; j + 1 < int(groups); ++j) {
+            comparisons.emplace_back(i, j);
+        }
+    }
+    std::vector<std::pair<Real, Real>> pooled(comparisons.size());
+    std::vector<std::pair<Real, Real>> welch(comparisons.size());
+    two_sample_t_test(std::execution::par, summaries, comparisons.begin(), comparisons.end(), pooled.begin());
+    welch_t_test(std::execution::seq, summaries, comparisons.begin(), comparisons.end(), welch.begin());
+    for (std::size_t k = 0; k < comparisons.size(); k += 37) {
+        auto [i, j] = comparisons[k];
+        auto [t, p] = two_sample_t_test(by_group[i], by_group[j]);
+        CHECK_MOLLIFIED_CLOSE(t, pooled[k].first, 256*tol);
+        CHECK_MOLLIFIED_CLOSE(p, pooled[k].second, 256*tol);
+        auto [t_w, p_w] = welch_t_test(by_group[i], by_group[j]);
+        CHECK_MOLLIFIED_CLOSE(t_w, welch[k].first, 256*tol);
+        CHECK_MOLLIFIED_CLOSE(p_w, welch[k].second, 256*tol);
+    }
+
+    bool thrown = false;
+    try {
+        labels[7] = -1;
+        grouped_mean_and_sample_variance(values, labels, groups);
+    }
+    catch (std::domain_error const &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(true, thrown);
+}
+
 int main()
 {
     test_agreement_with_mathematica();
     test_exact_mean<float>();
     test_exact_mean<double>();
+    test_coefficient_t_test<float>();
+    test_coefficient_t_test<double>();
+    test_two_sample_t_tests<float>();
+    test_two_sample_t_tests<double>();
+    test_two_sample_t_tests<long double>();
+    test_batched_t_tests<double>();
+    test_batched_t_tests<float>();
     return boost::math::test::report_errors();
 }
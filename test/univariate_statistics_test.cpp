@@ -10,6 +10,7 @@
 #include <forward_list>
 #include <algorithm>
 #include <random>
+#include <execution>
 #include <boost/core/lightweight_test.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/math/constants/constants.hpp>
@@ -833,6 +834,277 @@ void test_interquartile_range()
     BOOST_TEST_EQ(iqr, 6);
 }
 
+template<class Real>
+void test_execution_policy_moments()
+{
+    using std::abs;
+    using namespace boost::math::statistics;
+    Real eps = std::numeric_limits<Real>::epsilon();
+    // Long enough to be split into many chunks, with a ragged final chunk:
+    std::vector<Real> v(100003);
+    std::mt19937 gen(8123);
+    std::exponential_distribution<Real> dis(1);
+    for (auto & x : v)
+    {
+        // Offset from zero so that the merge has to recentre the chunks:
+        x = 1000 + dis(gen);
+    }
+    // Two pass reference values in extended precision:
+    cpp_bin_float_50 ref_mu = 0;
+    for (auto x : v)
+    {
+        ref_mu += x;
+    }
+    ref_mu /= v.size();
+    cpp_bin_float_50 ref_m2 = 0;
+    cpp_bin_float_50 ref_m3 = 0;
+    cpp_bin_float_50 ref_m4 = 0;
+    for (auto x : v)
+    {
+        cpp_bin_float_50 d = x - ref_mu;
+        ref_m2 += d*d;
+        ref_m3 += d*d*d;
+        ref_m4 += d*d*d*d;
+    }
+    ref_m2 /= v.size();
+    ref_m3 /= v.size();
+    ref_m4 /= v.size();
+    auto close = [](cpp_bin_float_50 expected, Real computed, Real tol) { return abs(expected - computed) <= tol*abs(expected); };
+
+    Real mu = mean(std::execution::par, v);
+    BOOST_TEST(close(ref_mu, mu, 8*eps));
+    BOOST_TEST(mu == mean(std::execution::seq, v));
+
+    Real sigma_sq = variance(std::execution::par, v);
+    BOOST_TEST(close(ref_m2, sigma_sq, 128*eps));
+    BOOST_TEST(sigma_sq == variance(std::execution::seq, v.cbegin(), v.cend()));
+    Real s_sq = sample_variance(std::execution::par, v);
+    BOOST_TEST(close(ref_m2*v.size()/(v.size()-1), s_sq, 128*eps));
+    auto [m, s] = mean_and_sample_variance(std::execution::par_unseq, v);
+    BOOST_TEST(m == mu);
+    BOOST_TEST(s == s_sq);
+
+    auto [M1, M2, M3, M4] = first_four_moments(std::execution::par, v);
+    BOOST_TEST(M1 == mu);
+    BOOST_TEST(M2 == sigma_sq);
+    BOOST_TEST(close(ref_m3, M3, 512*eps));
+    BOOST_TEST(close(ref_m4, M4, 512*eps));
+    auto [S1, S2, S3, S4] = first_four_moments(std::execution::seq, v);
+    BOOST_TEST(M3 == S3);
+    BOOST_TEST(M4 == S4);
+
+    Real skew = skewness(std::execution::par, v);
+    BOOST_TEST(close(ref_m3/(ref_m2*sqrt(ref_m2)), skew, 1024*eps));
+    Real kurt = kurtosis(std::execution::par, v);
+    BOOST_TEST(close(ref_m4/(ref_m2*ref_m2), kurt, 1024*eps));
+    BOOST_TEST(excess_kurtosis(std::execution::par, v) == kurt - 3);
+
+    // Forward iterators are processed on the calling thread, with the same chunking:
+    std::forward_list<Real> l(v.begin(), v.end());
+    BOOST_TEST(mu == mean(std::execution::par, l.begin(), l.end()));
+    BOOST_TEST(kurt == kurtosis(std::execution::par, l));
+
+    // A constant dataset has no skewness:
+    std::vector<Real> w(20000, Real(3));
+    BOOST_TEST(skewness(std::execution::par, w) == 0);
+    BOOST_TEST(kurtosis(std::execution::par, w) == 0);
+    BOOST_TEST(variance(std::execution::par, w) == 0);
+}
+
+template<class Z>
+void test_integer_execution_policy_moments()
+{
+    using namespace boost::math::statistics;
+    double tol = 64*std::numeric_limits<double>::epsilon();
+    std::vector<Z> v = generate_random_vector<Z>(50000, 12);
+    double mu = mean(std::execution::par, v);
+    BOOST_TEST(abs(mu - mean(v)) <= tol*abs(mean(v)));
+    double sigma_sq = variance(std::execution::par, v);
+    BOOST_TEST(abs(sigma_sq - variance(v)) <= tol*sigma_sq);
+    double skew = skewness(std::execution::par, v);
+    BOOST_TEST(abs(skew - skewness(v)) <= 1e-10);
+}
+
+template<class Real>
+void test_execution_policy_order_statistics()
+{
+    using namespace boost::math::statistics;
+    std::mt19937 gen(41);
+    for (size_t n : {1, 2, 7, 4096, 4097, 100000, 100003})
+    {
+        std::vector<Real> v(n);
+        std::lognormal_distribution<Real> dis(0, 2);
+        for (auto & x : v)
+        {
+            x = dis(gen);
+        }
+        // Ties, and an outlier which squeezes the rest of the data into one bucket:
+        if (n > 100)
+        {
+            std::fill(v.begin(), v.begin() + n/10, v[n/2]);
+            v[3] = 1e30;
+            std::shuffle(v.begin(), v.end(), gen);
+        }
+        auto const original = v;
+
+        auto w = original;
+        BOOST_TEST_EQ(median(w), median(std::execution::par, original));
+        BOOST_TEST_EQ(median(w), median(std::execution::seq, original.cbegin(), original.cend()));
+        BOOST_TEST(v == original);
+
+        w = original;
+        BOOST_TEST_EQ(median_absolute_deviation(w), median_absolute_deviation(std::execution::par, original));
+        w = original;
+        BOOST_TEST_EQ(median_absolute_deviation(w, Real(1)), median_absolute_deviation(std::execution::seq, original, Real(1)));
+        if (n >= 3)
+        {
+            w = original;
+            BOOST_TEST_EQ(interquartile_range(w), interquartile_range(std::execution::par, original));
+        }
+
+        std::vector<Real> p{0, Real(0.01), Real(0.25), Real(0.5), Real(0.9), 1};
+        auto q = quantiles(std::execution::par, original, p);
+        BOOST_TEST(q == quantiles(original, p));
+        w = original;
+        std::sort(w.begin(), w.end());
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            Real h = (n-1)*p[i];
+            size_t j = static_cast<size_t>(std::floor(h));
+            Real expected = j + 1 < n ? w[j] + (h - j)*(w[j+1] - w[j]) : w[j];
+            BOOST_TEST_EQ(q[i], expected);
+        }
+        w = original;
+        BOOST_TEST_EQ(q[3], median(w));
+        BOOST_TEST(v == original);
+    }
+
+    // Constant data:
+    std::vector<Real> c(10000, Real(2));
+    BOOST_TEST_EQ(median(std::execution::par, c), Real(2));
+    BOOST_TEST_EQ(median_absolute_deviation(std::execution::par, c), Real(0));
+
+    // Infinities and NaNs have no bucket, and are selected as by median():
+    std::vector<Real> f(100001);
+    std::lognormal_distribution<Real> dis(0, 2);
+    for (auto & x : f)
+    {
+        x = dis(gen);
+    }
+    f[5] = std::numeric_limits<Real>::infinity();
+    f[17] = -std::numeric_limits<Real>::infinity();
+    f[2000] = std::numeric_limits<Real>::infinity();
+    auto w = f;
+    BOOST_TEST_EQ(median(w), median(std::execution::par, f));
+    std::vector<Real> p{Real(0.25), Real(0.5), Real(0.75)};
+    BOOST_TEST(quantiles(std::execution::par, f, p) == quantiles(f, p));
+    f[100] = std::numeric_limits<Real>::quiet_NaN();
+    w = f;
+    Real expected = median(w);
+    Real computed = median(std::execution::par, f);
+    BOOST_TEST(expected == computed || (std::isnan(expected) && std::isnan(computed)));
+
+    bool thrown = false;
+    try
+    {
+        quantiles(c, std::vector<Real>{Real(1.5)});
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+}
+
+template<class Z>
+void test_integer_execution_policy_order_statistics()
+{
+    using namespace boost::math::statistics;
+    auto const v = generate_random_vector<Z>(50001, 7);
+    auto w = v;
+    BOOST_TEST_EQ(median(w), median(std::execution::par, v));
+    auto q = quantiles(std::execution::par, v, std::vector<double>{0.5, 0.75});
+    BOOST_TEST_EQ(q[0], double(median(w)));
+}
+
+template<class Real>
+void test_execution_policy_gini_coefficient()
+{
+    using namespace boost::math::statistics;
+    std::mt19937 gen(17);
+    std::vector<Real> v(150001);
+    if constexpr (std::is_integral_v<Real>)
+    {
+        std::uniform_int_distribution<Real> dis(0, 1000000);
+        for (auto & x : v)
+        {
+            x = dis(gen);
+        }
+    }
+    else
+    {
+        std::exponential_distribution<double> dis(1);
+        for (auto & x : v)
+        {
+            x = static_cast<Real>(dis(gen));
+        }
+    }
+    auto const original = v;
+    auto expected = gini_coefficient(v);
+    auto computed = gini_coefficient(std::execution::par, original);
+    using std::sqrt;
+    // The sequential version accumulates its sums in a single pass, and so its error grows as sqrt(n):
+    decltype(computed) tol = 8*sqrt(decltype(computed)(v.size()))*std::numeric_limits<decltype(computed)>::epsilon();
+    BOOST_TEST(abs(expected - computed) < tol*expected);
+    BOOST_TEST(computed == gini_coefficient(std::execution::seq, original.cbegin(), original.cend()));
+    v = original;
+    expected = sample_gini_coefficient(v);
+    BOOST_TEST(abs(expected - sample_gini_coefficient(std::execution::par, original)) < tol*expected);
+
+    std::vector<Real> z(10, Real(0));
+    BOOST_TEST(gini_coefficient(std::execution::par, z) == 0);
+}
+
+// The number of blocks normally follows the number of hardware threads, so force several here,
+// which exercises the recount of each block after the keys have been permuted:
+template<class T>
+void test_radix_sort_blocks()
+{
+    using boost::math::statistics::detail::radix_key_traits;
+    using traits = radix_key_traits<T>;
+    std::mt19937_64 gen(23);
+    std::vector<T> v(1 << 18);
+    for (auto & x : v)
+    {
+        std::uint64_t u = gen();
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            x = static_cast<T>(std::ldexp(double(u >> 11), -30)) - T(2048);
+        }
+        else
+        {
+            x = static_cast<T>(u);
+        }
+    }
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    for (std::size_t blocks : {1, 2, 3, 4, 7})
+    {
+        std::vector<typename traits::key_type> keys(v.size());
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            keys[i] = traits::to_key(v[i]);
+        }
+        boost::math::statistics::detail::radix_sort(std::execution::par, keys, blocks);
+        std::size_t wrong = 0;
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            wrong += (traits::from_key(keys[i]) != expected[i]);
+        }
+        BOOST_TEST_EQ(wrong, 0u);
+    }
+}
+
 int main()
 {
     test_mean<float>();
@@ -902,5 +1174,28 @@ int main()
 
     test_interquartile_range<double>();
     test_interquartile_range<cpp_bin_float_50>();
+
+    test_execution_policy_moments<float>();
+    test_execution_policy_moments<double>();
+    test_execution_policy_moments<long double>();
+
+    test_integer_execution_policy_moments<int>();
+
+    test_execution_policy_order_statistics<float>();
+    test_execution_policy_order_statistics<double>();
+
+    test_integer_execution_policy_order_statistics<int>();
+
+    test_execution_policy_gini_coefficient<float>();
+    test_execution_policy_gini_coefficient<double>();
+    test_execution_policy_gini_coefficient<long double>();
+    test_execution_policy_gini_coefficient<cpp_bin_float_50>();
+    test_execution_policy_gini_coefficient<int>();
+    test_execution_policy_gini_coefficient<uint64_t>();
+
+    test_radix_sort_blocks<float>();
+    test_radix_sort_blocks<double>();
+    test_radix_sort_blocks<int>();
+    test_radix_sort_blocks<uint64_t>();
     return boost::report_errors();
 }